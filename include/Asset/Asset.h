@@ -33,7 +33,7 @@ namespace Nova::Core::Asset {
         const std::filesystem::path& GetPath() const { return m_Path; }
 
     protected:
-        UUID m_UUID;
+        UUID m_UUID = GenerateUUID();
         AssetType m_Type;
         std::filesystem::path m_Path;
     };
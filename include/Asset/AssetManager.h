@@ -4,11 +4,13 @@
 #include <filesystem>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Api.h"
 #include "AssetHandle.h"
 #include "Asset.h"
 #include "Core/Assert.h"
+#include "Core/FlatHashMap.h"
 #include "Core/UUID.h"
 
 namespace Nova::Core::Asset {
@@ -34,7 +36,8 @@ namespace Nova::Core::Asset {
 
             std::lock_guard<std::mutex> lock(m_Mutex);
 
-            // Cache hit by path
+            // Cache hit by path; a new holder takes over any pending release.
+            m_PendingReleases.erase(key);
             if (auto it = m_IdByPath.find(key); it != m_IdByPath.end()) {
                 const UUID id = it->second;
                 if (auto itA = m_AssetsById.find(id); itA != m_AssetsById.end()) {
@@ -65,11 +68,49 @@ namespace Nova::Core::Asset {
             return handle->Reload(); // assumes Asset exposes a virtual Reload()
         }
 
+        // Forgets the asset at `path` once nothing but the manager holds it, so its memory goes with the last
+        // user; a later Acquire() creates it again. While it is still referenced it is kept, marked for
+        // ReleasePending(), and false is returned.
+        bool Release(const std::filesystem::path& path) {
+            const std::string key = PathKey(NormalizePath(path));
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (TryReleaseLocked(key))
+                return true;
+            m_PendingReleases.insert(key);
+            return false;
+        }
+
+        // Retries the releases that found the asset still referenced (e.g. by a frame in flight).
+        // Call once per frame.
+        void ReleasePending() {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (auto it = m_PendingReleases.begin(); it != m_PendingReleases.end();) {
+                if (TryReleaseLocked(*it))
+                    it = m_PendingReleases.erase(it);
+                else
+                    ++it;
+            }
+        }
+
         //TODO acquire resources by UUID
         //template <typename T>
         //AssetHandle<T> Acquire(UUID uuid);
 
     private:
+        bool TryReleaseLocked(const std::string& key) {
+            auto it = m_IdByPath.find(key);
+            if (it == m_IdByPath.end())
+                return true;
+            if (auto itA = m_AssetsById.find(it->second); itA != m_AssetsById.end()) {
+                if (itA->second.use_count() > 1)
+                    return false;
+                m_AssetsById.erase(it->second);
+            }
+            m_IdByPath.erase(it);
+            return true;
+        }
+
         static std::filesystem::path NormalizePath(const std::filesystem::path& p) {
             std::error_code ec;
             auto abs = std::filesystem::absolute(p, ec);
@@ -90,8 +131,9 @@ namespace Nova::Core::Asset {
         }
 
         mutable std::mutex m_Mutex;
-        std::unordered_map<UUID, std::shared_ptr<Asset>> m_AssetsById;
+        FlatHashMap<UUID, std::shared_ptr<Asset>> m_AssetsById;
         std::unordered_map<std::string, UUID> m_IdByPath;
+        std::unordered_set<std::string> m_PendingReleases; // path keys whose Release() found the asset in use
     };
 
 } // Nova::Core::Asset
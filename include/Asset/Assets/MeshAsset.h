@@ -1,9 +1,12 @@
 #ifndef MESHASSET_H
 #define MESHASSET_H
 
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <glm/glm.hpp>
 
 #include "Api.h"
 #include "Asset/Asset.h"
@@ -54,10 +57,12 @@ namespace Nova::Core::Asset::Assets {
     public:
         MeshAsset(std::filesystem::path path, MeshAssetDesc desc = {});
 
+        // Safe from any thread (SceneStreamer loads on its loader jobs); concurrent calls load once.
         bool Load();
         bool Reload();
 
-        bool IsLoaded() const { return m_Loaded; }
+        // Once true, the meshes and bounds below are published and no longer change until Reload().
+        bool IsLoaded() const { return m_Loaded.load(std::memory_order_acquire); }
 
         MeshPrimitive GetPrimitive() const { return m_Primitive; }
         const MeshAssetDesc& GetDesc() const { return m_Desc; }
@@ -65,10 +70,14 @@ namespace Nova::Core::Asset::Assets {
         std::shared_ptr<Renderer::RHI::RHI_Mesh> GetCPUMesh() const { return m_CPUMesh; }
         std::shared_ptr<Renderer::RHI::RHI_Mesh> GetGPUMesh() const { return m_GPUMesh; }
 
+        // Local-space bounding sphere of the mesh (xyz: center, w: radius), computed on load.
+        const glm::vec4& GetBoundingSphere() const { return m_BoundingSphere; }
+
     private:
         bool LoadFromPath();
         bool LoadPrimitive(MeshPrimitive primitive);
         bool BuildGpuMesh(GraphicsAPI api);
+        void ComputeBounds();
 
         static bool IsEnginePrimitivePath(const std::filesystem::path& path, std::string* outName);
         static MeshPrimitive PrimitiveFromName(const std::string& name);
@@ -78,7 +87,9 @@ namespace Nova::Core::Asset::Assets {
 
         std::shared_ptr<Renderer::RHI::RHI_Mesh> m_CPUMesh;
         std::shared_ptr<Renderer::RHI::RHI_Mesh> m_GPUMesh;
-        bool m_Loaded = false;
+        glm::vec4 m_BoundingSphere{ 0.0f };
+        std::mutex m_LoadMutex;
+        std::atomic<bool> m_Loaded{ false };
     };
 
 } // namespace Nova::Core::Asset::Assets
@@ -1,9 +1,17 @@
 #ifndef SHADERASSET_H
 #define SHADERASSET_H
 
+#include <future>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "Api.h"
 #include "Asset/Asset.h"
 #include "Renderer/RHI/RHI_ShaderCompiler.h"
+#include "Renderer/RHI/RHI_ShaderPermutation.h"
 
 namespace Nova::Core::Asset::Assets {
 
@@ -17,6 +25,11 @@ namespace Nova::Core::Asset::Assets {
         // Force recompilation, useful for hot reload workflows.
         bool Recompile();
 
+        // Compiles every shader that is not compiled yet concurrently (e.g. all engine shaders at boot).
+        // Returns false if any of them failed; per-shader errors are in GetLastLog().
+        static bool CompileAll(const std::vector<std::shared_ptr<ShaderAsset>>& shaders);
+        static bool CompileAll(const std::vector<std::shared_ptr<ShaderAsset>>& shaders, Nova::Core::GraphicsAPI api);
+
         // Accessors populated after compilation.
         const std::vector<uint8_t>& GetBinary() const;
         Nova::Core::Renderer::RHI::RHI_ShaderBinaryFormat GetBinaryFormat() const;
@@ -33,8 +46,76 @@ namespace Nova::Core::Asset::Assets {
 
         Nova::Core::Renderer::RHI::RHI_ShaderStage GetStage() const { return m_Input.m_Stage; }
 
+        /**
+         * Keywords declared in the source and in the files it includes (see RHI_ShaderKeywordSet).
+         * Valid after Compile(); included files' keywords come after the shader's own.
+         */
+        const Nova::Core::Renderer::RHI::RHI_ShaderKeywordSet& GetKeywords() const { return m_Keywords; }
+
+        enum class VariantState : uint8_t { Ready, Pending, Failed };
+
+        /**
+         * SPIR-V for the variant selected by `mask` (bits of GetKeywords()). Only compile keywords
+         * select a binary; specialization keywords share one. Never blocks: the first request queues
+         * the compile on the job system and reports Pending until it is done. Binaries and failures
+         * are kept by mask until the next compile or reload. `outBinary` is set when Ready.
+         */
+        VariantState RequestVariantBinary(Nova::Core::Renderer::RHI::RHI_ShaderVariantMask mask,
+            const std::vector<uint8_t>*& outBinary);
+
+        /** Queues every compile-keyword variant not compiled yet, so later requests find them ready. */
+        void WarmVariants();
+
+        /** Every file the last successful compile read (this shader plus its includes). */
+        const std::vector<std::filesystem::path>& GetDependencies() const { return m_Dependencies; }
+
+        // Hot reload. The render thread snapshots BuildReloadBase(); BuildReloadInput() completes a copy of it
+        // from the source on disk on any thread without touching the asset. The result of compiling it is
+        // applied with ApplyReload() on the render thread; a failed result leaves the previous binary in place.
+        // RevertReload() restores the state from before the last ApplyReload(), e.g. when the renderer
+        // rejects the new binary.
+        Nova::Core::Renderer::RHI::RHI_ShaderCompileInput BuildReloadBase(Nova::Core::GraphicsAPI api) const;
+        static Nova::Core::Renderer::RHI::RHI_ShaderCompileInput BuildReloadInput(
+            Nova::Core::Renderer::RHI::RHI_ShaderCompileInput base,
+            Nova::Core::Renderer::RHI::RHI_ShaderKeywordSet& outKeywords);
+        bool ApplyReload(Nova::Core::GraphicsAPI api, Nova::Core::Renderer::RHI::RHI_ShaderKeywordSet&& keywords,
+            Nova::Core::Renderer::RHI::RHI_ShaderCompileResult&& result);
+        bool RevertReload();
+
+        /**
+         * One compile input per compile-keyword combination (variant 0 first), built exactly as
+         * Compile() and RequestVariantBinary() build them. Used to precompile the shader cache offline;
+         * compile the shader first so the keywords of its includes are known.
+         */
+        std::vector<Nova::Core::Renderer::RHI::RHI_ShaderCompileInput> BuildPermutationInputs(Nova::Core::GraphicsAPI api) const;
+
     private:
         bool CompileInternal(Nova::Core::GraphicsAPI api, bool force);
+        // Split of CompileInternal so CompileAll can batch the compiler call in between.
+        bool BeginCompile(Nova::Core::GraphicsAPI api, bool force,
+            Nova::Core::Renderer::RHI::RHI_ShaderCompileInput& outInput, bool& outUpToDate);
+        bool FinishCompile(Nova::Core::GraphicsAPI api, Nova::Core::Renderer::RHI::RHI_ShaderCompileResult&& out);
+        Nova::Core::Renderer::RHI::RHI_ShaderCompileInput BuildCompileInput(Nova::Core::GraphicsAPI api,
+            const Nova::Core::Renderer::RHI::RHI_ShaderKeywordSet& keywords,
+            Nova::Core::Renderer::RHI::RHI_ShaderVariantMask mask, bool force) const;
+        // BuildCompileInput() without the keyword defines.
+        Nova::Core::Renderer::RHI::RHI_ShaderCompileInput BuildBaseInput(Nova::Core::GraphicsAPI api, bool force) const;
+        // Adds the `// @keywords` of every dependency other than the shader itself.
+        void MergeDependencyKeywords();
+        void ClearVariants();
+
+        // Everything ApplyReload() replaces, kept so RevertReload() can put it back.
+        struct ReloadBackup {
+            Nova::Core::Renderer::RHI::RHI_ShaderBinaryFormat m_Format = Nova::Core::Renderer::RHI::RHI_ShaderBinaryFormat::Unknown;
+            std::vector<uint8_t> m_Binary;
+            std::string m_Source;
+            Nova::Core::Renderer::RHI::RHI_ProgramReflection m_Reflection{};
+            std::vector<std::filesystem::path> m_Dependencies;
+            Nova::Core::Renderer::RHI::RHI_ShaderKeywordSet m_Keywords{};
+            std::unordered_map<Nova::Core::Renderer::RHI::RHI_ShaderVariantMask, std::vector<uint8_t>> m_Variants;
+            Nova::Core::Renderer::RHI::RHI_ShaderStage m_Stage = Nova::Core::Renderer::RHI::RHI_ShaderStage::Unknown;
+            Nova::Core::GraphicsAPI m_LastCompiledApi = Nova::Core::GraphicsAPI::Vulkan;
+        };
 
         Nova::Core::Renderer::RHI::RHI_ShaderCompileInput m_Input;
 
@@ -47,9 +128,19 @@ namespace Nova::Core::Asset::Assets {
         std::string m_SourceVulkan;
 
         Nova::Core::Renderer::RHI::RHI_ProgramReflection m_ReflectionVulkan{};
+        std::vector<std::filesystem::path> m_Dependencies;
 
         Nova::Core::GraphicsAPI m_LastCompiledApi = Nova::Core::GraphicsAPI::Vulkan;
         std::string m_LastLog;
+
+        Nova::Core::Renderer::RHI::RHI_ShaderKeywordSet m_Keywords{};
+        // Non-zero compile masks only; mask 0 is m_BinaryVulkan.
+        std::unordered_map<Nova::Core::Renderer::RHI::RHI_ShaderVariantMask, std::vector<uint8_t>> m_Variants;
+        std::unordered_map<Nova::Core::Renderer::RHI::RHI_ShaderVariantMask,
+            std::shared_future<Nova::Core::Renderer::RHI::RHI_ShaderCompileResult>> m_PendingVariants;
+        std::unordered_set<Nova::Core::Renderer::RHI::RHI_ShaderVariantMask> m_FailedVariants;
+
+        std::optional<ReloadBackup> m_ReloadBackup;
     };
 
 } // Nova::Core::Asset::Assets
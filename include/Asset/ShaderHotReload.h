@@ -0,0 +1,97 @@
+#ifndef SHADERHOTRELOAD_H
+#define SHADERHOTRELOAD_H
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Api.h"
+#include "Asset/Assets/ShaderAsset.h"
+#include "Core/GraphicsAPI.h"
+
+namespace Nova::Core::Asset {
+
+    /**
+     * Watches the source files (and everything they include) of registered shader assets.
+     * On a change, dependents are recompiled on a background thread; results are handed back
+     * to the render thread through ApplyPending(), which is meant to run at a frame boundary.
+     * Failed compiles are logged and the previous binary stays in use. The watcher thread never reads
+     * the assets: it compiles from input snapshots taken on the render thread (Watch, Start, ApplyPending).
+     *
+     * Linux uses inotify on the directories involved; other platforms poll modification times.
+     */
+    class NV_API ShaderHotReload final {
+    public:
+        using ShaderList = std::vector<std::shared_ptr<Assets::ShaderAsset>>;
+        using ReloadListener = std::function<void(const ShaderList& reloaded)>;
+
+        static ShaderHotReload& Get() {
+            static ShaderHotReload s_Instance;
+            return s_Instance;
+        }
+
+        bool Start(GraphicsAPI api);
+        void Stop();
+        bool IsRunning() const { return m_Thread.joinable(); }
+
+        // Render thread. The asset should have been compiled so its dependency list is known.
+        void Watch(const std::shared_ptr<Assets::ShaderAsset>& shader);
+        void Unwatch(const Assets::ShaderAsset* shader);
+
+        // Called from ApplyPending() with the assets that received new binaries. A listener that cannot use a
+        // new binary calls ShaderAsset::RevertReload() on it; the watcher picks the reverted state up.
+        uint32_t AddListener(ReloadListener listener);
+        void RemoveListener(uint32_t id);
+
+        // Render thread, between frames: applies finished recompiles and notifies listeners.
+        void ApplyPending();
+
+    private:
+        ShaderHotReload() = default;
+        ~ShaderHotReload();
+        ShaderHotReload(const ShaderHotReload&) = delete;
+        ShaderHotReload& operator=(const ShaderHotReload&) = delete;
+
+        struct WatchedShader {
+            std::weak_ptr<Assets::ShaderAsset> m_Shader;
+            Renderer::RHI::RHI_ShaderCompileInput m_ReloadBase; // ShaderAsset::BuildReloadBase(), render thread
+        };
+
+        struct PendingReload {
+            std::shared_ptr<Assets::ShaderAsset> m_Shader;
+            Renderer::RHI::RHI_ShaderKeywordSet m_Keywords;
+            Renderer::RHI::RHI_ShaderCompileResult m_Result;
+        };
+
+        void ThreadMain();
+        // m_Mutex held, render thread. Rebuilds m_Dependents from the watched assets' dependency lists and
+        // refreshes their reload input snapshots.
+        void RebuildDependentsLocked();
+        void RecompileDependents(const std::vector<std::string>& changedFiles);
+
+        mutable std::mutex m_Mutex;
+        std::vector<WatchedShader> m_Watched;
+        // Normalized file path -> assets that read it during their last compile.
+        std::unordered_map<std::string, std::vector<std::weak_ptr<Assets::ShaderAsset>>> m_Dependents;
+        bool m_DependentsChanged = false;
+
+        std::vector<PendingReload> m_Pending;
+
+        std::vector<std::pair<uint32_t, ReloadListener>> m_Listeners;
+        uint32_t m_NextListenerId = 1;
+
+        GraphicsAPI m_Api = GraphicsAPI::Vulkan;
+        std::thread m_Thread;
+        std::atomic<bool> m_StopRequested{ false };
+    };
+
+} // Nova::Core::Asset
+
+#endif // SHADERHOTRELOAD_H
@@ -2,8 +2,11 @@
 #define APPLICATION_H
 
 #include <SDL3/SDL.h>
+#include <array>
+#include <atomic>
 #include <vector>
 #include <memory>
+#include <thread>
 
 #include "Api.h"
 #include "Core/Assert.h"
@@ -14,6 +17,8 @@
 #include "Events/InputEvents.h"
 #include "Core/ImGuiLayer.h"
 #include "Core/LayerStack.h"
+#include "Core/RenderFrame.h"
+#include "Core/SPSCQueue.h"
 
 namespace Nova::Core {
 
@@ -41,7 +46,24 @@ namespace Nova::Core {
 
         void OnEvent(Events::Event& e);
 
+        // Render frame N on a dedicated thread while the main thread simulates N+1 (Vulkan only); call before
+        // Run(). See RenderFrame for what layers must do differently.
+        void SetRenderThreadEnabled(bool enabled) { m_RenderThreadRequested = enabled; }
+        bool IsRenderThreadEnabled() const { return m_RenderThread.joinable(); }
+
+        // The frame being rendered; valid in OnBegin/OnRender/OnEnd (called on the render thread when enabled).
+        RenderFrame& GetRenderFrame() {
+            NV_ASSERT_MSG(m_RenderingFrame, "GetRenderFrame() called outside the render hooks.");
+            return *m_RenderingFrame;
+        }
+
+        // Blocks until the render thread has finished every submitted frame, e.g. before destroying or
+        // resizing anything it may still use. No-op without a render thread.
+        void FlushRenderThread();
+
     private:
+        // Frames the render thread may lag behind the main thread.
+        static constexpr size_t kMaxQueuedFrames = 2;
         static Application* s_Instance;
 
         bool m_IsRunning;
@@ -55,9 +77,26 @@ namespace Nova::Core {
         bool OnWindowClose(WindowClosedEvent& e);
         bool OnWindowResize(WindowResizeEvent& e);
 
+        void RunFrame(float dt);
+        void SubmitFrame(float dt);
+        void StartRenderThread();
+        void StopRenderThread();
+        void RenderThreadLoop();
+
         Window* m_Window = nullptr;
         ImGuiLayer* m_ImGuiLayer = nullptr;
         LayerStack m_LayerStack;
+
+        // One frame being extracted, up to kMaxQueuedFrames waiting for or in the render thread.
+        std::array<std::unique_ptr<RenderFrame>, kMaxQueuedFrames + 1> m_Frames;
+        SPSCQueue<RenderFrame*, kMaxQueuedFrames> m_SubmittedFrames;  // main -> render
+        SPSCQueue<RenderFrame*, kMaxQueuedFrames + 1> m_FreeFrames;   // render -> main
+        RenderFrame* m_RenderingFrame = nullptr;
+        std::thread m_RenderThread;
+        bool m_RenderThreadRequested = false;
+        uint64_t m_FrameIndex = 0;
+        uint64_t m_FramesSubmitted = 0;
+        std::atomic<uint64_t> m_FramesCompleted{ 0 };
     };
 
 } // namespace Nova::Core
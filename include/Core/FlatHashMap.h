@@ -0,0 +1,230 @@
+#ifndef FLATHASHMAP_H
+#define FLATHASHMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Core/Hash.h"
+
+namespace Nova::Core {
+
+    /** std::hash finalized with a 64-bit mix; std::hash of integers is the identity on common standard libraries. */
+    template<typename K>
+    struct FlatHash {
+        std::size_t operator()(const K& key) const noexcept {
+            return static_cast<std::size_t>(Detail::Fmix64(static_cast<std::uint64_t>(std::hash<K>{}(key))));
+        }
+    };
+
+    /**
+     * Open-addressing hash map with Robin Hood probing and backward-shift erase: keys and values live in one
+     * flat array, lookups are a short linear scan, and there are no tombstones. Use it for hot id -> value
+     * indices; the interface is the subset of std::unordered_map we rely on.
+     *
+     * Unlike std::unordered_map, any insertion or erase invalidates iterators and references. K and V must be
+     * default-constructible and movable; empty slots hold default-constructed pairs.
+     */
+    template<typename K, typename V, typename Hash = FlatHash<K>, typename KeyEqual = std::equal_to<K>>
+    class FlatHashMap {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<K, V>;
+        using size_type = std::size_t;
+
+        template<bool Const>
+        class Iterator {
+        public:
+            using Owner = std::conditional_t<Const, const FlatHashMap, FlatHashMap>;
+            using reference = std::conditional_t<Const, const value_type&, value_type&>;
+            using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+            Iterator() = default;
+            Iterator(Owner* map, size_type index) : m_Map(map), m_Index(index) { SkipEmpty(); }
+            operator Iterator<true>() const { return Iterator<true>(m_Map, m_Index); }
+
+            reference operator*() const { return m_Map->m_Slots[m_Index]; }
+            pointer operator->() const { return &m_Map->m_Slots[m_Index]; }
+
+            Iterator& operator++() { ++m_Index; SkipEmpty(); return *this; }
+            Iterator operator++(int) { Iterator copy = *this; ++*this; return copy; }
+
+            bool operator==(const Iterator& other) const { return m_Index == other.m_Index; }
+            bool operator!=(const Iterator& other) const { return m_Index != other.m_Index; }
+
+        private:
+            friend class FlatHashMap;
+
+            void SkipEmpty() {
+                while (m_Index < m_Map->m_Slots.size() && m_Map->m_Distances[m_Index] == 0)
+                    ++m_Index;
+            }
+
+            Owner* m_Map = nullptr;
+            size_type m_Index = 0;
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_Slots.size()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_Slots.size()); }
+
+        size_type size() const { return m_Size; }
+        bool empty() const { return m_Size == 0; }
+
+        // Keeps the capacity, so per-frame scratch maps do not reallocate.
+        void clear() {
+            for (size_type i = 0; i < m_Slots.size(); ++i) {
+                if (m_Distances[i] != 0) {
+                    m_Slots[i] = value_type{};
+                    m_Distances[i] = 0;
+                }
+            }
+            m_Size = 0;
+        }
+
+        // Makes room for `count` elements without rehashing.
+        void reserve(size_type count) {
+            size_type capacity = kMinCapacity;
+            while (capacity * kMaxLoadNum < count * kMaxLoadDen)
+                capacity *= 2;
+            if (capacity > m_Slots.size())
+                Rehash(capacity);
+        }
+
+        iterator find(const K& key) { return iterator(this, FindIndex(key)); }
+        const_iterator find(const K& key) const { return const_iterator(this, FindIndex(key)); }
+        bool contains(const K& key) const { return FindIndex(key) != m_Slots.size(); }
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+            if (const size_type index = FindIndex(key); index != m_Slots.size())
+                return { iterator(this, index), false };
+
+            if ((m_Size + 1) * kMaxLoadDen > m_Slots.size() * kMaxLoadNum)
+                reserve(m_Size + 1);
+            const size_type index = Insert(value_type(key, V(std::forward<Args>(args)...)));
+            return { iterator(this, index), true };
+        }
+
+        std::pair<iterator, bool> insert(value_type value) {
+            auto result = try_emplace(value.first);
+            if (result.second)
+                result.first->second = std::move(value.second);
+            return result;
+        }
+
+        V& operator[](const K& key) { return try_emplace(key).first->second; }
+
+        size_type erase(const K& key) {
+            const size_type index = FindIndex(key);
+            if (index == m_Slots.size())
+                return 0;
+            EraseAt(index);
+            return 1;
+        }
+
+        void erase(const_iterator it) { EraseAt(it.m_Index); }
+
+    private:
+        // m_Distances[i]: 0 for an empty slot, else 1 + distance from the key's home slot.
+        static constexpr size_type kMinCapacity = 16;
+        static constexpr size_type kMaxLoadNum = 7; // max load factor 7/8
+        static constexpr size_type kMaxLoadDen = 8;
+        static constexpr uint8_t kMaxDistance = 255;
+
+        size_type Home(const K& key) const { return Hash{}(key) & (m_Slots.size() - 1); }
+
+        size_type FindIndex(const K& key) const {
+            if (m_Size == 0)
+                return m_Slots.size();
+
+            const size_type mask = m_Slots.size() - 1;
+            size_type index = Home(key);
+            // Robin Hood invariant: once we are farther from home than the resident, the key is absent.
+            for (uint32_t distance = 1; distance <= m_Distances[index]; ++distance) {
+                if (m_Distances[index] == distance && KeyEqual{}(m_Slots[index].first, key))
+                    return index;
+                index = (index + 1) & mask;
+            }
+            return m_Slots.size();
+        }
+
+        // Inserts a key known to be absent; capacity must already allow it. Returns its slot.
+        size_type Insert(value_type value) {
+            const size_type mask = m_Slots.size() - 1;
+            const K key = value.first;
+            size_type index = Home(key);
+            size_type placed = m_Slots.size();
+            uint32_t distance = 1;
+
+            for (;;) {
+                if (m_Distances[index] == 0) {
+                    m_Slots[index] = std::move(value);
+                    m_Distances[index] = static_cast<uint8_t>(distance);
+                    ++m_Size;
+                    return placed == m_Slots.size() ? index : placed;
+                }
+
+                // Take the slot from a resident closer to its home, and carry the resident on.
+                if (m_Distances[index] < distance) {
+                    std::swap(m_Slots[index], value);
+                    const uint8_t resident = m_Distances[index];
+                    m_Distances[index] = static_cast<uint8_t>(distance);
+                    distance = resident;
+                    if (placed == m_Slots.size())
+                        placed = index;
+                }
+
+                index = (index + 1) & mask;
+                if (++distance == kMaxDistance) {
+                    // Pathological clustering: grow, re-insert what we carry, and look the key up again.
+                    Rehash(m_Slots.size() * 2);
+                    Insert(std::move(value));
+                    return FindIndex(key);
+                }
+            }
+        }
+
+        void EraseAt(size_type index) {
+            const size_type mask = m_Slots.size() - 1;
+            size_type next = (index + 1) & mask;
+            // Backward shift: pull the following displaced entries one slot closer to home.
+            while (m_Distances[next] > 1) {
+                m_Slots[index] = std::move(m_Slots[next]);
+                m_Distances[index] = static_cast<uint8_t>(m_Distances[next] - 1);
+                index = next;
+                next = (next + 1) & mask;
+            }
+            m_Slots[index] = value_type{};
+            m_Distances[index] = 0;
+            --m_Size;
+        }
+
+        void Rehash(size_type capacity) {
+            std::vector<value_type> slots(capacity);
+            std::vector<uint8_t> distances(capacity, 0);
+            slots.swap(m_Slots);
+            distances.swap(m_Distances);
+            m_Size = 0;
+            for (size_type i = 0; i < slots.size(); ++i) {
+                if (distances[i] != 0)
+                    Insert(std::move(slots[i]));
+            }
+        }
+
+        std::vector<value_type> m_Slots;  // power-of-two size, or empty
+        std::vector<uint8_t> m_Distances;
+        size_type m_Size = 0;
+    };
+
+} // namespace Nova::Core
+
+#endif // FLATHASHMAP_H
@@ -0,0 +1,108 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace Nova::Core {
+
+    struct Hash128 {
+        std::uint64_t m_Low = 0;
+        std::uint64_t m_High = 0;
+
+        bool operator==(const Hash128& other) const { return m_Low == other.m_Low && m_High == other.m_High; }
+        bool operator!=(const Hash128& other) const { return !(*this == other); }
+
+        /** 32 lowercase hex characters; safe to use as a file name. */
+        std::string ToHex() const {
+            static constexpr char kDigits[] = "0123456789abcdef";
+            std::string out(32, '0');
+            for (int i = 0; i < 16; ++i) {
+                out[15 - i] = kDigits[(m_High >> (i * 4)) & 0xF];
+                out[31 - i] = kDigits[(m_Low >> (i * 4)) & 0xF];
+            }
+            return out;
+        }
+    };
+
+    namespace Detail {
+        inline std::uint64_t Rotl64(std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+        inline std::uint64_t Fmix64(std::uint64_t k) {
+            k ^= k >> 33;
+            k *= 0xff51afd7ed558ccdULL;
+            k ^= k >> 33;
+            k *= 0xc4ceb9fe1a85ec53ULL;
+            k ^= k >> 33;
+            return k;
+        }
+    } // namespace Detail
+
+    /** Non-cryptographic 128-bit hash (MurmurHash3 x64_128). Stable across runs and platforms of the same endianness. */
+    inline Hash128 HashBytes128(const void* data, std::size_t size, std::uint64_t seed = 0) {
+        using Detail::Rotl64;
+        using Detail::Fmix64;
+
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        const std::size_t blockCount = size / 16;
+
+        std::uint64_t h1 = seed;
+        std::uint64_t h2 = seed;
+        constexpr std::uint64_t c1 = 0x87c37b91114253d5ULL;
+        constexpr std::uint64_t c2 = 0x4cf5ad432745937fULL;
+
+        for (std::size_t i = 0; i < blockCount; ++i) {
+            std::uint64_t k1, k2;
+            std::memcpy(&k1, bytes + i * 16, 8);
+            std::memcpy(&k2, bytes + i * 16 + 8, 8);
+
+            k1 *= c1; k1 = Rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+            h1 = Rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+            k2 *= c2; k2 = Rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+            h2 = Rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+        }
+
+        const std::uint8_t* tail = bytes + blockCount * 16;
+        std::uint64_t k1 = 0;
+        std::uint64_t k2 = 0;
+        switch (size & 15) {
+        case 15: k2 ^= std::uint64_t(tail[14]) << 48; [[fallthrough]];
+        case 14: k2 ^= std::uint64_t(tail[13]) << 40; [[fallthrough]];
+        case 13: k2 ^= std::uint64_t(tail[12]) << 32; [[fallthrough]];
+        case 12: k2 ^= std::uint64_t(tail[11]) << 24; [[fallthrough]];
+        case 11: k2 ^= std::uint64_t(tail[10]) << 16; [[fallthrough]];
+        case 10: k2 ^= std::uint64_t(tail[9]) << 8;   [[fallthrough]];
+        case 9:  k2 ^= std::uint64_t(tail[8]);
+                 k2 *= c2; k2 = Rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+                 [[fallthrough]];
+        case 8:  k1 ^= std::uint64_t(tail[7]) << 56;  [[fallthrough]];
+        case 7:  k1 ^= std::uint64_t(tail[6]) << 48;  [[fallthrough]];
+        case 6:  k1 ^= std::uint64_t(tail[5]) << 40;  [[fallthrough]];
+        case 5:  k1 ^= std::uint64_t(tail[4]) << 32;  [[fallthrough]];
+        case 4:  k1 ^= std::uint64_t(tail[3]) << 24;  [[fallthrough]];
+        case 3:  k1 ^= std::uint64_t(tail[2]) << 16;  [[fallthrough]];
+        case 2:  k1 ^= std::uint64_t(tail[1]) << 8;   [[fallthrough]];
+        case 1:  k1 ^= std::uint64_t(tail[0]);
+                 k1 *= c1; k1 = Rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+                 break;
+        default: break;
+        }
+
+        h1 ^= size; h2 ^= size;
+        h1 += h2; h2 += h1;
+        h1 = Fmix64(h1); h2 = Fmix64(h2);
+        h1 += h2; h2 += h1;
+
+        return Hash128{ h1, h2 };
+    }
+
+    inline Hash128 HashString128(std::string_view s, std::uint64_t seed = 0) {
+        return HashBytes128(s.data(), s.size(), seed);
+    }
+
+} // namespace Nova::Core
+
+#endif // HASH_H
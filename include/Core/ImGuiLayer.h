@@ -17,6 +17,23 @@
 
 namespace Nova::Core {
 
+    /**
+     * Deep copy of a frame's ImDrawData. ImGui reuses its draw lists on the next NewFrame(), so the render
+     * thread records from a snapshot while the main thread builds the following frame.
+     */
+    struct NV_API ImGuiDrawSnapshot {
+        ImGuiDrawSnapshot() = default;
+        ~ImGuiDrawSnapshot() { Clear(); }
+        ImGuiDrawSnapshot(const ImGuiDrawSnapshot&) = delete;
+        ImGuiDrawSnapshot& operator=(const ImGuiDrawSnapshot&) = delete;
+
+        void Capture(const ImDrawData* drawData);
+        void Clear();
+        bool IsValid() const { return m_DrawData.Valid; }
+
+        ImDrawData m_DrawData; // owns its CmdLists
+    };
+
     class NV_API ImGuiLayer : public Layer {
     public:
         ImGuiLayer(Window& window, GraphicsAPI api);
@@ -29,6 +46,11 @@ namespace Nova::Core {
         void Begin();
         void End();
 
+        // End() split across threads (Vulkan only): EndDeferred builds the draw data on the main thread,
+        // RenderSnapshot records it on the render thread. Secondary viewports are not rendered in this mode.
+        void EndDeferred(ImGuiDrawSnapshot& out);
+        void RenderSnapshot(ImGuiDrawSnapshot& snapshot);
+
         void BlockEvents(bool block) { m_BlockEvents = block; }
 
         void ProcessSDLEvent(const SDL_Event& e);
@@ -0,0 +1,40 @@
+#ifndef INTERNEDSTRING_H
+#define INTERNEDSTRING_H
+
+#include <string>
+#include <string_view>
+
+#include "Api.h"
+
+namespace Nova::Core {
+
+    /**
+     * Immutable string stored once in a process-wide pool. Copies are a pointer copy and equality is a
+     * pointer compare, so thousands of entities named "Particle" share one allocation.
+     *
+     * Pooled strings are never freed: intern names and identifiers, not per-frame or per-entity text.
+     * Interning is thread-safe.
+     */
+    class NV_API InternedString {
+    public:
+        InternedString() = default;
+        InternedString(std::string_view value);
+        InternedString(const char* value) : InternedString(std::string_view(value ? value : "")) {}
+        InternedString(const std::string& value) : InternedString(std::string_view(value)) {}
+
+        const std::string& Str() const;
+        const char* c_str() const { return Str().c_str(); }
+        bool empty() const { return m_String == nullptr; }
+
+        operator const std::string&() const { return Str(); }
+
+        bool operator==(const InternedString& other) const { return m_String == other.m_String; }
+        bool operator!=(const InternedString& other) const { return m_String != other.m_String; }
+
+    private:
+        const std::string* m_String = nullptr; // nullptr is the empty string
+    };
+
+} // namespace Nova::Core
+
+#endif // INTERNEDSTRING_H
@@ -0,0 +1,112 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Api.h"
+
+namespace Nova::Core {
+
+    namespace Detail {
+        struct Job;
+        struct JobCounterAccess;
+    }
+
+    /**
+     * Number of unfinished jobs tagged with it (JobOptions::m_Counter). Wait on it to join them, or name it as
+     * another job's dependency (JobOptions::m_DependsOn).
+     *
+     * A counter may be reused once it is done. Only destroy it after JobSystem::Wait() returned on it: the
+     * thread finishing the last job may still be inside it when IsDone() first turns true.
+     */
+    class NV_API JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend struct Detail::JobCounterAccess;
+
+        std::atomic<uint32_t> m_Pending{ 0 };
+        std::mutex m_Mutex;                        // guards m_Waiting and the final decrement
+        std::vector<Detail::Job*> m_Waiting;       // jobs held back until this counter is done
+    };
+
+    struct JobOptions {
+        const char* m_Name = nullptr;        // static string; see JobSystem::GetCurrentJobName()
+        JobCounter* m_Counter = nullptr;     // incremented by Run(), decremented once the job has run
+        JobCounter* m_DependsOn = nullptr;   // the job is queued only once this counter is done
+        bool m_MainThread = false;           // run only on the main thread, from RunMainThreadJobs()
+    };
+
+    struct JobSystemSettings {
+        uint32_t m_WorkerCount = 0;  // 0: one per hardware thread, minus the main thread
+        bool m_PinThreads = false;   // pin worker i to logical core i + 1, leaving core 0 to the main thread
+    };
+
+    /**
+     * Shared work-stealing pool for engine and game work. Every worker owns a Chase-Lev deque: jobs submitted
+     * from a worker go to its own deque, jobs from any other thread go to a shared queue, and idle workers
+     * steal from each other. Waiting never blocks a thread that could help: Wait() runs queued jobs until its
+     * counter is done, so jobs may wait on jobs they spawn.
+     *
+     * Jobs must not block on anything but Wait() for long (file I/O is fine, spinning on another job is not).
+     */
+    class NV_API JobSystem {
+    public:
+        // Starts the workers; the calling thread becomes the main thread. Optional, the first Run() or
+        // ParallelFor() starts with default settings; no-op while running.
+        static void Initialize(const JobSystemSettings& settings = {});
+        // Runs every queued job to completion (main-thread ones on the caller), then joins the workers.
+        // Nothing may submit concurrently.
+        static void Shutdown();
+
+        static void Run(std::function<void()> job, const JobOptions& options = {});
+
+        // Runs other jobs on the calling thread until `counter` is done. Never runs m_MainThread jobs, so the
+        // main thread must not wait on a counter that one of them decrements.
+        static void Wait(JobCounter& counter);
+
+        // Main thread, once per frame: runs the m_MainThread jobs queued so far.
+        static void RunMainThreadJobs();
+
+        // Calls fn(begin, end) over [0, count) in chunks of `grain`, on the caller and the workers; returns
+        // when every chunk is done. A single chunk runs inline. The caller only ever runs chunks of this range.
+        static void ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn,
+            const char* name = nullptr);
+
+        // ParallelFor over an EnTT view: calls fn(entity) for every entity of the view. Splits the view's
+        // leading storage, so fn must only touch components of its own entity.
+        template<typename View, typename Fn>
+        static void ParallelForEach(const View& view, size_t grain, Fn&& fn, const char* name = nullptr) {
+            const auto* leading = view.handle();
+            if (!leading)
+                return;
+            const auto* entities = leading->data();
+            ParallelFor(leading->size(), grain, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (view.contains(entities[i]))
+                        fn(entities[i]);
+                }
+            }, name);
+        }
+
+        static uint32_t GetWorkerCount();
+        static bool IsMainThread();
+        // Name of the job running on this thread (null outside jobs or for unnamed ones), for profiler scopes.
+        static const char* GetCurrentJobName();
+        // Names the calling thread for debuggers and profilers (truncated to 15 characters on Linux).
+        static void SetCurrentThreadName(const char* name);
+    };
+
+} // namespace Nova::Core
+
+#endif // JOBSYSTEM_H
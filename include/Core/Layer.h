@@ -10,6 +10,8 @@ using namespace Nova::Core::Events;
 
 namespace Nova::Core {
 
+    class RenderFrame;
+
     class NV_API Layer {
     public:
         Layer(const std::string& name = "Layer") : m_DebugName(name) {}
@@ -23,6 +25,8 @@ namespace Nova::Core {
 
         virtual void OnEvent(Event& event) {}
         virtual void OnUpdate(float deltaTime) {}
+        // Main thread, after every OnUpdate: copy what rendering this frame needs into `frame`.
+        virtual void OnExtract(RenderFrame& frame) {}
         virtual void OnBegin() {}
         virtual void OnRender() {}
         virtual void OnEnd() {}
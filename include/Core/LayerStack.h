@@ -59,6 +59,7 @@ namespace Nova::Core {
 		std::vector<Layer*>::const_reverse_iterator rend() const { return m_Layers.rend(); }
 
         void ProcessPendingTransitions();
+        bool HasPendingTransitions() const { return !m_PendingTransitions.empty(); }
     
     private:
         std::vector<Layer*> m_Layers;
@@ -0,0 +1,41 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+#include "Api.h"
+
+namespace Nova::Core {
+
+    /** Read-only memory mapping of a whole file. The data stays valid until Close() or destruction. */
+    class NV_API MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        const uint8_t* GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+
+        // Reads one byte per page so later accesses do not fault; meant for loader threads.
+        void Prefault() const;
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        void* m_Handle = nullptr; // platform mapping object, if any
+    };
+
+} // namespace Nova::Core
+
+#endif // MAPPEDFILE_H
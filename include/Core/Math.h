@@ -0,0 +1,31 @@
+#ifndef MATH_H
+#define MATH_H
+
+#include <glm/glm.hpp>
+
+namespace Nova::Core {
+
+    /**
+     * Normal matrix for `model`, stored in the upper 3x3 of a mat4 (std140-friendly).
+     * Rotation + uniform scale keeps the model 3x3 as-is (shaders renormalize);
+     * only non-uniform scale or shear pays for the inverse-transpose.
+     */
+    inline glm::mat4 ComputeNormalMatrix(const glm::mat4& model) {
+        const glm::mat3 m(model);
+        const float sx = glm::dot(m[0], m[0]);
+        const float sy = glm::dot(m[1], m[1]);
+        const float sz = glm::dot(m[2], m[2]);
+        const float eps = 1e-5f * glm::max(sx, glm::max(sy, sz));
+
+        const bool uniformScale = glm::abs(sx - sy) <= eps && glm::abs(sx - sz) <= eps;
+        const bool orthogonal = glm::abs(glm::dot(m[0], m[1])) <= eps &&
+            glm::abs(glm::dot(m[0], m[2])) <= eps && glm::abs(glm::dot(m[1], m[2])) <= eps;
+
+        if (uniformScale && orthogonal)
+            return glm::mat4(m);
+        return glm::mat4(glm::transpose(glm::inverse(m)));
+    }
+
+} // namespace Nova::Core
+
+#endif // MATH_H
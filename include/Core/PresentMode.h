@@ -0,0 +1,16 @@
+#ifndef PRESENTMODE_H
+#define PRESENTMODE_H
+
+namespace Nova::Core {
+    // Presentation policy requested by the application. Backends fall back to the
+    // closest supported mode (FIFO is always available).
+    enum class PresentMode {
+        Auto = 0,       // derived from WindowDesc::m_VSync (Fifo when on, Mailbox when off)
+        Fifo,           // vsync, no tearing, highest latency
+        FifoRelaxed,    // vsync, but tears instead of waiting when a frame is late
+        Mailbox,        // no tearing, newest frame replaces the queued one
+        Immediate       // no vsync, tearing possible, lowest latency
+    };
+} // namespace Nova::Core
+
+#endif // PRESENTMODE_H
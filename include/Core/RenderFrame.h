@@ -0,0 +1,47 @@
+#ifndef RENDERFRAME_H
+#define RENDERFRAME_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Api.h"
+#include "Core/ImGuiLayer.h"
+#include "Renderer/Graphics/RenderScene.h"
+
+namespace Nova::Core {
+
+    class Layer;
+
+    /**
+     * Everything the render side of one frame consumes, written on the main thread in Layer::OnExtract().
+     *
+     * With the render thread enabled (Application::SetRenderThreadEnabled), frame N is rendered while the main
+     * thread simulates N+1, so the render hooks (OnBegin/OnRender/OnEnd) must read this frame
+     * (Application::GetRenderFrame) instead of live scene state, and main-thread code must reach the renderer
+     * through Enqueue(). Without it, the same frame is rendered right after extraction on the main thread.
+     */
+    class NV_API RenderFrame {
+    public:
+        // Runs on the render side, in order, after OnBegin and before OnRender.
+        void Enqueue(std::function<void()> command) { m_Commands.push_back(std::move(command)); }
+        void ExecuteCommands();
+
+        // Keeps allocations (proxy arrays, command vector) for the next frame that reuses this one.
+        void Reset();
+
+        uint64_t m_Index = 0;
+        float m_DeltaTime = 0.0f;
+        Renderer::Graphics::RenderScene m_Scene;
+
+    private:
+        friend class Application;
+
+        std::vector<std::function<void()>> m_Commands;
+        std::vector<Layer*> m_Layers;  // layer stack at extraction time
+        ImGuiDrawSnapshot m_ImGui;     // render-thread mode only
+    };
+
+} // namespace Nova::Core
+
+#endif // RENDERFRAME_H
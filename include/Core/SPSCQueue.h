@@ -0,0 +1,98 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Nova::Core {
+
+    /**
+     * Bounded single-producer / single-consumer ring buffer. TryPush/TryPop are lock-free (one acquire load
+     * and one release store each); Push/Pop block on an atomic wait when the queue is full/empty.
+     *
+     * Exactly one thread may push and exactly one thread may pop. After Close(), Push fails and Pop drains
+     * what is left, then fails.
+     */
+    template<typename T, std::size_t Capacity>
+    class SPSCQueue {
+        static_assert(Capacity > 0, "SPSCQueue needs room for at least one element");
+
+    public:
+        // Moves from `value` only on success, so a failed push can be retried with the same value.
+        bool TryPush(T& value) {
+            const std::size_t tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail - m_Head.load(std::memory_order_acquire) == Capacity)
+                return false;
+            m_Slots[tail % Capacity] = std::move(value);
+            m_Tail.store(tail + 1, std::memory_order_release);
+            m_Pushed.fetch_add(1, std::memory_order_release);
+            m_Pushed.notify_one();
+            return true;
+        }
+
+        bool TryPush(T&& value) { return TryPush(value); }
+
+        bool TryPop(T& out) {
+            const std::size_t head = m_Head.load(std::memory_order_relaxed);
+            if (head == m_Tail.load(std::memory_order_acquire))
+                return false;
+            out = std::move(m_Slots[head % Capacity]);
+            m_Head.store(head + 1, std::memory_order_release);
+            m_Popped.fetch_add(1, std::memory_order_release);
+            m_Popped.notify_one();
+            return true;
+        }
+
+        // Blocks while full; false once closed.
+        bool Push(T value) {
+            for (;;) {
+                // Read the signal before re-checking, so a pop in between is never missed.
+                const uint32_t signal = m_Popped.load(std::memory_order_acquire);
+                if (m_Closed.load(std::memory_order_acquire))
+                    return false;
+                if (TryPush(value))
+                    return true;
+                m_Popped.wait(signal, std::memory_order_acquire);
+            }
+        }
+
+        // Blocks while empty; false once closed and drained.
+        bool Pop(T& out) {
+            for (;;) {
+                const uint32_t signal = m_Pushed.load(std::memory_order_acquire);
+                if (TryPop(out))
+                    return true;
+                if (m_Closed.load(std::memory_order_acquire))
+                    return false;
+                m_Pushed.wait(signal, std::memory_order_acquire);
+            }
+        }
+
+        void Close() {
+            m_Closed.store(true, std::memory_order_release);
+            // Bump both signals so blocked Push/Pop calls wake up and see the flag.
+            m_Pushed.fetch_add(1, std::memory_order_release);
+            m_Pushed.notify_all();
+            m_Popped.fetch_add(1, std::memory_order_release);
+            m_Popped.notify_all();
+        }
+
+        // Only meaningful from the consumer (empty) or the producer (full).
+        bool IsEmpty() const { return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire); }
+
+    private:
+        // Producer and consumer indices on separate cache lines; they only grow (index = counter % Capacity).
+        alignas(64) std::atomic<std::size_t> m_Head{ 0 };
+        alignas(64) std::atomic<std::size_t> m_Tail{ 0 };
+        alignas(64) std::atomic<uint32_t> m_Pushed{ 0 };
+        std::atomic<uint32_t> m_Popped{ 0 };
+        std::atomic<bool> m_Closed{ false };
+        std::array<T, Capacity> m_Slots{};
+    };
+
+} // namespace Nova::Core
+
+#endif // SPSCQUEUE_H
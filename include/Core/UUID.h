@@ -1,25 +1,70 @@
 #ifndef UUID_H
 #define UUID_H
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <random>
-#include <limits>
+
+#include "Core/Hash.h"
 
 namespace Nova::Core {
 
-    using UUID = std::uint32_t;
+    // 0 is never generated and means "no id".
+    using UUID = std::uint64_t;
+
+    namespace Detail {
+        inline std::uint64_t SplitMix64(std::uint64_t& state) {
+            std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        /** xoroshiro128++: small, fast, and 2^128 - 1 period. Not cryptographic. */
+        class Xoroshiro128 {
+        public:
+            explicit Xoroshiro128(std::uint64_t seed) {
+                m_S0 = SplitMix64(seed);
+                m_S1 = SplitMix64(seed); // splitmix never yields two zero words in a row
+            }
+
+            std::uint64_t Next() {
+                const std::uint64_t s0 = m_S0;
+                std::uint64_t s1 = m_S1;
+                const std::uint64_t result = Rotl64(s0 + s1, 17) + s0;
+                s1 ^= s0;
+                m_S0 = Rotl64(s0, 49) ^ s1 ^ (s1 << 21);
+                m_S1 = Rotl64(s1, 28);
+                return result;
+            }
+
+        private:
+            std::uint64_t m_S0 = 0;
+            std::uint64_t m_S1 = 0;
+        };
+
+        // One generator per thread: no locking, and threads never share a sequence.
+        inline Xoroshiro128& UUIDGenerator() {
+            static std::atomic<std::uint64_t> s_ThreadCounter{ 0 };
+            thread_local Xoroshiro128 t_Generator([] {
+                std::random_device rd;
+                const std::uint64_t entropy = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+                const std::uint64_t time = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+                return Fmix64(entropy ^ Fmix64(time) ^ Fmix64(s_ThreadCounter.fetch_add(1, std::memory_order_relaxed) + 1));
+            }());
+            return t_Generator;
+        }
+    } // namespace Detail
 
+    /** Random 64-bit id; thread-safe. Collisions stay negligible (birthday bound ~4 billion ids). */
     inline UUID GenerateUUID() {
-        static std::random_device rd;
-        static std::mt19937 engine(rd());
-        static std::uniform_int_distribution<std::uint32_t> dis(
-            std::numeric_limits<std::uint32_t>::min(),
-            std::numeric_limits<std::uint32_t>::max()
-        );
-
-        return dis(engine);
+        UUID id = 0;
+        while (id == 0)
+            id = Detail::UUIDGenerator().Next();
+        return id;
     }
 
 } // namespace Nova::Core
 
-#endif // UUID_H
\ No newline at end of file
+#endif // UUID_H
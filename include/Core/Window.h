@@ -1,11 +1,13 @@
 #ifndef WINDOW_H
 #define WINDOW_H
 
+#include <cstdint>
 #include <functional>
 #include <SDL3/SDL.h>
 
 #include "Api.h"
 #include "Core/GraphicsAPI.h"
+#include "Core/PresentMode.h"
 
 namespace Nova::Core::Events {
     class Event;
@@ -26,6 +28,14 @@ namespace Nova::Core {
             GraphicsAPI m_GraphicsAPI = GraphicsAPI::Vulkan;
             bool m_VSync        = true;
 
+            // Explicit present mode; Auto follows m_VSync.
+            PresentMode m_PresentMode = PresentMode::Auto;
+            // Wait for the previous frame to reach the display before starting the next one
+            // (VK_KHR_present_wait). Ignored when the device does not support it.
+            bool m_LowLatency   = false;
+            // Frame rate cap applied before input sampling, 0 = uncapped.
+            uint32_t m_MaxFrameRate = 0;
+
             using EventCallbackFn = std::function<void(Events::Event&)>;
             EventCallbackFn m_EventCallback;
         };
@@ -34,6 +44,17 @@ namespace Nova::Core {
         ~Window() { Destroy(); }
 
         void SetVSync(bool enabled);
+        bool IsVSync() const { return m_Desc.m_VSync; }
+
+        // Present policy, picked up by the renderer at the next frame boundary.
+        void SetPresentMode(PresentMode mode) { m_Desc.m_PresentMode = mode; }
+        PresentMode GetPresentMode() const;
+
+        void SetLowLatency(bool enabled) { m_Desc.m_LowLatency = enabled; }
+        bool IsLowLatency() const { return m_Desc.m_LowLatency; }
+
+        void SetMaxFrameRate(uint32_t fps) { m_Desc.m_MaxFrameRate = fps; }
+        uint32_t GetMaxFrameRate() const { return m_Desc.m_MaxFrameRate; }
         void SetTitle(const char* title);
 
         void GetWindowSize(int& width, int& height);
@@ -0,0 +1,88 @@
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nova::Core {
+
+    /**
+     * Bounded Chase-Lev deque of pointers (Le et al., "Correct and Efficient Work-Stealing for Weak Memory
+     * Models", 2013). The owning thread pushes and pops at the bottom (LIFO, cache-warm); any other thread
+     * steals from the top (FIFO, oldest and usually largest work first). Only the last element is contended.
+     *
+     * Exactly one thread may call Push/Pop. Push fails when full rather than growing, so no buffer is ever
+     * retired while a thief may still read it.
+     */
+    template<typename T, std::size_t Capacity>
+    class WorkStealingDeque {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "WorkStealingDeque capacity must be a power of two");
+
+    public:
+        // Owner only.
+        bool Push(T* item) {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_Top.load(std::memory_order_acquire);
+            if (bottom - top >= static_cast<int64_t>(Capacity))
+                return false;
+            m_Slots[bottom & kMask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Owner only; null when empty or when a thief took the last item.
+        T* Pop() {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = m_Slots[bottom & kMask].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // Last item: race the thieves for it.
+                if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    item = nullptr;
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // Any thread; null when empty or when another thread won the item.
+        T* Steal() {
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+                return nullptr;
+
+            T* item = m_Slots[top & kMask].load(std::memory_order_relaxed);
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return item;
+        }
+
+        // A hint only, unless called by the owner with no thieves around.
+        bool IsEmpty() const {
+            return m_Top.load(std::memory_order_acquire) >= m_Bottom.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr int64_t kMask = static_cast<int64_t>(Capacity) - 1;
+
+        // Thieves hammer m_Top, the owner m_Bottom: keep them on separate cache lines.
+        alignas(64) std::atomic<int64_t> m_Top{ 0 };
+        alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+        alignas(64) std::array<std::atomic<T*>, Capacity> m_Slots{};
+    };
+
+} // namespace Nova::Core
+
+#endif // WORKSTEALINGDEQUE_H
@@ -0,0 +1,103 @@
+#ifndef VK_BINDLESS_HEAP_H
+#define VK_BINDLESS_HEAP_H
+
+#include <vulkan/vulkan.h>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_ShaderUniforms.h"
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    class VK_DescriptorLayoutCache;
+
+    /**
+     * Global bindless descriptor heap: one descriptor set (RHI::kBindlessDescriptorSet) holding
+     * large arrays of sampled images and storage buffers, plus the fixed RHI::BindlessSampler
+     * samplers (see Bindless.slang). Resources are registered once and referenced by slot index
+     * from materials or push constants, so every pipeline binds the same set for the whole frame.
+     *
+     * The layout uses update-after-bind + partially-bound + update-unused-while-pending bindings:
+     * writing a slot never disturbs command buffers in flight, as long as they do not read it.
+     * Freed slots are therefore only recycled after `framesInFlight` further BeginFrame() calls.
+     * All methods are thread-safe.
+     */
+    class NV_API VK_BindlessHeap {
+    public:
+        VK_BindlessHeap() = default;
+        ~VK_BindlessHeap() { Destroy(); }
+
+        VK_BindlessHeap(const VK_BindlessHeap&) = delete;
+        VK_BindlessHeap& operator=(const VK_BindlessHeap&) = delete;
+
+        /** Array sizes are clamped to the device's update-after-bind limits. */
+        bool Create(VkDevice device, VK_DescriptorLayoutCache& layoutCache,
+            const VkPhysicalDeviceDescriptorIndexingProperties& limits,
+            uint32_t maxTextures, uint32_t maxBuffers, uint32_t framesInFlight);
+        void Destroy();
+
+        bool IsValid() const { return m_DescriptorSet != VK_NULL_HANDLE; }
+
+        /** RHI::kInvalidBindlessIndex when the heap is full or invalid. */
+        uint32_t RegisterTexture(VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        uint32_t RegisterBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+
+        /**
+         * The resource must stay alive until the frames in flight that may read the slot complete.
+         * Releasing a slot that is not live (already released, or never handed out) is rejected.
+         */
+        void ReleaseTexture(uint32_t index);
+        void ReleaseBuffer(uint32_t index);
+
+        /** Call once per frame, after waiting for the frame's fence; recycles retired slots. */
+        void BeginFrame();
+
+        VkDescriptorSetLayout GetSetLayout() const { return m_SetLayout; }
+        VkDescriptorSet GetDescriptorSet() const { return m_DescriptorSet; }
+
+        uint32_t GetTextureCapacity() const { return m_Textures.m_Capacity; }
+        uint32_t GetBufferCapacity() const { return m_Buffers.m_Capacity; }
+
+    private:
+        // Free-list over [0, m_Capacity); released slots wait out the frames in flight first.
+        struct SlotAllocator {
+            struct Retired {
+                uint32_t m_Index = 0;
+                uint64_t m_Frame = 0;
+            };
+
+            uint32_t m_Capacity = 0;
+            uint32_t m_Next = 0;              // slots >= m_Next were never handed out
+            std::vector<uint32_t> m_Free;
+            std::vector<Retired> m_Retired;
+            std::vector<bool> m_Live;         // per slot: handed out and not yet released
+
+            uint32_t Allocate();
+            bool Release(uint32_t index, uint64_t frame);
+            void Reclaim(uint64_t frame, uint32_t latency);
+            void Reset(uint32_t capacity);
+        };
+
+        void Write(RHI::BindlessBinding binding, uint32_t index, VkDescriptorType type,
+            const VkDescriptorImageInfo* imageInfo, const VkDescriptorBufferInfo* bufferInfo);
+
+        mutable std::mutex m_Mutex;
+
+        VkDevice m_Device = VK_NULL_HANDLE;
+        VkDescriptorPool m_Pool = VK_NULL_HANDLE;
+        VkDescriptorSetLayout m_SetLayout = VK_NULL_HANDLE; // owned by the layout cache
+        VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+        std::array<VkSampler, static_cast<size_t>(RHI::BindlessSampler::Count)> m_Samplers{};
+
+        SlotAllocator m_Textures;
+        SlotAllocator m_Buffers;
+        uint64_t m_Frame = 0;
+        uint32_t m_FramesInFlight = 1;
+    };
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
+
+#endif // VK_BINDLESS_HEAP_H
@@ -0,0 +1,45 @@
+#ifndef VK_BUFFER_H
+#define VK_BUFFER_H
+
+#include <vulkan/vulkan.h>
+#include <vector>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_Buffer.h"
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    /** VkBuffer + dedicated memory. Host-visible buffers stay mapped for their whole lifetime. */
+    class NV_API VK_Buffer final : public RHI::RHI_Buffer {
+    public:
+        VK_Buffer() = default;
+        ~VK_Buffer() override { Destroy(); }
+
+        VK_Buffer(const VK_Buffer&) = delete;
+        VK_Buffer& operator=(const VK_Buffer&) = delete;
+
+        /**
+         * queueFamilies: every family that touches the buffer. More than one distinct family
+         * selects concurrent sharing, so no ownership transfer is needed between graphics and compute.
+         */
+        bool Create(VkPhysicalDevice physicalDevice, VkDevice device,
+            const RHI::RHI_BufferDesc& desc, const std::vector<uint32_t>& queueFamilies);
+        void Destroy();
+
+        void* GetMappedData() const override { return m_Mapped; }
+        bool Write(const void* data, uint64_t size, uint64_t offset = 0) override;
+        uint64_t GetNativeHandle() const override { return reinterpret_cast<uint64_t>(m_Buffer); }
+
+        VkBuffer GetBuffer() const { return m_Buffer; }
+
+    private:
+        VkDevice       m_Device = VK_NULL_HANDLE;
+        VkBuffer       m_Buffer = VK_NULL_HANDLE;
+        VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+        void*          m_Mapped = nullptr;
+        bool           m_HostCoherent = true;
+    };
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
+
+#endif // VK_BUFFER_H
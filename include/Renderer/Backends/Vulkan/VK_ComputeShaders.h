@@ -0,0 +1,83 @@
+#ifndef VK_COMPUTE_SHADERS_H
+#define VK_COMPUTE_SHADERS_H
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_Shaders.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorAllocator.h"
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    class VK_BindlessHeap;
+    class VK_DescriptorAllocator;
+    class VK_DescriptorLayoutCache;
+
+    /**
+     * Compute pipeline created by VK_Renderer::CreateComputeShader().
+     * Owns its pipeline and the bindings of every reflected set index; every set
+     * (not only set 1) can be written through `Resources()`.
+     */
+    class NV_API VK_ComputeShaders final : public RHI::RHI_Shaders {
+    public:
+        VK_ComputeShaders() = default;
+        ~VK_ComputeShaders() override { Destroy(); }
+
+        VK_ComputeShaders(const VK_ComputeShaders&) = delete;
+        VK_ComputeShaders& operator=(const VK_ComputeShaders&) = delete;
+
+        /**
+         * Descriptor sets are transient, allocated from `transientDescriptors` when a dispatch is
+         * recorded after its bindings changed (or in a new frame); set and pipeline layouts come
+         * from `layoutCache`, which owns them. A reflected set 2 is the global bindless heap when
+         * `bindlessHeap` is valid (shaders including Bindless.slang).
+         */
+        bool Create(VkDevice device, VK_DescriptorAllocator& transientDescriptors, VK_DescriptorLayoutCache& layoutCache,
+            const VK_BindlessHeap* bindlessHeap, const std::vector<uint8_t>& spirv, const RHI::RHI_ProgramReflection& reflection,
+            const char* entryPoint = "main");
+        void Destroy();
+
+        /** Raw bytes pushed before each dispatch when the shader declares push constants. */
+        void SetPushConstants(const void* data, uint32_t size);
+
+        /** vkCmdBindPipeline (compute). apiContext: VkCommandBuffer. */
+        void Bind(void* apiContext = nullptr) override;
+        /** Bind descriptor sets and push constants. apiContext: VkCommandBuffer. */
+        void ApplyParameters(void* apiContext = nullptr) override;
+        void* GetNativeHandle() const override;
+
+        VkPipeline GetPipeline() const { return m_Pipeline; }
+        VkPipelineLayout GetPipelineLayout() const { return m_PipelineLayout; }
+        bool IsValid() const { return m_Pipeline != VK_NULL_HANDLE; }
+
+    private:
+        bool ApplyResourceBinding(const RHI::RHI_BindingInfo& info, const RHI::RHI_ResourceBinding& value) override;
+
+        VkDevice         m_Device = VK_NULL_HANDLE;
+        VK_DescriptorAllocator* m_TransientDescriptors = nullptr;
+        VkPipeline       m_Pipeline = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+
+        // Recorded Resources() values for one set; m_Set is the transient set they were last written to.
+        struct TransientSet {
+            std::vector<VK_DescriptorWrite> m_Writes;
+            VkDescriptorSet m_Set = VK_NULL_HANDLE;
+            uint64_t m_FrameSerial = 0;
+            bool m_HasBindings = false;
+            bool m_Dirty = false;
+        };
+
+        // Indexed by set number; empty sets get an empty layout and no descriptor set. Layouts are cached, not owned.
+        std::vector<VkDescriptorSetLayout> m_SetLayouts;
+        std::vector<TransientSet>          m_Sets;
+        VkDescriptorSet                    m_BindlessSet = VK_NULL_HANDLE; // shared heap set, not owned
+
+        std::vector<uint8_t> m_PushConstantData;
+        uint32_t             m_PushConstantSize = 0;
+    };
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
+
+#endif // VK_COMPUTE_SHADERS_H
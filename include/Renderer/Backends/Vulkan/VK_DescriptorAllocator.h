@@ -0,0 +1,84 @@
+#ifndef VK_DESCRIPTOR_ALLOCATOR_H
+#define VK_DESCRIPTOR_ALLOCATOR_H
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_ShaderResourceSet.h"
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    /** One recorded descriptor write; image or buffer info depending on m_Type. */
+    struct NV_API VK_DescriptorWrite {
+        uint32_t m_Binding = 0;
+        VkDescriptorType m_Type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        VkDescriptorBufferInfo m_BufferInfo{};
+        VkDescriptorImageInfo m_ImageInfo{};
+    };
+
+    /**
+     * Translate an RHI binding value (Resources().Set*) into a write for `binding`. Storage images
+     * default to the general layout, other images to shader-read-only. False if `value` does not fit.
+     */
+    NV_API bool MakeDescriptorWrite(uint32_t binding, VkDescriptorType type,
+        const RHI::RHI_ResourceBinding& value, VK_DescriptorWrite& out);
+
+    /** Replace the write for the same binding, or append. */
+    NV_API void StoreDescriptorWrite(std::vector<VK_DescriptorWrite>& writes, const VK_DescriptorWrite& write);
+
+    /** vkUpdateDescriptorSets for every recorded write into `set`. */
+    NV_API void ApplyDescriptorWrites(VkDevice device, VkDescriptorSet set, const std::vector<VK_DescriptorWrite>& writes);
+
+    /**
+     * Transient descriptor sets, valid for the frame they are allocated in.
+     *
+     * Each frame in flight owns a list of pools; BeginFrame(frameIndex), called once that frame's
+     * fence has signaled, resets them wholesale with vkResetDescriptorPool, so sets are never freed
+     * individually. When the current pool runs out another one is taken (recycled or newly created,
+     * each new pool twice the size of the previous one), so allocation does not fail on a busy frame.
+     *
+     * Callers re-allocate when GetFrameSerial() differs from the serial their set was allocated under.
+     */
+    class NV_API VK_DescriptorAllocator {
+    public:
+        VK_DescriptorAllocator() = default;
+        ~VK_DescriptorAllocator() { Destroy(); }
+
+        VK_DescriptorAllocator(const VK_DescriptorAllocator&) = delete;
+        VK_DescriptorAllocator& operator=(const VK_DescriptorAllocator&) = delete;
+
+        bool Create(VkDevice device, uint32_t framesInFlight, uint32_t initialSetsPerPool = 64);
+        void Destroy();
+
+        /** Start recording frame `frameIndex`: its previous sets are no longer in use. */
+        void BeginFrame(uint32_t frameIndex);
+
+        /** VK_NULL_HANDLE only if a new pool cannot be created. */
+        VkDescriptorSet Allocate(VkDescriptorSetLayout layout);
+
+        uint64_t GetFrameSerial() const;
+        size_t GetPoolCount() const;
+
+    private:
+        VkDescriptorPool AcquirePool();
+
+        struct Frame {
+            std::vector<VkDescriptorPool> m_Pools; // last one is the one being allocated from
+        };
+
+        mutable std::mutex m_Mutex;
+        VkDevice m_Device = VK_NULL_HANDLE;
+        std::vector<Frame> m_Frames;
+        std::vector<VkDescriptorPool> m_FreePools;  // reset, owned by no frame
+        std::vector<VkDescriptorPool> m_AllPools;
+        uint32_t m_FrameIndex = 0;
+        uint32_t m_NextPoolSets = 0;
+        uint64_t m_FrameSerial = 1;
+    };
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
+
+#endif // VK_DESCRIPTOR_ALLOCATOR_H
@@ -0,0 +1,85 @@
+#ifndef VK_DESCRIPTOR_LAYOUT_CACHE_H
+#define VK_DESCRIPTOR_LAYOUT_CACHE_H
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_ShaderReflection.h"
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    NV_API VkShaderStageFlags ToVkStageFlags(RHI::RHI_ShaderStageMask mask);
+    /** VK_DESCRIPTOR_TYPE_MAX_ENUM for kinds that have no descriptor. */
+    NV_API VkDescriptorType ToVkDescriptorType(const RHI::RHI_BindingInfo& binding);
+
+    /**
+     * Device-lifetime cache of descriptor set layouts and pipeline layouts, keyed by content.
+     * Binding lists are normalized (sorted by binding number) before lookup, so programs whose
+     * user sets reflect the same bindings share a VkDescriptorSetLayout, and pipelines with the
+     * same set layouts + push constants share one VkPipelineLayout. Set 0 is not reflected: it
+     * always uses GetEngineSetLayout().
+     *
+     * Returned handles are owned by the cache and destroyed in Destroy(); callers never destroy them.
+     */
+    class NV_API VK_DescriptorLayoutCache {
+    public:
+        VK_DescriptorLayoutCache() = default;
+        ~VK_DescriptorLayoutCache() { Destroy(); }
+
+        VK_DescriptorLayoutCache(const VK_DescriptorLayoutCache&) = delete;
+        VK_DescriptorLayoutCache& operator=(const VK_DescriptorLayoutCache&) = delete;
+
+        void Create(VkDevice device);
+        void Destroy();
+
+        /**
+         * `bindingFlags`, if not empty, holds one VkDescriptorBindingFlags per entry of `bindings`
+         * (same order) and is chained as VkDescriptorSetLayoutBindingFlagsCreateInfo.
+         */
+        VkDescriptorSetLayout GetSetLayout(std::vector<VkDescriptorSetLayoutBinding> bindings,
+            VkDescriptorSetLayoutCreateFlags flags = 0,
+            const std::vector<VkDescriptorBindingFlags>& bindingFlags = {});
+
+        /**
+         * Layout of reflected set `setIndex`. VK_NULL_HANDLE when the set has no bindings, except
+         * for the user set, which always gets at least a uniform buffer at binding 0 (Slang
+         * reflection can miss it, and the pipeline layout must still match the SPIR-V).
+         */
+        VkDescriptorSetLayout GetSetLayout(const RHI::RHI_ProgramReflection& reflection, uint32_t setIndex);
+
+        /**
+         * The one engine set (set 0) layout every graphics pipeline uses: all EngineResourceSlot
+         * bindings, visible to all graphics stages, Mvp and Material as dynamic uniform buffers.
+         * It does not depend on which bindings a shader reads, so the engine set stays bound and
+         * valid across every pipeline switch.
+         */
+        VkDescriptorSetLayout GetEngineSetLayout();
+        /** False (and logs) when the program declares something in set 0 the engine layout does not have. */
+        static bool IsEngineSetCompatible(const RHI::RHI_ProgramReflection& reflection, const char* who);
+
+        VkPipelineLayout GetPipelineLayout(const std::vector<VkDescriptorSetLayout>& setLayouts,
+            const std::vector<VkPushConstantRange>& pushConstantRanges);
+
+        size_t GetSetLayoutCount() const;
+        size_t GetPipelineLayoutCount() const;
+
+    private:
+        // Flattened description; equal keys describe identical layouts.
+        using Key = std::vector<uint64_t>;
+        struct KeyHash {
+            size_t operator()(const Key& key) const;
+        };
+
+        mutable std::mutex m_Mutex;
+        VkDevice m_Device = VK_NULL_HANDLE;
+        std::unordered_map<Key, VkDescriptorSetLayout, KeyHash> m_SetLayouts;
+        std::unordered_map<Key, VkPipelineLayout, KeyHash> m_PipelineLayouts;
+    };
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
+
+#endif // VK_DESCRIPTOR_LAYOUT_CACHE_H
@@ -5,10 +5,12 @@
 #include <vector>
 #include <optional>
 #include <set>
+#include <string>
 
 #include "Api.h"
 #include "Core/Log.h"
 #include "Renderer/Backends/Vulkan/VK_Common.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorLayoutCache.h"
 #include "Renderer/Backends/Vulkan/VK_Extensions.h"
 
 namespace Nova::Core::Renderer::Backends::Vulkan {
@@ -18,7 +20,10 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         VK_Device() = default;
         ~VK_Device() = default;
 
-        bool Create(VkInstance instance, VkSurfaceKHR surface, const std::vector<const char*>& requiredDeviceExtensions);
+        // Optional extensions are enabled only when the selected GPU exposes them.
+        bool Create(VkInstance instance, VkSurfaceKHR surface,
+            const std::vector<const char*>& requiredDeviceExtensions,
+            const std::vector<const char*>& optionalDeviceExtensions = {});
         void Destroy();
 
         VkPhysicalDevice GetPhysicalDevice() const { return m_PhysicalDevice; }
@@ -38,6 +43,22 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         const VkPhysicalDeviceFeatures&         GetFeatures() const { return m_Features; }
         const VkPhysicalDeviceMemoryProperties& GetMemoryProperties() const { return m_MemoryProperties; }
 
+        bool IsExtensionEnabled(const char* extName) const;
+
+        // VK_KHR_present_id + VK_KHR_present_wait extensions and features are enabled.
+        bool IsPresentWaitSupported() const { return m_PresentWaitSupported; }
+
+        // Descriptor indexing features used by the bindless heap (update-after-bind, partially bound,
+        // runtime arrays, non-uniform indexing) are enabled; limits are valid only when true.
+        bool IsDescriptorIndexingSupported() const { return m_DescriptorIndexingSupported; }
+        const VkPhysicalDeviceDescriptorIndexingProperties& GetDescriptorIndexingProperties() const { return m_DescriptorIndexingProperties; }
+
+        // Vulkan 1.2 timelineSemaphore feature is enabled.
+        bool IsTimelineSemaphoreSupported() const { return m_TimelineSemaphoreSupported; }
+
+        // Shared descriptor set / pipeline layouts; lives as long as the logical device.
+        VK_DescriptorLayoutCache& GetLayoutCache() { return m_LayoutCache; }
+
         struct NV_API VK_QueueFamily {
             uint32_t   index = UINT32_MAX;
             VkQueueFlags flags = 0; // GRAPHICS/COMPUTE/TRANSFER/SPARSE + video/optical if available
@@ -80,7 +101,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         
         bool HasSwapChainSupport(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface) const;
         bool PickPhysicalDevice(VkInstance instance, VkSurfaceKHR surface, const std::vector<const char*>& requiredDeviceExtensions);
-        bool CreateLogicalDevice(const std::vector<const char*>& requiredDeviceExtensions);
+        bool CreateLogicalDevice(const std::vector<const char*>& requiredDeviceExtensions,
+            const std::vector<const char*>& optionalDeviceExtensions);
 
         std::vector<VK_QueueFamily> QueryQueueFamilies(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface) const;
 
@@ -104,6 +126,14 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         VkPhysicalDeviceProperties       m_Properties{};
         VkPhysicalDeviceFeatures         m_Features{};
         VkPhysicalDeviceMemoryProperties m_MemoryProperties{};
+
+        std::vector<std::string> m_EnabledExtensions;
+        bool m_PresentWaitSupported = false;
+        bool m_DescriptorIndexingSupported = false;
+        VkPhysicalDeviceDescriptorIndexingProperties m_DescriptorIndexingProperties{};
+        bool m_TimelineSemaphoreSupported = false;
+
+        VK_DescriptorLayoutCache m_LayoutCache;
     };
 
 } // namespace Nova::Core::Renderer::Backends::Vulkan
@@ -0,0 +1,49 @@
+#ifndef VK_IMAGE_H
+#define VK_IMAGE_H
+
+#include <vulkan/vulkan.h>
+#include <vector>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_Image.h"
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    /** 2D storage image kept in VK_IMAGE_LAYOUT_GENERAL (compute writes, graphics samples). */
+    class NV_API VK_StorageImage final : public RHI::RHI_Image {
+    public:
+        VK_StorageImage() = default;
+        ~VK_StorageImage() override { Destroy(); }
+
+        VK_StorageImage(const VK_StorageImage&) = delete;
+        VK_StorageImage& operator=(const VK_StorageImage&) = delete;
+
+        /**
+         * The initial layout transition is recorded on `commandPool` and submitted on `queue`
+         * (upload path, waits idle). queueFamilies behaves like VK_Buffer::Create().
+         */
+        bool Create(VkPhysicalDevice physicalDevice, VkDevice device,
+            VkCommandPool commandPool, VkQueue queue,
+            const RHI::RHI_ImageDesc& desc, const std::vector<uint32_t>& queueFamilies);
+        void Destroy();
+
+        uint64_t GetNativeHandle() const override { return reinterpret_cast<uint64_t>(m_Image); }
+        uint64_t GetViewHandle() const override { return reinterpret_cast<uint64_t>(m_ImageView); }
+
+        VkImage GetImage() const { return m_Image; }
+        VkImageView GetImageView() const { return m_ImageView; }
+        VkFormat GetFormat() const { return m_Format; }
+
+    private:
+        bool TransitionToGeneral(VkCommandPool commandPool, VkQueue queue);
+
+        VkDevice       m_Device = VK_NULL_HANDLE;
+        VkImage        m_Image = VK_NULL_HANDLE;
+        VkImageView    m_ImageView = VK_NULL_HANDLE;
+        VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+        VkFormat       m_Format = VK_FORMAT_UNDEFINED;
+    };
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
+
+#endif // VK_IMAGE_H
@@ -1,6 +1,7 @@
 #ifndef VK_RENDERER_H
 #define VK_RENDERER_H
 
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -14,9 +15,14 @@
 #include "Renderer/Backends/Vulkan/VK_Common.h"
 #include "Renderer/Backends/Vulkan/VK_Instance.h"
 #include "Renderer/Backends/Vulkan/VK_Device.h"
+#include "Renderer/Backends/Vulkan/VK_BindlessHeap.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorAllocator.h"
 #include "Renderer/Backends/Vulkan/VK_Swapchain.h"
 #include "Renderer/Backends/Vulkan/VK_Shaders.h"
 #include "Renderer/Backends/Vulkan/VK_Mesh.h"
+#include "Renderer/Backends/Vulkan/VK_Buffer.h"
+#include "Renderer/Backends/Vulkan/VK_Image.h"
+#include "Renderer/Backends/Vulkan/VK_ComputeShaders.h"
 
 #include "Api.h"
 #include <memory>
@@ -40,6 +46,7 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
         void BeginScene(const glm::mat4& view, const glm::mat4& proj) override;
         void SetModelMatrix(const glm::mat4& model) override;
+        void SetModelMatrix(const glm::mat4& model, const glm::mat4& normalMatrix) override;
 
         void Draw(const RHI::RHI_DrawCommand& cmd) override;
         void DrawIndexed(const RHI::RHI_DrawIndexedCommand& cmd) override;
@@ -55,6 +62,21 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         void DestroyFullscreenShader(RHI::RHI_Shaders* shader) override;
         void DrawFullscreen(RHI::RHI_Shaders* shader) override;
 
+        RHI::RHI_Shaders* CreateComputeShader(const RHI::RHI_ShaderCompileInput& computeIn) override;
+        void DestroyComputeShader(RHI::RHI_Shaders* shader) override;
+        void Dispatch(RHI::RHI_Shaders* shader, uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1,
+            RHI::RHI_QueueType queue = RHI::RHI_QueueType::Graphics) override;
+        void DispatchIndirect(RHI::RHI_Shaders* shader, const RHI::RHI_Buffer& args, uint64_t offset = 0,
+            RHI::RHI_QueueType queue = RHI::RHI_QueueType::Graphics) override;
+
+        std::shared_ptr<RHI::RHI_Buffer> CreateBuffer(const RHI::RHI_BufferDesc& desc) override;
+        std::shared_ptr<RHI::RHI_Image> CreateStorageImage(const RHI::RHI_ImageDesc& desc) override;
+
+        uint32_t RegisterBindlessTexture(const RHI::RHI_Image& image) override;
+        uint32_t RegisterBindlessBuffer(const RHI::RHI_Buffer& buffer) override;
+        void ReleaseBindlessTexture(uint32_t index) override;
+        void ReleaseBindlessBuffer(uint32_t index) override;
+
     private:
         void BeginImGuiRenderPass();
         bool TransitionViewportImageToShaderRead();
@@ -64,24 +86,45 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         void CreateFullscreenQuadBuffer();
         void DestroyFullscreenQuadBuffer();
 
+        bool CreateComputeResources();
+        void DestroyComputeResources();
+        // Begins (or continues) this frame's compute recording for `queue`; null outside a frame.
+        VkCommandBuffer GetComputeCommandBuffer(RHI::RHI_QueueType queue);
+        // Families that may touch compute-visible resources (graphics + dedicated compute).
+        std::vector<uint32_t> GetSharedQueueFamilies() const;
+
+        // Shader hot reload: rebuilds the model pipeline when its shaders were recompiled.
+        void OnShadersReloaded(const std::vector<std::shared_ptr<Asset::Assets::ShaderAsset>>& reloaded);
+
     private:
         // Core Vulkan objects (wrappers)
         VK_Instance m_VKInstance;
         VK_Device   m_VKDevice;
         VK_Swapchain m_VKSwapchain;
+        VK_BindlessHeap m_BindlessHeap;
+        VK_DescriptorAllocator m_TransientDescriptors; // per-frame sets for fullscreen and compute passes
 
         std::unique_ptr<VK_Shaders> m_Shader;
         std::vector<VkPipeline> m_FullscreenPipelines;
-        struct FullscreenPipelineState {
-            VkPipelineLayout layout = VK_NULL_HANDLE;
-            VkDescriptorSetLayout set0Layout = VK_NULL_HANDLE;
-            VkDescriptorSetLayout set1Layout = VK_NULL_HANDLE;
-            VkDescriptorSet userSet = VK_NULL_HANDLE;
+
+        // GPU copies of CPU meshes. The weak reference tells a live entry from one whose mesh died
+        // (possibly with a new mesh now at the same address); dead entries are retired in BeginFrame
+        // and released once the frames in flight that could still draw them have completed.
+        struct CachedMesh {
+            std::weak_ptr<Renderer::RHI::RHI_Mesh> m_Source;
+            std::shared_ptr<VK_Mesh> m_GPU;
+        };
+        struct RetiredMesh {
+            std::shared_ptr<VK_Mesh> m_GPU;
+            uint64_t m_Frame = 0;
         };
-        std::unordered_map<VkPipeline, FullscreenPipelineState> m_FullscreenPipelineState;
-        std::unordered_map<const Renderer::RHI::RHI_Mesh*, std::shared_ptr<VK_Mesh>> m_MeshCache;
+        std::unordered_map<const Renderer::RHI::RHI_Mesh*, CachedMesh> m_MeshCache;
+        std::vector<RetiredMesh> m_RetiredMeshes;
+        uint64_t m_MeshFrame = 0;
 
         std::shared_ptr<VK_Mesh> GetOrUploadMesh(const std::shared_ptr<Renderer::RHI::RHI_Mesh>& cpuMesh);
+        void RetireMesh(std::shared_ptr<VK_Mesh> mesh);
+        void CollectDeadMeshes(); // after the frame fence wait
 
         bool m_FramebufferResized = false;
 
@@ -104,6 +147,26 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
         VkBuffer       m_FullscreenQuadBuffer = VK_NULL_HANDLE;
         VkDeviceMemory m_FullscreenQuadMemory = VK_NULL_HANDLE;
+
+        // Compute work per frame-in-flight, recorded lazily on the first Dispatch() of the frame.
+        // Graphics-queue dispatches are submitted ahead of the frame command buffer in the same
+        // vkQueueSubmit; async dispatches go to the compute queue and signal m_AsyncDone. Each async
+        // submit also waits on m_GraphicsTimeline for the previous graphics submit, so compute never
+        // overwrites a buffer the prior frame is still reading.
+        struct ComputeFrame {
+            VkCommandBuffer m_GraphicsCmd = VK_NULL_HANDLE;
+            VkCommandBuffer m_AsyncCmd = VK_NULL_HANDLE;
+            VkSemaphore     m_AsyncDone = VK_NULL_HANDLE;
+            bool m_GraphicsRecording = false;
+            bool m_AsyncRecording = false;
+        };
+        std::array<ComputeFrame, VK_Swapchain::FRAMES_IN_FLIGHT> m_ComputeFrames{};
+        VkCommandPool m_AsyncComputeCommandPool = VK_NULL_HANDLE;
+        VkSemaphore   m_GraphicsTimeline = VK_NULL_HANDLE;  // signaled with ++m_GraphicsTimelineValue by every frame submit
+        uint64_t      m_GraphicsTimelineValue = 0;
+        bool m_HasAsyncCompute = false;
+
+        uint32_t m_ShaderReloadListener = 0;
 	};
 } // namespace Nova::Core::Renderer::Backends::Vulkan
 
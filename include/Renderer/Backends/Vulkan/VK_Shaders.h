@@ -2,12 +2,15 @@
 #define VK_SHADERS_H
 
 #include <vulkan/vulkan.h>
+#include <functional>
 #include <vector>
 #include <glm/glm.hpp>
 
 #include "Api.h"
 #include "Renderer/RHI/RHI_Shaders.h"
 #include "Renderer/RHI/RHI_ShaderUniforms.h"
+#include "Renderer/RHI/RHI_ShaderPermutation.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorAllocator.h"
 
 namespace Nova::Core::Renderer::Backends::Vulkan {
 
@@ -47,6 +50,23 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         VkShaderModule m_Module = VK_NULL_HANDLE;
     };
 
+    /** Push-constant range (RHI::DrawPushConstants) added to every graphics pipeline layout. */
+    NV_API VkPushConstantRange GetDrawPushConstantRange();
+
+    /**
+     * VkSpecializationInfo for the specialization keywords of a mask (bool constants).
+     * Get() points into this object: keep it alive and unmoved until the pipeline is created.
+     */
+    struct NV_API VK_SpecializationData {
+        std::vector<VkSpecializationMapEntry> m_Entries;
+        std::vector<VkBool32> m_Values;
+        VkSpecializationInfo m_Info{};
+
+        void Build(const RHI::RHI_ShaderKeywordSet& keywords, RHI::RHI_ShaderVariantMask mask);
+        /** nullptr when the program declares no specialization keywords. */
+        const VkSpecializationInfo* Get() const { return m_Entries.empty() ? nullptr : &m_Info; }
+    };
+
     /** Vulkan pipeline + layout wrapper; derives from RHI_Shaders for SetParameter / ApplyParameters. */
     class NV_API VK_Shaders final : public RHI::RHI_Shaders {
     public:
@@ -56,6 +76,15 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         /** Set pipeline and layout (owned by swapchain/renderer). Call after pipeline creation. */
         void SetPipeline(VkPipeline pipeline, VkPipelineLayout layout);
 
+        /**
+         * Enables keyword variants: Bind() asks the factory for the pipeline matching
+         * GetKeywordMask() (mask 0 uses the pipeline from SetPipeline). The factory owns the
+         * pipelines, caches them, and must return layout-compatible ones. It returns
+         * VK_NULL_HANDLE while a variant is still compiling; Bind() draws with the base pipeline then.
+         */
+        using PipelineVariantFactory = std::function<VkPipeline(RHI::RHI_ShaderVariantMask)>;
+        void SetPipelineVariantFactory(PipelineVariantFactory factory) { m_VariantFactory = std::move(factory); }
+
         /** Scene buffers and descriptor sets used by UploadFrameUniforms / UploadMvpUniforms / UploadMaterialUniforms. */
         void SetSceneBuffers(VkDevice device,
             VkBuffer bufFrameUniforms, VkDeviceMemory bufFrameUniformsMemory,
@@ -65,6 +94,19 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             VkDescriptorSet sceneDescriptorSet,
             VkDescriptorSet userDescriptorSet = VK_NULL_HANDLE);
 
+        /**
+         * Make the user set (set 1) transient: Resources() values are recorded and written to a set
+         * allocated from `allocator` whenever they change or a new frame starts, instead of being
+         * written into one persistent set. Used by passes created at runtime (fullscreen/post-process).
+         */
+        void SetTransientUserSet(VK_DescriptorAllocator* allocator, VkDescriptorSetLayout userSetLayout);
+
+        /**
+         * Global bindless heap set (set 2). Only set it when the pipeline layout includes the
+         * heap layout; it is bound once per command buffer, like the user set.
+         */
+        void SetBindlessSet(VkDescriptorSet bindlessSet) { m_BindlessDescriptorSet = bindlessSet; m_BindlessSetBound = false; }
+
         void Bind(void* apiContext = nullptr) override;
         void ApplyParameters(void* apiContext = nullptr) override;
         void* GetNativeHandle() const override;
@@ -72,9 +114,17 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         /** Reset per-draw dynamic UBO offsets at frame start. */
         void ResetDynamicUBOs();
 
+        /**
+         * Forget which descriptor sets are bound on the current command buffer.
+         * Call after anything else binds sets with an incompatible layout (e.g. ImGui).
+         */
+        void InvalidateBindings();
+
         /**
          * Update a single binding in the user descriptor set (set 1).
-         * This is a low-level helper used by RHI_ShaderResourceSet.
+         * This is a low-level helper used by RHI_ShaderResourceSet. The set is shared by every draw
+         * and is not update-after-bind: only write it while no frame using it is in flight.
+         * Per-material resources belong in the bindless heap (IRenderer::RegisterBindlessTexture).
          */
         void WriteUserDescriptor(uint32_t binding, VkDescriptorType type,
             const VkDescriptorBufferInfo* bufferInfo,
@@ -89,17 +139,28 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
         /** Fill and map host-visible frame uniform block from m_Parameters. */
         void UploadFrameUniforms();
-        /** Fill and map dynamic MVP region from m_Parameters; advances m_MvpDynamicOffset when applicable. */
-        void UploadMvpUniforms(VkDeviceSize& outDynamicOffsetThisDraw);
-        /** Fill and map dynamic material region from m_Parameters; advances m_MaterialDynamicOffset when applicable. */
+        /**
+         * Fill and map dynamic MVP region from m_Parameters; advances m_MvpDynamicOffset when the
+         * contents changed since the previous draw. Model/normal matrices are skipped when pushed.
+         */
+        void UploadMvpUniforms(VkDeviceSize& outDynamicOffsetThisDraw, bool modelInPushConstants);
+        /** Fill and map dynamic material region from m_Parameters; reuses the previous region when unchanged. */
         void UploadMaterialUniforms(VkDeviceSize& outDynamicOffsetThisDraw);
-        /** Bind engine (scene) and user descriptor sets with correct dynamic offsets. */
+        /** Allocate and fill a new transient user set when its bindings changed or the frame did. */
+        void RefreshTransientUserSet();
+        /** Bind engine (scene), user and bindless descriptor sets; no-op when the same offsets are already bound. */
         void BindDescriptorSets(VkCommandBuffer cmd, VkDeviceSize mvpDynamicOffset, VkDeviceSize materialDynamicOffset);
-        /** Copy instance array into the instance buffer. */
+        /** Push RHI::DrawPushConstants for shaders that declare a push-constant block. */
+        void PushDrawConstants(VkCommandBuffer cmd);
+        /** Copy instance array (normals already filled) into the instance buffer. */
         void UploadInstanceBuffer(const std::vector<RHI::Instance>& instances);
 
+        /** Pipeline for the current keyword mask, falling back to m_Pipeline while it is unavailable. */
+        VkPipeline ResolvePipeline();
+
         VkPipeline m_Pipeline = VK_NULL_HANDLE;
         VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        PipelineVariantFactory m_VariantFactory;
 
         VkDevice m_Device = VK_NULL_HANDLE;
         VkBuffer m_BufFrameUniforms = VK_NULL_HANDLE;
@@ -118,6 +179,30 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         
         VkDescriptorSet m_SceneDescriptorSet = VK_NULL_HANDLE;
         VkDescriptorSet m_UserDescriptorSet = VK_NULL_HANDLE;
+        VkDescriptorSet m_BindlessDescriptorSet = VK_NULL_HANDLE;
+
+        // Transient user set (SetTransientUserSet): recorded writes, re-applied to a fresh set on change.
+        VK_DescriptorAllocator* m_TransientDescriptors = nullptr;
+        VkDescriptorSetLayout m_TransientUserLayout = VK_NULL_HANDLE;
+        std::vector<VK_DescriptorWrite> m_UserWrites;
+        uint64_t m_UserSetSerial = 0;
+        bool m_UserWritesDirty = false;
+
+        // Last uploaded per-draw blocks (this frame); identical draws reuse their dynamic region.
+        RHI::MVP      m_LastMvp{};
+        RHI::Material m_LastMaterial{};
+        VkDeviceSize  m_LastMvpOffset = 0;
+        VkDeviceSize  m_LastMaterialOffset = 0;
+        bool          m_HasLastMvp = false;
+        bool          m_HasLastMaterial = false;
+
+        // Descriptor state already recorded into the current command buffer.
+        VkCommandBuffer m_BoundCmd = VK_NULL_HANDLE;
+        VkDeviceSize    m_BoundMvpOffset = 0;
+        VkDeviceSize    m_BoundMaterialOffset = 0;
+        bool            m_EngineSetBound = false;
+        bool            m_UserSetBound = false;
+        bool            m_BindlessSetBound = false;
     };
 
 } // namespace Nova::Core::Renderer::Backends::Vulkan
@@ -6,13 +6,24 @@
 #include <vector>
 #include <thread>
 #include <array>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "Api.h"
 #include "Core/Application.h"
+#include "Core/PresentMode.h"
 #include "Renderer/RHI/RHI_ShaderReflection.h"
+#include "Renderer/RHI/RHI_ShaderPermutation.h"
+
+namespace Nova::Core::Asset::Assets {
+	class ShaderAsset;
+} // namespace Nova::Core::Asset::Assets
 
 namespace Nova::Core::Renderer::Backends::Vulkan {
 
+	class VK_DescriptorLayoutCache;
+
 	class NV_API VK_Swapchain {
 	public:
 		VK_Swapchain() = default;
@@ -33,6 +44,11 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
 		void Destroy();
 
+		// Device-owned layout cache the model pipeline takes its layouts from; set before Create().
+		void SetLayoutCache(VK_DescriptorLayoutCache* cache) { m_LayoutCache = cache; }
+		// Bindless heap layout appended as set 2 of the model pipeline layout (null: no heap).
+		void SetBindlessSetLayout(VkDescriptorSetLayout layout) { m_BindlessSetLayout = layout; }
+
 		struct NV_API VK_FrameSync {
 			VkSemaphore m_ImageAvailableSemaphore = VK_NULL_HANDLE;
 			VkFence     m_InFlightFence = VK_NULL_HANDLE;
@@ -72,7 +88,16 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		uint32_t GetAcquiredImageIndex() const { return m_AquiredImage; }
 
 		VkPipeline& GetModelPipeline() { return m_ModelPipeline; }
+		// Pipeline for a keyword mask (bits of GetModelKeywords()), owned here. VK_NULL_HANDLE while its shader
+		// variants are still compiling in the background, or when they failed (until the next reload).
+		VkPipeline GetModelPipelineVariant(RHI::RHI_ShaderVariantMask mask);
+		const RHI::RHI_ShaderKeywordSet& GetModelKeywords() const { return m_ModelKeywords; }
 		VkPipelineLayout& GetModelPipelineLayout() { return m_ModelPipelineLayout; }
+		const std::shared_ptr<Asset::Assets::ShaderAsset>& GetModelVertexShader() const { return m_ModelVertAsset; }
+		const std::shared_ptr<Asset::Assets::ShaderAsset>& GetModelFragmentShader() const { return m_ModelFragAsset; }
+		// Rebuilds the model pipelines from the shader assets' current binaries (hot reload).
+		// Waits for the GPU before swapping; on failure the previous pipelines stay bound.
+		bool ReloadModelPipeline();
 
 		// Engine buffers + descriptor set kEngineDescriptorSet (see RHI_ShaderUniforms.h / NovaUniforms.slang)
 		VkBuffer GetBufGlobals() const { return m_BufGlobals; }
@@ -105,6 +130,18 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
 		bool RecreateSwapchain();
 
+		// Present policy: takes effect at the next RecreateSwapchain() (or Create()).
+		void SetRequestedPresentMode(Core::PresentMode mode) { m_RequestedPresentMode = mode; }
+		Core::PresentMode GetRequestedPresentMode() const { return m_RequestedPresentMode; }
+		VkPresentModeKHR GetPresentMode() const { return m_PresentMode; }
+
+		// VK_KHR_present_wait: call once after Create() when the device enabled the feature.
+		void EnablePresentWait();
+		bool IsPresentWaitEnabled() const { return m_WaitForPresentFn != nullptr; }
+		// Present ids are per swapchain and restart at 1 after recreation.
+		uint64_t NextPresentId() { return ++m_PresentId; }
+		VkResult WaitForPresent(uint64_t presentId, uint64_t timeoutNs);
+
 	private:
 
 		bool CreateSwapchain();
@@ -123,6 +160,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
 		// Minimal pipeline
 		void CreateModelPipeline();
+		// VK_NULL_HANDLE with outPending set while a shader variant is still compiling.
+		VkPipeline CreateModelPipelineVariant(RHI::RHI_ShaderVariantMask mask, bool& outPending);
 		void DestroyModelPipeline();
 		bool CreateViewportRenderPass();
 		void DestroyViewportRenderPass();
@@ -162,7 +201,9 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		// Render pass
 		VkRenderPass m_BackBufferRenderPass = VK_NULL_HANDLE;
 
-		// Pipeline
+		// Pipeline (layouts are shared through m_LayoutCache, which owns them)
+		VK_DescriptorLayoutCache* m_LayoutCache = nullptr;
+		VkDescriptorSetLayout m_BindlessSetLayout = VK_NULL_HANDLE;
 		VkPipeline       m_ModelPipeline = VK_NULL_HANDLE;
 		VkPipelineLayout m_ModelPipelineLayout = VK_NULL_HANDLE;
 		VkDescriptorSetLayout m_EngineSetLayout = VK_NULL_HANDLE;
@@ -181,6 +222,11 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		VkDescriptorSet  m_EngineDescriptorSet = VK_NULL_HANDLE;
 		VkDescriptorSet  m_UserDescriptorSet = VK_NULL_HANDLE;
 		RHI::RHI_ProgramReflection m_ModelPipelineReflection{};
+		std::shared_ptr<Asset::Assets::ShaderAsset> m_ModelVertAsset;
+		std::shared_ptr<Asset::Assets::ShaderAsset> m_ModelFragAsset;
+		RHI::RHI_ShaderKeywordSet m_ModelKeywords{};
+		std::unordered_map<RHI::RHI_ShaderVariantMask, VkPipeline> m_ModelPipelineVariants;
+		std::unordered_set<RHI::RHI_ShaderVariantMask> m_FailedModelVariants; // reported once, retried after a reload
 
 		// Viewport offscreen render pass only (color finalLayout = SHADER_READ_ONLY for ImGui)
 		VkRenderPass m_ViewportRenderPass = VK_NULL_HANDLE;
@@ -206,6 +252,13 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		// ImGui resources
 		VkDescriptorPool m_ImGuiDescriptorPool = VK_NULL_HANDLE;
 
+		// Present policy
+		Core::PresentMode m_RequestedPresentMode = Core::PresentMode::Fifo;
+		VkPresentModeKHR  m_PresentMode = VK_PRESENT_MODE_FIFO_KHR;
+
+		PFN_vkWaitForPresentKHR m_WaitForPresentFn = nullptr;
+		uint64_t m_PresentId = 0;
+
 		// Per-frame state
 		uint32_t m_CurrentFrame = 0;
 		uint32_t m_AquiredImage = 0;
@@ -0,0 +1,63 @@
+#ifndef RENDERSCENE_H
+#define RENDERSCENE_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Api.h"
+#include "Renderer/RHI/RHI_Renderer.h"
+#include "Renderer/RHI/RHI_ShaderUniforms.h"
+
+namespace Nova::Core::Renderer::Graphics {
+
+    /** One drawable, extracted from the scene; everything submission needs, with no ECS or asset access. */
+    struct NV_API RenderProxy {
+        glm::mat4 m_World{ 1.0f };
+        glm::mat4 m_Normal{ 1.0f };
+        glm::vec4 m_BoundingSphere{ 0.0f }; // world space, xyz: center, w: radius
+        // State part of the draw order: bit 63 translucent, bits 24..47 material index, bits 0..23 mesh index.
+        uint64_t m_SortKey = 0;
+        uint32_t m_Mesh = 0;     // index into RenderScene::m_Meshes
+        uint32_t m_Material = 0; // index into RenderScene::m_Materials
+    };
+
+    struct NV_API RenderDrawItem {
+        uint64_t m_Key = 0;   // full draw order: m_SortKey combined with the view depth
+        uint32_t m_Proxy = 0;
+    };
+
+    /**
+     * Per-frame render data, filled by the scene's extraction stage (Scene::ExtractRenderScene) and then
+     * consumed in order by Cull(), Sort() and Submit(). Meshes and materials are deduplicated tables so a
+     * proxy stays small and submission holds one mesh reference per distinct mesh, not one per draw.
+     *
+     * The arrays are reused between frames; Clear() keeps their capacity.
+     */
+    class NV_API RenderScene {
+    public:
+        static constexpr uint64_t kTranslucentBit = 1ull << 63;
+
+        void Clear();
+
+        // Keeps the proxies whose bounding sphere intersects the frustum of `viewProj` (depth in [0, 1]). Large
+        // scenes are culled on the job system; the draw list keeps proxy order either way.
+        void Cull(const glm::mat4& viewProj, const glm::vec3& cameraPosition);
+        // Opaque front to back grouped by material and mesh, then translucent back to front.
+        void Sort();
+        // Sets material and model matrix, then draws, for every item of the draw list; the caller owns
+        // BeginScene and the frame.
+        void Submit(RHI::IRenderer& renderer) const;
+
+        std::vector<RenderProxy> m_Proxies;
+        std::vector<RHI::RHI_DrawIndexedCommand> m_Meshes;
+        std::vector<RHI::Material> m_Materials;
+        std::vector<RenderDrawItem> m_DrawList; // built by Cull()
+
+    private:
+        std::vector<uint32_t> m_CullCounts; // visible items per Cull() chunk
+    };
+
+} // namespace Nova::Core::Renderer::Graphics
+
+#endif // RENDERSCENE_H
@@ -0,0 +1,72 @@
+#ifndef RHI_BUFFER_H
+#define RHI_BUFFER_H
+
+#include <cstdint>
+#include <string>
+
+#include "Api.h"
+
+namespace Nova::Core::Renderer::RHI {
+
+    enum class RHI_BufferUsage : uint32_t {
+        None     = 0,
+        Storage  = 1u << 0,   // RWStructuredBuffer / StructuredBuffer
+        Uniform  = 1u << 1,
+        Indirect = 1u << 2,   // DispatchIndirect / DrawIndirect arguments
+        Vertex   = 1u << 3,
+        Index    = 1u << 4,
+        TransferSrc = 1u << 5,
+        TransferDst = 1u << 6,
+    };
+
+    inline constexpr RHI_BufferUsage operator|(RHI_BufferUsage a, RHI_BufferUsage b) {
+        return static_cast<RHI_BufferUsage>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+    }
+    inline constexpr RHI_BufferUsage& operator|=(RHI_BufferUsage& a, RHI_BufferUsage b) {
+        a = a | b;
+        return a;
+    }
+    inline constexpr bool HasUsage(RHI_BufferUsage value, RHI_BufferUsage flag) {
+        return (static_cast<uint32_t>(value) & static_cast<uint32_t>(flag)) != 0;
+    }
+
+    enum class RHI_MemoryUsage {
+        GpuOnly,    // device local, not mappable
+        CpuToGpu,   // host visible + coherent, persistently mapped (uploads, per-frame data)
+        GpuToCpu    // host visible + cached, persistently mapped (readback)
+    };
+
+    struct NV_API RHI_BufferDesc {
+        uint64_t m_Size = 0;
+        RHI_BufferUsage m_Usage = RHI_BufferUsage::Storage;
+        RHI_MemoryUsage m_Memory = RHI_MemoryUsage::GpuOnly;
+        std::string m_DebugName;
+    };
+
+    /**
+     * GPU buffer created through IRenderer::CreateBuffer().
+     * Bind it to a shader with `Resources().SetBuffer(name, buffer->GetNativeHandle())`.
+     */
+    class NV_API RHI_Buffer {
+    public:
+        virtual ~RHI_Buffer() = default;
+
+        const RHI_BufferDesc& GetDesc() const { return m_Desc; }
+        uint64_t GetSize() const { return m_Desc.m_Size; }
+
+        /** Persistent mapping for CpuToGpu / GpuToCpu buffers, nullptr for GpuOnly. */
+        virtual void* GetMappedData() const = 0;
+
+        /** Copy into a mappable buffer. Returns false for GpuOnly buffers or out-of-range writes. */
+        virtual bool Write(const void* data, uint64_t size, uint64_t offset = 0) = 0;
+
+        /** Backend handle (Vulkan: VkBuffer). */
+        virtual uint64_t GetNativeHandle() const = 0;
+
+    protected:
+        RHI_BufferDesc m_Desc{};
+    };
+
+} // namespace Nova::Core::Renderer::RHI
+
+#endif // RHI_BUFFER_H
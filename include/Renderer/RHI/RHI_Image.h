@@ -0,0 +1,49 @@
+#ifndef RHI_IMAGE_H
+#define RHI_IMAGE_H
+
+#include <cstdint>
+#include <string>
+
+#include "Api.h"
+
+namespace Nova::Core::Renderer::RHI {
+
+    enum class RHI_ImageFormat {
+        RGBA8Unorm,
+        RGBA16Float,
+        RGBA32Float,
+        R32Float,
+        R32Uint
+    };
+
+    struct NV_API RHI_ImageDesc {
+        uint32_t m_Width = 1;
+        uint32_t m_Height = 1;
+        RHI_ImageFormat m_Format = RHI_ImageFormat::RGBA8Unorm;
+        std::string m_DebugName;
+    };
+
+    /**
+     * 2D storage image (RWTexture2D) created through IRenderer::CreateStorageImage().
+     * The image stays in the general layout, so it can be written by compute and sampled
+     * afterwards: `Resources().SetTexture(name, image->GetViewHandle())`.
+     */
+    class NV_API RHI_Image {
+    public:
+        virtual ~RHI_Image() = default;
+
+        const RHI_ImageDesc& GetDesc() const { return m_Desc; }
+        uint32_t GetWidth() const { return m_Desc.m_Width; }
+        uint32_t GetHeight() const { return m_Desc.m_Height; }
+
+        /** Backend handles (Vulkan: VkImage / VkImageView). */
+        virtual uint64_t GetNativeHandle() const = 0;
+        virtual uint64_t GetViewHandle() const = 0;
+
+    protected:
+        RHI_ImageDesc m_Desc{};
+    };
+
+} // namespace Nova::Core::Renderer::RHI
+
+#endif // RHI_IMAGE_H
@@ -7,6 +7,8 @@
 
 #include "Api.h"
 #include "Core/GraphicsAPI.h"
+#include "Renderer/RHI/RHI_Buffer.h"
+#include "Renderer/RHI/RHI_Image.h"
 #include "Renderer/RHI/RHI_Mesh.h"
 #include "Renderer/RHI/RHI_ShaderCompiler.h"
 #include "Renderer/RHI/RHI_Shaders.h"
@@ -24,6 +26,11 @@ namespace Nova::Core::Renderer::RHI {
         UInt32
     };
 
+    enum class RHI_QueueType {
+        Graphics,       // recorded before the frame's render passes, same submission
+        AsyncCompute    // dedicated compute queue, graphics waits on it (falls back to Graphics)
+    };
+
     struct NV_API RHI_DrawCommand {
         std::shared_ptr<Renderer::RHI::RHI_Mesh> m_Mesh;
 
@@ -73,6 +80,8 @@ namespace Nova::Core::Renderer::RHI {
         // Scene state is configured separately from raw draw commands.
         virtual void BeginScene(const glm::mat4& view, const glm::mat4& proj) = 0;
         virtual void SetModelMatrix(const glm::mat4& model) = 0;
+        /** Same as SetModelMatrix(model) with a normal matrix precomputed by the caller (see Core/Math.h ComputeNormalMatrix). */
+        virtual void SetModelMatrix(const glm::mat4& model, const glm::mat4& normalMatrix) = 0;
 
         virtual void Draw(const RHI_DrawCommand& cmd) = 0;
         virtual void DrawIndexed(const RHI_DrawIndexedCommand& cmd) = 0;
@@ -105,6 +114,50 @@ namespace Nova::Core::Renderer::RHI {
          * Flushes the current scene parameters (view, proj, globals) before drawing.
          */
         virtual void DrawFullscreen(RHI_Shaders* shader) = 0;
+
+        /**
+         * Create a compute pipeline from a Slang compute shader (`.comp.slang` or m_Stage = Compute).
+         * Every ParameterBlock the shader declares gets its own descriptor set, bound by name
+         * through `Resources()` + `CommitResources()`.
+         * Caller owns the returned pointer and must call DestroyComputeShader() to free it.
+         */
+        virtual RHI_Shaders* CreateComputeShader(const RHI_ShaderCompileInput& computeIn) = 0;
+
+        /** Destroy a shader created by CreateComputeShader(). */
+        virtual void DestroyComputeShader(RHI_Shaders* shader) = 0;
+
+        /**
+         * Record a dispatch for the current frame (between BeginFrame and EndFrame).
+         * Dispatches run before the frame's graphics work; their writes are visible to every draw
+         * of the same frame on both queues.
+         */
+        virtual void Dispatch(RHI_Shaders* shader, uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1,
+            RHI_QueueType queue = RHI_QueueType::Graphics) = 0;
+
+        /** Same as Dispatch(), group counts read from `args` (uint3) at `offset`. */
+        virtual void DispatchIndirect(RHI_Shaders* shader, const RHI_Buffer& args, uint64_t offset = 0,
+            RHI_QueueType queue = RHI_QueueType::Graphics) = 0;
+
+        /** GPU buffer shared by graphics and compute queues. */
+        virtual std::shared_ptr<RHI_Buffer> CreateBuffer(const RHI_BufferDesc& desc) = 0;
+
+        /** 2D storage image shared by graphics and compute queues. */
+        virtual std::shared_ptr<RHI_Image> CreateStorageImage(const RHI_ImageDesc& desc) = 0;
+
+        /**
+         * Register a resource in the global bindless heap (Bindless.slang) and return its slot,
+         * e.g. for Material::m_BaseColorTexture (`SetParameter("baseColorTexture", int(index))`).
+         * kInvalidBindlessIndex when the heap is full or the backend has no bindless support.
+         */
+        virtual uint32_t RegisterBindlessTexture(const RHI_Image& image) = 0;
+        virtual uint32_t RegisterBindlessBuffer(const RHI_Buffer& buffer) = 0;
+
+        /**
+         * Return a slot to the heap. The resource must outlive the frames already recorded with it;
+         * the slot itself is reused only once those frames have completed.
+         */
+        virtual void ReleaseBindlessTexture(uint32_t index) = 0;
+        virtual void ReleaseBindlessBuffer(uint32_t index) = 0;
     };
 
 } // namespace Nova::Core::Renderer::RHI
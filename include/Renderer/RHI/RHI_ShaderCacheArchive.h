@@ -0,0 +1,104 @@
+#ifndef RHI_SHADER_CACHE_ARCHIVE_H
+#define RHI_SHADER_CACHE_ARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Api.h"
+
+namespace Nova::Core::Renderer::RHI {
+
+    enum class RHI_ShaderCacheRecordKind : uint32_t {
+        Shader = 1,       // payload 0: SPIR-V, payload 1: serialized reflection
+        Dependencies = 2, // payload 0: newline-separated dependency paths
+        Metadata = 3,     // payload 0: free-form value (e.g. the compiler build tag)
+    };
+
+    enum class RHI_ShaderCacheAccess : uint8_t {
+        ReadWrite, // stamps, appends and compacts
+        ReadOnly,  // shipped caches: never writes, so read-only installs can open it and it is never evicted
+    };
+
+    /**
+     * Single-file, append-only shader cache.
+     *
+     * Layout: a file header followed by records of [header][key][payload 0][payload 1], each
+     * part 16-byte aligned. A later record with the same kind + key supersedes an earlier one.
+     * The index is rebuilt from the record headers when the archive is opened (a torn record at
+     * the end is cut off), so there is no separate index to keep in sync.
+     *
+     * The file is memory-mapped: lookups return pointers into the mapping and never read().
+     * Growing the file maps a new view of the whole file; each blob holds a reference to the view
+     * it points into, so a view is unmapped once the archive and every blob from it let go of it.
+     * Records carry a last-used stamp, updated in place on
+     * lookup; Open() compacts the archive (dropping superseded records, then least recently used
+     * ones) once it exceeds its size budget or is mostly dead space.
+     *
+     * Several processes may share one archive (the engine and nova-shaderc): opening, appending and
+     * compacting take an advisory lock on the file, appends land at the real end of the file, and
+     * Find() re-checks the record header and key, rebuilding the index when the file was rewritten.
+     */
+    class NV_API RHI_ShaderCacheArchive {
+    public:
+        struct Blob {
+            const uint8_t* m_Data = nullptr;
+            size_t m_Size = 0;
+            std::shared_ptr<const void> m_Mapping; // keeps m_Data mapped while the blob is alive
+        };
+
+        RHI_ShaderCacheArchive() = default;
+        ~RHI_ShaderCacheArchive();
+        RHI_ShaderCacheArchive(const RHI_ShaderCacheArchive&) = delete;
+        RHI_ShaderCacheArchive& operator=(const RHI_ShaderCacheArchive&) = delete;
+
+        bool Open(const std::filesystem::path& path, uint64_t maxBytes,
+            RHI_ShaderCacheAccess access = RHI_ShaderCacheAccess::ReadWrite);
+        void Close();
+        bool IsOpen() const;
+
+        bool Contains(RHI_ShaderCacheRecordKind kind, std::string_view key) const;
+        bool Find(RHI_ShaderCacheRecordKind kind, std::string_view key, Blob& outPayload0, Blob& outPayload1);
+        /** Fails on archives opened ReadOnly. */
+        bool Append(RHI_ShaderCacheRecordKind kind, std::string_view key,
+            const void* payload0, size_t size0, const void* payload1 = nullptr, size_t size1 = 0);
+
+    private:
+        struct View {
+            uint8_t* m_Data = nullptr;
+            size_t m_Size = 0;
+            void* m_Handle = nullptr; // platform mapping object, if any
+        };
+
+        struct IndexEntry {
+            uint64_t m_Offset = 0;
+            uint64_t m_RecordSize = 0;
+        };
+
+        bool OpenUnlocked(const std::filesystem::path& path, uint64_t maxBytes, RHI_ShaderCacheAccess access, bool allowCompaction);
+        void CloseUnlocked();
+        bool MapUpTo(uint64_t size);
+        uint8_t* RecordAt(uint64_t offset);
+        bool Compact(uint64_t keepBytes);
+
+        static std::string IndexKey(RHI_ShaderCacheRecordKind kind, std::string_view key);
+
+        mutable std::mutex m_Mutex;
+        std::filesystem::path m_Path;
+        uint64_t m_MaxBytes = 0;
+        RHI_ShaderCacheAccess m_Access = RHI_ShaderCacheAccess::ReadWrite;
+        uint64_t m_FileSize = 0;
+        uint64_t m_DeadBytes = 0;
+        std::shared_ptr<View> m_View; // covers the whole file as of the last MapUpTo()
+        std::unordered_map<std::string, IndexEntry> m_Index;
+    };
+
+} // namespace Nova::Core::Renderer::RHI
+
+#endif // RHI_SHADER_CACHE_ARCHIVE_H
@@ -3,6 +3,9 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <future>
+#include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,8 +15,14 @@
 #include "Renderer/RHI/RHI_ShaderTypes.h"
 #include "Renderer/RHI/RHI_ShaderReflection.h"
 
+namespace Nova::Core {
+    class JobCounter;
+}
+
 namespace Nova::Core::Renderer::RHI {
 
+    class RHI_ShaderCacheArchive;
+
     enum class RHI_ShaderBinaryFormat : uint8_t {
         Unknown = 0,
         Spirv,
@@ -52,20 +61,76 @@ namespace Nova::Core::Renderer::RHI {
         RHI_ProgramReflection m_Reflection{};
 
         std::filesystem::file_time_type m_LastWriteTime{};
+
+        // Every file the compile read (the shader itself plus transitive imports/includes).
+        std::vector<std::filesystem::path> m_Dependencies;
     };
 
+    /**
+     * Thread-safe Slang front end. Identical requests (same cache key) that overlap share a
+     * single compile; the memory cache lock is only held for lookups and inserts.
+     */
     class NV_API RHI_ShaderCompiler {
     public:
+        /** Compiles on the calling thread (or waits for an identical in-flight compile). */
         static RHI_ShaderCompileResult Compile(const RHI_ShaderCompileInput& input);
 
+        /** Queues the compile on the job system. */
+        static std::shared_future<RHI_ShaderCompileResult> CompileAsync(const RHI_ShaderCompileInput& input);
+
+        /** Compiles all inputs concurrently; results are in input order. */
+        static std::vector<RHI_ShaderCompileResult> CompileBatch(const std::vector<RHI_ShaderCompileInput>& inputs);
+
+        /**
+         * Compiles several entry points of one source file (e.g. vertex + fragment) in a single
+         * load and link. Results are in input order and cached per stage like Compile(); inputs
+         * that differ in anything but stage/entry point fall back to CompileBatch().
+         */
+        static std::vector<RHI_ShaderCompileResult> CompileProgram(const std::vector<RHI_ShaderCompileInput>& stages);
+
+        /**
+         * When set, results come only from the cache archive (as written by nova-shaderc) and a
+         * miss is a failed compile; Slang is never initialized. Defaults to on in builds configured
+         * with NOVA_SHADER_PRECOMPILED.
+         */
+        static void SetPrecompiledOnly(bool precompiledOnly);
+        static bool IsPrecompiledOnly();
+
     private:
+        static bool PrepareInput(const RHI_ShaderCompileInput& input, RHI_ShaderCompileInput& outInput, RHI_ShaderCompileResult& outFailure);
+        /** Cached or in-flight result, or nullopt after registering `outOwner` as the compile for `hash`. */
+        static std::optional<std::shared_future<RHI_ShaderCompileResult>> FindOrClaim(
+            const RHI_ShaderCompileInput& input, const std::string& hash,
+            std::shared_ptr<std::promise<RHI_ShaderCompileResult>>& outOwner);
+        /** CompileAsync, counting the queued compile (if any) in `counter`. */
+        static std::shared_future<RHI_ShaderCompileResult> QueueCompile(const RHI_ShaderCompileInput& input, JobCounter& counter);
+        static RHI_ShaderCompileResult CompileClaimed(const RHI_ShaderCompileInput& input, const std::string& hash,
+            std::promise<RHI_ShaderCompileResult>& owner);
+        /** Ends a FindOrClaim claim: caches a success, drops the in-flight entry and wakes the waiters. */
+        static void PublishClaimed(const RHI_ShaderCompileInput& input, const std::string& hash,
+            std::promise<RHI_ShaderCompileResult>& owner, const RHI_ShaderCompileResult& result);
+        /** Disk cache, then Slang. No locks held. */
+        static RHI_ShaderCompileResult CompileUncached(const RHI_ShaderCompileInput& input, const std::string& hash);
+        static bool TryLoadCached(const RHI_ShaderCompileInput& input, const std::string& hash, RHI_ShaderCompileResult& out);
+        static void StoreCompiled(const RHI_ShaderCompileInput& input, RHI_ShaderCompileResult& out);
+
+        /**
+         * Cache key: 128-bit hash of the compiler version, the options and the contents of every
+         * file the last compile of this input depended on (falls back to the input file alone).
+         */
         static std::string ComputeHash(const RHI_ShaderCompileInput& input);
+        static bool LoadDependencies(const std::string& inputKey, std::vector<std::filesystem::path>& out);
+        static void SaveDependencies(const std::string& inputKey, const std::vector<std::filesystem::path>& deps);
         static bool NeedsRecompile(const RHI_ShaderCompileInput& input, const std::string& hash);
 
         static bool LoadCache(const std::string& hash, RHI_ShaderCompileResult& out);
         static void SaveCache(const std::string& hash, const RHI_ShaderCompileResult& result);
 
         static std::filesystem::path GetCacheDirectory();
+        /** Cache/Shaders/ShaderCache.nvpak, opened on first use. Holds binaries, reflection and dependency lists. */
+        static RHI_ShaderCacheArchive& GetArchive();
+        /** Precompiled Slang IR of imported modules (Name.slang-module). */
+        static std::filesystem::path GetModuleCacheDirectory();
     };
 
     NV_API bool ReadTextFile(const std::filesystem::path& path, std::string& outText, std::string& outError);
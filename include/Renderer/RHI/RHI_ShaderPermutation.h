@@ -0,0 +1,72 @@
+#ifndef RHI_SHADER_PERMUTATION_H
+#define RHI_SHADER_PERMUTATION_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Api.h"
+
+namespace Nova::Core::Renderer::RHI {
+
+    /** One bit per keyword, in declaration order of the owning RHI_ShaderKeywordSet. */
+    using RHI_ShaderVariantMask = uint64_t;
+    inline constexpr uint32_t kMaxShaderKeywords = 64;
+
+    enum class RHI_ShaderKeywordKind : uint8_t {
+        // Preprocessor define: each combination is a separate compile (`#if NAME`).
+        Compile = 0,
+        // Specialization constant: one compile, value patched at pipeline creation.
+        Specialization,
+    };
+
+    struct NV_API RHI_ShaderKeyword {
+        std::string m_Name;
+        RHI_ShaderKeywordKind m_Kind = RHI_ShaderKeywordKind::Compile;
+        uint32_t m_SpecConstantId = 0;
+    };
+
+    /**
+     * Feature keywords declared by a shader. Keywords come from the shader source:
+     *
+     *   // @keywords USE_SHADOWS USE_FOG          -> compile keywords (defined to 0 or 1)
+     *   [vk::constant_id(0)] const bool USE_INSTANCING = false;   -> specialization keyword
+     *
+     * Masks are only meaningful against the set that produced them; use Translate()
+     * to move a mask between e.g. a program's merged set and one stage's set.
+     */
+    class NV_API RHI_ShaderKeywordSet {
+    public:
+        static RHI_ShaderKeywordSet ParseSource(std::string_view source);
+
+        /** Adds a keyword, ignoring duplicates by name. Returns false when the set is full. */
+        bool Add(const RHI_ShaderKeyword& keyword);
+        void Merge(const RHI_ShaderKeywordSet& other);
+
+        /** Index of `name`, or -1. */
+        int Find(std::string_view name) const;
+        /** Bit for `name`, or 0 when the shader does not declare it. */
+        RHI_ShaderVariantMask GetBit(std::string_view name) const;
+
+        RHI_ShaderVariantMask GetCompileMask() const;
+        RHI_ShaderVariantMask GetSpecializationMask() const;
+
+        /** Re-express `mask` (built against `from`) in this set's bit positions, matching by name. */
+        RHI_ShaderVariantMask Translate(RHI_ShaderVariantMask mask, const RHI_ShaderKeywordSet& from) const;
+
+        /** Appends NAME=1/NAME=0 for every compile keyword. */
+        void AppendDefines(RHI_ShaderVariantMask mask,
+            std::vector<std::pair<std::string, std::string>>& defines) const;
+
+        const std::vector<RHI_ShaderKeyword>& GetKeywords() const { return m_Keywords; }
+        bool IsEmpty() const { return m_Keywords.empty(); }
+
+    private:
+        std::vector<RHI_ShaderKeyword> m_Keywords;
+    };
+
+} // namespace Nova::Core::Renderer::RHI
+
+#endif // RHI_SHADER_PERMUTATION_H
@@ -18,15 +18,37 @@
 #include <glm/glm.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <unordered_map>
 
 #include "Api.h"
+#include "Core/Hash.h"
 
 namespace Nova::Core::Renderer::RHI {
 
     inline constexpr uint32_t kEngineDescriptorSet = 0;
     inline constexpr uint32_t kUserDescriptorSet = 1;
+    // Global bindless heap (Bindless.slang), present in every pipeline layout when the device supports it.
+    inline constexpr uint32_t kBindlessDescriptorSet = 2;
+
+    // Index stored in materials / push constants for "no resource".
+    inline constexpr uint32_t kInvalidBindlessIndex = 0xFFFFFFFFu;
+
+    // Bindings of the bindless set; must match Bindless.slang.
+    enum class BindlessBinding : uint32_t {
+        Textures = 0,   // Texture2D[]
+        Samplers = 1,   // SamplerState[BindlessSampler::Count], written once at creation
+        Buffers = 2,    // ByteAddressBuffer[] / RWByteAddressBuffer[]
+    };
+
+    enum class BindlessSampler : uint32_t {
+        LinearClamp = 0,
+        LinearRepeat = 1,
+        NearestClamp = 2,
+        NearestRepeat = 3,
+        Count = 4
+    };
 
     // Matches NovaEngine field order in NovaUniforms.slang (bindings 0..Count-1 in set 0).
     enum class EngineResourceSlot : uint32_t {
@@ -58,10 +80,22 @@ namespace Nova::Core::Renderer::RHI {
         alignas(16) glm::mat4 m_Proj{ 1.0f };
         alignas(16) glm::mat4 m_ViewProj{ 1.0f };
         alignas(16) glm::mat4 m_InvViewProj{ 1.0f };
+        alignas(16) glm::mat4 m_Normal{ 1.0f };
     };
 
+    // Per-draw data pushed with vkCmdPushConstants (DrawConstants.slang). Every graphics
+    // pipeline layout reserves this range so set 0 stays compatible across pipelines.
+    struct NV_API DrawPushConstants {
+        alignas(16) glm::mat4 m_Model{ 1.0f };
+        alignas(16) glm::mat4 m_Normal{ 1.0f };
+    };
+    static_assert(sizeof(DrawPushConstants) <= 128, "Push constants must fit the guaranteed 128-byte minimum");
+
+    // m_Normal is read as-is by Scene.vert: whoever builds the instance fills it, from
+    // WorldTransformComponent::m_Normal or ComputeNormalMatrix(m_Model) (Core/Math.h).
     struct NV_API Instance {
         alignas(16) glm::mat4 m_Model{ 1.0f };
+        alignas(16) glm::mat4 m_Normal{ 1.0f };
         alignas(16) glm::vec4 m_Color{ 1.0f, 1.0f, 1.0f, 1.0f };
     };
 
@@ -100,9 +134,43 @@ namespace Nova::Core::Renderer::RHI {
         alignas(16) glm::vec3   m_Opacity{ 1.0f, 1.0f, 1.0f };
         alignas(4)  int         m_ThinWalled{ 0 };
         alignas(4)  int         m_IsOpaque{ 1 };
-        alignas(8)  glm::uvec2  m_PadCbufferAlign{ 0u, 0u };
+        // Bindless heap slots (IRenderer::RegisterBindlessTexture / RegisterBindlessBuffer).
+        alignas(4)  uint32_t    m_BaseColorTexture{ kInvalidBindlessIndex };
+        alignas(4)  uint32_t    m_DataBuffer{ kInvalidBindlessIndex };
+
+        // Field-wise: the alignas(16) vec3s leave padding whose bytes are indeterminate.
+        friend bool operator==(const Material& a, const Material& b) = default;
     };
 
+    // Hash over the fields only (never the padding), consistent with operator==. Keep in sync with
+    // GetMaterialParameterLayout when fields are added.
+    inline uint64_t HashMaterial(const Material& m) {
+        uint32_t words[56];
+        size_t count = 0;
+        const auto add = [&](float v) {
+            v += 0.0f; // -0 == +0, so both must hash alike
+            std::memcpy(&words[count++], &v, sizeof(v));
+        };
+        const auto add3 = [&](const glm::vec3& v) { add(v.x); add(v.y); add(v.z); };
+        const auto addBits = [&](uint32_t v) { words[count++] = v; };
+
+        add(m.m_Base); add3(m.m_BaseColor); add(m.m_DiffuseRoughness);
+        add(m.m_Metalness); add3(m.m_MetalColor);
+        add(m.m_Specular); add3(m.m_SpecularColor); add(m.m_SpecularRoughness);
+        add(m.m_SpecularIOR); add(m.m_SpecularAnisotropy); add(m.m_SpecularRotation);
+        add(m.m_Transmission); add3(m.m_TransmissionColor);
+        add(m.m_Subsurface); add3(m.m_SubsurfaceColor); add3(m.m_SubsurfaceRadius);
+        add(m.m_SubsurfaceScale); add(m.m_SubsurfaceAnisotropy);
+        add(m.m_Sheen); add3(m.m_SheenColor); add(m.m_SheenRoughness);
+        add(m.m_Coat); add3(m.m_CoatColor); add(m.m_CoatRoughness); add(m.m_CoatAnisotropy);
+        add(m.m_CoatRotation); add(m.m_CoatIOR); add(m.m_CoatAffectColor); add(m.m_CoatAffectRoughness);
+        add(m.m_Emission); add3(m.m_EmissionColor); add3(m.m_Opacity);
+        addBits(static_cast<uint32_t>(m.m_ThinWalled)); addBits(static_cast<uint32_t>(m.m_IsOpaque));
+        addBits(m.m_BaseColorTexture); addBits(m.m_DataBuffer);
+
+        return HashBytes128(words, count * sizeof(uint32_t)).m_Low;
+    }
+
     inline const std::unordered_map<std::string, size_t>& GetMaterialParameterLayout() {
         static const std::unordered_map<std::string, size_t> kLayout = {
             { "base",                 offsetof(Material, m_Base) },
@@ -139,7 +207,8 @@ namespace Nova::Core::Renderer::RHI {
             { "opacity",              offsetof(Material, m_Opacity) },
             { "thinWalled",           offsetof(Material, m_ThinWalled) },
             { "isOpaque",             offsetof(Material, m_IsOpaque) },
-            { "_padCbufferAlign",     offsetof(Material, m_PadCbufferAlign) },
+            { "baseColorTexture",     offsetof(Material, m_BaseColorTexture) },
+            { "dataBuffer",           offsetof(Material, m_DataBuffer) },
         };
         return kLayout;
     }
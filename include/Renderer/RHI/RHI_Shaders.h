@@ -2,6 +2,7 @@
 #define RHI_SHADERS_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <variant>
@@ -10,6 +11,7 @@
 
 #include "Api.h"
 #include "Renderer/RHI/RHI_ShaderUniforms.h"
+#include "Renderer/RHI/RHI_ShaderPermutation.h"
 #include "Renderer/RHI/RHI_ShaderReflection.h"
 #include "Renderer/RHI/RHI_ShaderResourceSet.h"
 
@@ -40,6 +42,8 @@ namespace Nova::Core::Renderer::RHI {
         void SetParameter(const std::string& name, const glm::mat2& value);
         void SetParameter(const std::string& name, const glm::mat3& value);
         void SetParameter(const std::string& name, const glm::mat4& value);
+        /** Set every Material field by its parameter name (see GetMaterialParameterLayout). */
+        void SetMaterial(const Material& material);
 
         /** Set/replace the reflection used for named resource binding. */
         void SetReflection(const RHI_ProgramReflection& reflection) {
@@ -48,6 +52,18 @@ namespace Nova::Core::Renderer::RHI {
         }
         const RHI_ProgramReflection& GetReflection() const { return m_Reflection; }
 
+        /** Keywords declared by the program (merged over its stages). */
+        void SetKeywords(const RHI_ShaderKeywordSet& keywords) { m_Keywords = keywords; m_KeywordMask = 0; }
+        const RHI_ShaderKeywordSet& GetKeywords() const { return m_Keywords; }
+
+        /**
+         * Toggle a feature keyword; the backend picks the matching variant at Bind().
+         * Unknown keywords are ignored so callers need not know what each shader declares.
+         */
+        void SetKeyword(std::string_view name, bool enabled);
+        bool IsKeywordEnabled(std::string_view name) const { return (m_KeywordMask & m_Keywords.GetBit(name)) != 0; }
+        RHI_ShaderVariantMask GetKeywordMask() const { return m_KeywordMask; }
+
         /** Access the shader's resource set (bind by reflection name). */
         RHI_ShaderResourceSet& Resources() { return m_Resources; }
         const RHI_ShaderResourceSet& Resources() const { return m_Resources; }
@@ -75,6 +91,9 @@ namespace Nova::Core::Renderer::RHI {
 
         RHI_ProgramReflection m_Reflection{};
         RHI_ShaderResourceSet m_Resources{ &m_Reflection };
+
+        RHI_ShaderKeywordSet  m_Keywords{};
+        RHI_ShaderVariantMask m_KeywordMask = 0;
     };
 
 } // namespace Nova::Core::Renderer::RHI
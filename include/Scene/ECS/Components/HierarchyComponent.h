@@ -0,0 +1,26 @@
+#ifndef HIERARCHYCOMPONENT_H
+#define HIERARCHYCOMPONENT_H
+
+#include <cstdint>
+#include <entt/entt.hpp>
+
+#include "Api.h"
+
+namespace Nova::Core::Scene::ECS::Components {
+
+	// Intrusive scene tree links, maintained by Scene (ParentEntity/DestroyEntity); do not edit directly.
+	// Children form a doubly-linked sibling list, so the tree lives in one dense pool with no per-node allocation.
+	struct NV_API HierarchyComponent {
+		entt::entity m_Parent{ entt::null };
+		entt::entity m_FirstChild{ entt::null };
+		entt::entity m_LastChild{ entt::null };
+		entt::entity m_PrevSibling{ entt::null };
+		entt::entity m_NextSibling{ entt::null };
+		uint32_t m_ChildCount = 0;
+		// Root is 0. After Scene::SortHierarchy() the pool is ordered by depth: parents come before children.
+		uint32_t m_Depth = 0;
+	};
+
+} // namespace Nova::Core::Scene::ECS::Components
+
+#endif // HIERARCHYCOMPONENT_H
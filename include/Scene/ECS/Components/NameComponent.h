@@ -2,17 +2,32 @@
 #define NAMECOMPONENT_H
 
 #include <string>
+#include <utility>
 
 #include "Api.h"
+#include "Core/InternedString.h"
 
 namespace Nova::Core::Scene::ECS::Components {
 
+	// Names set per entity are owned strings. Default and bulk-created names are interned instead, so
+	// thousands of entities named "Particle" share one pooled string; SetName() gives the entity its own again.
 	struct NV_API NameComponent {
-		std::string m_Name;
-
 		NameComponent() = default;
+		NameComponent(const char* name) : m_Name(name ? name : "") {}
 		NameComponent(const std::string& name) : m_Name(name) {}
+		NameComponent(InternedString name) : m_Shared(name) {}
+
+		const std::string& GetName() const { return m_Shared.empty() ? m_Name : m_Shared.Str(); }
+
+		void SetName(std::string name) {
+			m_Name = std::move(name);
+			m_Shared = {};
+		}
+
+	private:
+		std::string m_Name;
+		InternedString m_Shared; // when set, the name; m_Name is then empty
 	};
 } // namespace Nova::Core::Scene::ECS::Components
 
-#endif // NAMECOMPONENT_H
\ No newline at end of file
+#endif // NAMECOMPONENT_H
@@ -20,12 +20,16 @@ namespace Nova::Core::Scene::ECS::Components {
 		TransformComponent(const glm::vec3& t, const glm::vec3& r, const glm::vec3& s) : m_Translation(t), m_Rotation(r), m_Scale(s) {}
 		TransformComponent(const glm::vec3& t) : m_Translation(t) {}
 
+		// T * R * S, built column by column instead of multiplying three 4x4 matrices.
+		// Scene caches the result in WorldTransformComponent::m_Local; prefer that when it is up to date.
 		glm::mat4 GetTransform() const {
-			glm::mat4 rotation = glm::toMat4(glm::quat(m_Rotation));
+			const glm::mat3 rotation = glm::mat3_cast(glm::quat(m_Rotation));
 
-			return glm::translate(glm::mat4(1.0f), m_Translation)
-				* rotation
-				* glm::scale(glm::mat4(1.0f), m_Scale);
+			return glm::mat4(
+				glm::vec4(rotation[0] * m_Scale.x, 0.0f),
+				glm::vec4(rotation[1] * m_Scale.y, 0.0f),
+				glm::vec4(rotation[2] * m_Scale.z, 0.0f),
+				glm::vec4(m_Translation, 1.0f));
 		}
 	};
 
@@ -0,0 +1,14 @@
+#ifndef TRANSFORMDIRTYCOMPONENT_H
+#define TRANSFORMDIRTYCOMPONENT_H
+
+#include "Api.h"
+
+namespace Nova::Core::Scene::ECS::Components {
+
+	// Tag: the entity's local transform changed (or it was reparented) since the last Scene::UpdateTransforms().
+	// Added automatically when TransformComponent is emplaced, replaced or patched through the registry.
+	struct NV_API TransformDirtyComponent {};
+
+} // namespace Nova::Core::Scene::ECS::Components
+
+#endif // TRANSFORMDIRTYCOMPONENT_H
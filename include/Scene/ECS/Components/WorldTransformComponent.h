@@ -4,11 +4,21 @@
 #include <glm/glm.hpp>
 
 #include "Api.h"
+#include "Core/Math.h"
 
 namespace Nova::Core::Scene::ECS::Components {
 
 	struct NV_API WorldTransformComponent {
+		// Cached TransformComponent::GetTransform(), rebuilt by the transform system only when the local transform changes.
+		glm::mat4 m_Local{ 1.0f };
 		glm::mat4 m_World{ 1.0f };
+		// Inverse-transpose of m_World, refreshed together with it; fed to the renderer as-is.
+		glm::mat4 m_Normal{ 1.0f };
+
+		void SetWorld(const glm::mat4& world) {
+			m_World = world;
+			m_Normal = ComputeNormalMatrix(world);
+		}
 	};
 
 } // namespace Nova::Core::Scene::ECS::Components
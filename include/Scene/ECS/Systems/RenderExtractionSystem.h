@@ -0,0 +1,36 @@
+#ifndef RENDEREXTRACTIONSYSTEM_H
+#define RENDEREXTRACTIONSYSTEM_H
+
+#include <cstdint>
+#include <entt/entt.hpp>
+
+#include "Api.h"
+#include "Core/FlatHashMap.h"
+
+namespace Nova::Core::Asset::Assets {
+	class MeshAsset;
+}
+
+namespace Nova::Core::Renderer::Graphics {
+	class RenderScene;
+}
+
+namespace Nova::Core::Scene::ECS::Systems {
+
+	// Copies what the renderer needs out of the registry, once per frame and after the transform update:
+	// one RenderProxy per entity with a MeshRendererComponent (loaded mesh) and a WorldTransformComponent.
+	// Mesh and material tables are deduplicated, so a frame holds one mesh reference per distinct mesh.
+	class NV_API RenderExtractionSystem {
+	public:
+		// Rebuilds `out` (proxies, meshes, materials); its draw list is left empty until Cull().
+		void Extract(entt::registry& registry, Renderer::Graphics::RenderScene& out);
+
+	private:
+		// Scratch, kept between frames to avoid reallocating.
+		FlatHashMap<const Asset::Assets::MeshAsset*, uint32_t> m_MeshIndices;
+		FlatHashMap<uint64_t, uint32_t> m_MaterialIndices; // material field hash -> first index with that hash
+	};
+
+} // namespace Nova::Core::Scene::ECS::Systems
+
+#endif // RENDEREXTRACTIONSYSTEM_H
@@ -0,0 +1,85 @@
+#ifndef TRANSFORMSYSTEM_H
+#define TRANSFORMSYSTEM_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <entt/entt.hpp>
+
+#include "Api.h"
+
+namespace Nova::Core::Scene::ECS::Components {
+	struct WorldTransformComponent;
+}
+
+namespace Nova::Core::Scene::ECS::Systems {
+
+	// Incremental world-transform propagation over the HierarchyComponent tree.
+	//
+	// Changes are tracked with TransformDirtyComponent tags, set by on_construct/on_update signals of
+	// TransformComponent: mutate transforms through registry.patch/replace (or call Scene::MarkTransformDirty)
+	// so the change is seen. Update() only visits the subtrees under dirty entities and rebuilds the cached
+	// local matrix only for entities whose own transform changed. A static scene costs nothing beyond an
+	// empty view check.
+	//
+	// The dirty entities are copied into structure-of-arrays scratch (translation, quaternion, scale and
+	// 3x4 affine matrices), then processed one depth level at a time: every level is a parallel-for whose
+	// chunks compose and multiply matrices 8 (AVX2) or 4 (SSE) lanes at a time, with a scalar tail/fallback.
+	class NV_API TransformSystem {
+	public:
+		// Hooks the TransformComponent signals of `registry`; safe to call once per registry.
+		static void Connect(entt::registry& registry);
+
+		static void MarkDirty(entt::registry& registry, entt::entity entity);
+
+		// Recomputes WorldTransformComponent for every dirty subtree and clears the dirty tags.
+		void Update(entt::registry& registry);
+
+		// Entities recomputed by the last Update().
+		size_t GetLastUpdateCount() const { return m_Queue.size(); }
+
+	private:
+		// m_Parent: index of the parent in m_Queue, or kExternalParent when the parent is not being updated.
+		static constexpr uint32_t kExternalParent = UINT32_MAX;
+
+		struct Entry {
+			entt::entity m_Entity{ entt::null };
+			uint32_t m_Depth = 0;
+			uint32_t m_Parent = kExternalParent;
+			bool m_LocalDirty = false;
+		};
+
+		// Row-major 3x4 affine matrices (implicit last row 0 0 0 1), one array per element.
+		struct AffineSoA {
+			std::array<std::vector<float>, 12> m_Elements;
+			void Resize(size_t count);
+		};
+
+		struct LocalSoA {
+			std::array<std::vector<float>, 3> m_Translation;
+			std::array<std::vector<float>, 4> m_Rotation; // quaternion x, y, z, w
+			std::array<std::vector<float>, 3> m_Scale;
+			std::vector<uint32_t> m_DirtyMask;            // ~0u: rebuild from TRS, 0: keep the cached matrix
+			void Resize(size_t count);
+		};
+
+		void CollectSubtree(entt::registry& registry, entt::entity root);
+		void SortByDepth();
+
+		// Scratch, kept between updates to avoid reallocating.
+		std::vector<entt::entity> m_Roots;
+		std::vector<Entry> m_Collected;  // pre-order, per dirty subtree
+		std::vector<Entry> m_Queue;      // sorted by depth
+		std::vector<uint32_t> m_Levels;  // m_Queue offsets of each depth level, plus the end
+		std::vector<uint32_t> m_Remap;
+		std::vector<Components::WorldTransformComponent*> m_Targets;
+
+		LocalSoA m_TRS;
+		AffineSoA m_Local;
+		AffineSoA m_ParentWorld;
+		AffineSoA m_World;
+	};
+
+} // namespace Nova::Core::Scene::ECS::Systems
+
+#endif // TRANSFORMSYSTEM_H
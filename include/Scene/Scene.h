@@ -2,30 +2,41 @@
 #define SCENE_H
 
 #include <entt/entt.hpp>
-#include <unordered_map>
+#include <filesystem>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Api.h"
+#include "Core/FlatHashMap.h"
 #include "Core/UUID.h"
+#include "Scene/ECS/Components/HierarchyComponent.h"
+#include "Scene/ECS/Systems/RenderExtractionSystem.h"
+#include "Scene/ECS/Systems/TransformSystem.h"
 
 namespace Nova::Core::Scene {
 
+	class SceneFile;
+
 	class NV_API Scene {
 	public: 
-		struct NV_API Node {
-			entt::entity m_Parent{ entt::null };
-			std::vector<entt::entity> m_Children;
-		};
-
 		Scene(const std::string& sceneName);
 		~Scene() = default;
 
 		entt::entity CreateEntity(const std::string& name);
 		entt::entity CreateEntity(UUID id, const std::string& name);
 
+		// Creates `count` entities named `name` under `parent` (the root when null), in order, with range
+		// create/insert into pre-reserved pools. Much cheaper than `count` CreateEntity calls.
+		std::vector<entt::entity> CreateEntities(size_t count, std::string_view name = "Entity", entt::entity parent = entt::null);
+
+		// Destroys the entity together with its whole subtree.
 		void DestroyEntity(entt::entity entity);
 		void DestroyEntity(UUID id);
+		// Destroys every listed entity and its subtree with one bulk registry destroy. Duplicates, entities
+		// nested under other listed ones, invalid entities and the root are skipped.
+		void DestroyEntities(std::span<const entt::entity> entities);
 
 		entt::entity GetEntityByUUID(UUID id);
 
@@ -42,37 +53,97 @@ namespace Nova::Core::Scene {
 		void UnparentEntity(entt::entity child);
 
 		entt::entity GetParent(entt::entity entity) const;
-		const std::vector<entt::entity>& GetChildren(entt::entity entity) const;
+		std::vector<entt::entity> GetChildren(entt::entity entity) const;
+		uint32_t GetDepth(entt::entity entity) const;
+
+		// Visits the direct children of `entity` in order; fn(entt::entity). Must not reparent or destroy them.
+		template<typename Fn>
+		void ForEachChild(entt::entity entity, Fn&& fn) const {
+			const auto* node = m_Registry.try_get<ECS::Components::HierarchyComponent>(entity);
+			for (entt::entity child = node ? node->m_FirstChild : entt::null; child != entt::null;) {
+				const entt::entity next = m_Registry.get<ECS::Components::HierarchyComponent>(child).m_NextSibling;
+				fn(child);
+				child = next;
+			}
+		}
+
+		// Visits `root` then all of its descendants, parents before children; fn(entt::entity).
+		// Iterative, over the sibling links. Must not reparent or destroy anything in the subtree.
+		template<typename Fn>
+		void ForEachInSubtree(entt::entity root, Fn&& fn) const {
+			using ECS::Components::HierarchyComponent;
+			fn(root);
+			if (!m_Registry.all_of<HierarchyComponent>(root))
+				return;
+
+			entt::entity current = root;
+			while (true) {
+				const auto& node = m_Registry.get<HierarchyComponent>(current);
+				if (node.m_FirstChild != entt::null) {
+					current = node.m_FirstChild;
+					fn(current);
+					continue;
+				}
+
+				while (current != root && m_Registry.get<HierarchyComponent>(current).m_NextSibling == entt::null)
+					current = m_Registry.get<HierarchyComponent>(current).m_Parent;
+				if (current == root)
+					return;
+
+				current = m_Registry.get<HierarchyComponent>(current).m_NextSibling;
+				fn(current);
+			}
+		}
+
+		// Orders the HierarchyComponent pool (and WorldTransformComponent alongside it) by depth, so iterating
+		// view<HierarchyComponent>() visits every parent before its children. No-op if the tree has not changed.
+		void SortHierarchy();
+
+		// Recomputes WorldTransformComponent for entities whose transform (or an ancestor's) changed.
+		void UpdateTransforms();
+		// Needed after mutating a TransformComponent in place (get<>) rather than through registry.patch/replace.
+		void MarkTransformDirty(entt::entity entity);
+
+		// Fills `out` with this frame's render proxies; call after UpdateTransforms(), then Cull/Sort/Submit `out`.
+		void ExtractRenderScene(Renderer::Graphics::RenderScene& out);
 
 		void Clear();
 
+		// Binary .nvscene save/load (see SceneFile.h). Deserialize replaces the current content.
+		bool Serialize(const std::filesystem::path& path) const;
+		bool Deserialize(const std::filesystem::path& path);
+		// Adds the file's entities under `parent` (the root when null) with bulk inserts; returns them in file
+		// order. UUIDs already present in the scene are replaced by fresh ones.
+		std::vector<entt::entity> Instantiate(const SceneFile& file, entt::entity parent = entt::null);
+
 		std::string GetName() { return m_Name; }
 
 	private:
-		struct NV_API EntityHash {
-			std::size_t operator()(entt::entity e) const noexcept {
-				return static_cast<std::size_t>(entt::to_integral(e));
-			}
-		};
-
 		bool IsValidEntity(entt::entity e) const;
+		bool IsUnderRoot(entt::entity e) const;
 		bool WouldCreateCycle(entt::entity child, entt::entity newParent) const;
 
+		void CreateRoot();
 		void EnsureNode(entt::entity e);
 		void DetachFromParent(entt::entity e);
 		void AttachToParent(entt::entity e, entt::entity parent);
+		void UpdateSubtreeDepth(entt::entity e, uint32_t depth);
 
 		std::string m_Name;
 
 		entt::registry m_Registry;
 
-		std::unordered_map<UUID, entt::entity> m_EntityMap;
+		FlatHashMap<UUID, entt::entity> m_EntityMap;
 
 		entt::entity m_Root{ entt::null };
 
-		std::unordered_map<entt::entity, Node, EntityHash> m_Nodes;
+		// Set whenever entities are created, destroyed or reparented; cleared by SortHierarchy().
+		bool m_HierarchyDirty = false;
 
 		entt::entity m_MainCamera{ entt::null };
+
+		ECS::Systems::TransformSystem m_TransformSystem;
+		ECS::Systems::RenderExtractionSystem m_RenderExtractionSystem;
 	};
 
 } // namespace Nova::Core::Scene
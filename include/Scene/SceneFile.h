@@ -0,0 +1,136 @@
+#ifndef SCENEFILE_H
+#define SCENEFILE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <entt/entt.hpp>
+
+#include "Api.h"
+#include "Asset/Assets/MeshAsset.h"
+#include "Core/MappedFile.h"
+#include "Renderer/RHI/RHI_ShaderUniforms.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+
+namespace Nova::Core::Scene {
+
+	class Scene;
+
+	// Binary scene format (.nvscene), little-endian, meant to be memory-mapped.
+	//
+	// [SceneFileHeader][SceneChunkEntry x m_ChunkCount][chunk payloads, each 16-byte aligned]
+	//
+	// Entities are stored in pre-order (every parent before its children, siblings in order), so
+	// the hierarchy is a single parent-index array. Components are column chunks: the entity indices
+	// that have the component, then the values in the same order. POD components are stored with
+	// their in-memory layout and bulk-inserted straight from the mapping. Strings (names, asset
+	// paths) are deduplicated into tables referenced by index.
+	//
+	// Not serialized: CameraComponent, runtime state (WorldTransformComponent is recomputed).
+	enum class SceneChunkType : uint32_t {
+		UUIDs = 1,                 // uint64_t per entity
+		Parents = 2,               // uint32_t per entity, index of the parent entity or kNoParent
+		NameIndices = 3,           // uint32_t per entity, index into the name table
+		NameOffsets = 4,           // uint32_t per name + 1, offsets into NameChars
+		NameChars = 5,             // char
+		TransformIndices = 6,      // uint32_t entity index per TransformComponent, strictly increasing
+		Transforms = 7,            // ECS::Components::TransformComponent
+		MeshAssets = 8,            // SceneMeshAssetRecord per referenced mesh asset
+		MeshAssetPaths = 9,        // char, generic paths referenced by SceneMeshAssetRecord
+		MeshRendererIndices = 10,  // uint32_t entity index per MeshRendererComponent, strictly increasing
+		MeshRendererAssets = 11,   // uint32_t mesh asset index, or kNoAsset
+		MeshRendererMaterials = 12 // Renderer::RHI::Material, bindless slots stored as kInvalidBindlessIndex
+	};
+
+	struct SceneFileHeader {
+		uint32_t m_Magic = 0;
+		uint32_t m_Version = 0;
+		uint32_t m_EntityCount = 0;
+		uint32_t m_ChunkCount = 0;
+		uint64_t m_FileSize = 0;
+		uint64_t m_Reserved = 0;
+	};
+
+	struct SceneChunkEntry {
+		uint32_t m_Type = 0;
+		uint32_t m_Count = 0;  // elements
+		uint64_t m_Offset = 0; // from the start of the file, 16-byte aligned
+		uint64_t m_Size = 0;   // bytes, m_Count * element size
+	};
+
+	struct SceneMeshAssetRecord {
+		uint32_t m_PathOffset = 0;
+		uint32_t m_PathLength = 0;
+		Asset::Assets::MeshAssetDesc m_Desc{};
+	};
+
+	static_assert(sizeof(SceneFileHeader) == 32, "SceneFileHeader layout is part of the file format");
+	static_assert(sizeof(SceneChunkEntry) == 24, "SceneChunkEntry layout is part of the file format");
+
+	/** A mapped and validated .nvscene file; the spans point into the mapping. */
+	class NV_API SceneFile {
+	public:
+		static constexpr uint32_t kMagic = 0x4E53564E; // 'NVSN'
+		// Bump when any chunk layout changes, including the in-memory layout of stored POD components.
+		static constexpr uint32_t kVersion = 1;
+		static constexpr uint32_t kNoParent = UINT32_MAX;
+		static constexpr uint32_t kNoAsset = UINT32_MAX;
+
+		bool Open(const std::filesystem::path& path);
+		void Close();
+		bool IsOpen() const { return m_File.IsOpen(); }
+
+		uint32_t GetEntityCount() const { return m_EntityCount; }
+
+		std::span<const uint64_t> GetUUIDs() const { return m_UUIDs; }
+		std::span<const uint32_t> GetParents() const { return m_Parents; }
+
+		std::span<const uint32_t> GetNameIndices() const { return m_NameIndices; }
+		uint32_t GetNameCount() const { return m_NameOffsets.empty() ? 0 : static_cast<uint32_t>(m_NameOffsets.size() - 1); }
+		std::string_view GetName(uint32_t index) const;
+
+		std::span<const uint32_t> GetTransformIndices() const { return m_TransformIndices; }
+		std::span<const ECS::Components::TransformComponent> GetTransforms() const { return m_Transforms; }
+
+		uint32_t GetMeshAssetCount() const { return static_cast<uint32_t>(m_MeshAssets.size()); }
+		std::string_view GetMeshAssetPath(uint32_t index) const;
+		const Asset::Assets::MeshAssetDesc& GetMeshAssetDesc(uint32_t index) const { return m_MeshAssets[index].m_Desc; }
+
+		std::span<const uint32_t> GetMeshRendererIndices() const { return m_MeshRendererIndices; }
+		std::span<const uint32_t> GetMeshRendererAssets() const { return m_MeshRendererAssets; }
+		std::span<const Renderer::RHI::Material> GetMeshRendererMaterials() const { return m_MeshRendererMaterials; }
+
+		// Pages the whole mapping in; call on a loader thread before handing the file to the main thread.
+		void Prefault() const { m_File.Prefault(); }
+
+		// Writes every entity under the scene root (the root itself is implicit).
+		static bool Write(const std::filesystem::path& path, const Scene& scene);
+		// Writes the subtrees of `roots` only; they become top-level entities of the file. Roots must not nest.
+		static bool Write(const std::filesystem::path& path, const Scene& scene, std::span<const entt::entity> roots);
+
+	private:
+		bool Parse();
+		static bool WriteEntities(const std::filesystem::path& path, const Scene& scene, const std::vector<entt::entity>& order);
+
+		MappedFile m_File;
+		uint32_t m_EntityCount = 0;
+
+		std::span<const uint64_t> m_UUIDs;
+		std::span<const uint32_t> m_Parents;
+		std::span<const uint32_t> m_NameIndices;
+		std::span<const uint32_t> m_NameOffsets;
+		std::span<const char> m_NameChars;
+		std::span<const uint32_t> m_TransformIndices;
+		std::span<const ECS::Components::TransformComponent> m_Transforms;
+		std::span<const SceneMeshAssetRecord> m_MeshAssets;
+		std::span<const char> m_MeshAssetPaths;
+		std::span<const uint32_t> m_MeshRendererIndices;
+		std::span<const uint32_t> m_MeshRendererAssets;
+		std::span<const Renderer::RHI::Material> m_MeshRendererMaterials;
+	};
+
+} // namespace Nova::Core::Scene
+
+#endif // SCENEFILE_H
@@ -0,0 +1,122 @@
+#ifndef SCENESTREAMER_H
+#define SCENESTREAMER_H
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+#include "Api.h"
+#include "Core/JobSystem.h"
+
+namespace Nova::Core::Asset::Assets {
+	class MeshAsset;
+}
+
+namespace Nova::Core::Scene {
+
+	class Scene;
+	class SceneFile;
+
+	struct SceneStreamerSettings {
+		float m_CellSize = 128.0f;     // world units per cell edge, on the XZ plane
+		float m_LoadRadius = 256.0f;   // cells closer than this to the focus are loaded
+		float m_UnloadRadius = 320.0f; // loaded cells farther than this are unloaded; > m_LoadRadius (hysteresis)
+		float m_MergeBudgetMs = 2.0f;  // main-thread time per Update() spent merging loaded cells
+		uint32_t m_MaxConcurrentLoads = 2; // loader jobs in flight on the job system
+	};
+
+	// World-partition streaming over a directory of cell files (Cell_<x>_<z>.nvscene, see WriteCells).
+	//
+	// Each cell is a standalone .nvscene with its own entities and asset references. Cells near the focus
+	// are mapped, validated and paged in by loader jobs, which also load the cell's meshes; the staged files
+	// are then merged into the scene at the frame boundary (Update) nearest-first, under a time budget, with
+	// Scene::Instantiate. Cells that move out of m_UnloadRadius have their top-level entities destroyed and
+	// their meshes released from the AssetManager once no other cell uses them. Cell entities are ordinary
+	// scene entities: anything else that references them must cope with them disappearing on unload.
+	class NV_API SceneStreamer {
+	public:
+		explicit SceneStreamer(Scene& scene, const SceneStreamerSettings& settings = {});
+		~SceneStreamer(); // waits for the loads in flight; loaded cells stay in the scene
+
+		SceneStreamer(const SceneStreamer&) = delete;
+		SceneStreamer& operator=(const SceneStreamer&) = delete;
+
+		// Indexes the cell files of `directory`. Unloads whatever a previous Open() streamed in.
+		bool Open(const std::filesystem::path& directory);
+		// Cancels pending loads and unloads every streamed cell.
+		void Close();
+
+		// Call once per frame, before Scene::UpdateTransforms(): requests, merges and unloads cells around `focus`.
+		void Update(const glm::vec3& focus);
+
+		size_t GetCellCount() const { return m_Cells.size(); }
+		size_t GetLoadedCellCount() const { return m_LoadedCount; }
+		size_t GetPendingCellCount() const; // requested or staged, not merged yet
+
+		// Splits the scene into cell files: every top-level entity (and its subtree) goes to the cell containing
+		// its translation. Existing cell files in `directory` are removed first.
+		static bool WriteCells(const Scene& scene, const std::filesystem::path& directory, float cellSize);
+		static std::string GetCellFileName(const glm::ivec2& cell);
+
+	private:
+		enum class CellState : uint8_t { Unloaded, Requested, Staged, Loaded, Failed };
+
+		struct Cell {
+			glm::ivec2 m_Coord{ 0 };
+			std::filesystem::path m_Path;
+			CellState m_State = CellState::Unloaded;
+			uint32_t m_Generation = 0; // of the latest request; loader results from older requests are dropped
+			std::unique_ptr<SceneFile> m_Staged;
+			std::vector<std::shared_ptr<Asset::Assets::MeshAsset>> m_Meshes; // loaded by the loader job, when Staged or Loaded
+			std::vector<entt::entity> m_Roots; // top-level entities, when Loaded
+			float m_Distance = 0.0f;
+		};
+
+		struct LoadRequest {
+			uint32_t m_Cell = 0;
+			uint32_t m_Generation = 0;
+			std::filesystem::path m_Path;
+		};
+
+		struct LoadResult {
+			uint32_t m_Cell = 0;
+			uint32_t m_Generation = 0;
+			std::unique_ptr<SceneFile> m_File; // null when the file failed to open
+			std::vector<std::shared_ptr<Asset::Assets::MeshAsset>> m_Meshes;
+		};
+
+		float DistanceToCell(const Cell& cell, const glm::vec3& focus) const;
+		void Request(const std::vector<uint32_t>& indices);
+		void Cancel(uint32_t index);
+		void Unload(Cell& cell);
+		static void ReleaseMeshes(std::vector<std::shared_ptr<Asset::Assets::MeshAsset>>& meshes);
+		void CollectResults();
+		void MergeStaged();
+
+		void DispatchLoaders();
+		void StopLoaders();
+		void LoaderJob();
+
+		Scene& m_Scene;
+		SceneStreamerSettings m_Settings;
+		std::vector<Cell> m_Cells;
+		size_t m_LoadedCount = 0;
+		uint32_t m_NextGeneration = 0;
+
+		// Loader jobs: requests in, staged files out.
+		std::mutex m_Mutex;
+		std::deque<LoadRequest> m_Requests;
+		std::vector<LoadResult> m_Results;
+		uint32_t m_ActiveLoaders = 0; // guarded by m_Mutex
+		JobCounter m_LoaderJobs;
+	};
+
+} // namespace Nova::Core::Scene
+
+#endif // SCENESTREAMER_H
@@ -19,7 +19,8 @@ namespace Nova::Core::Asset::Assets {
     {}
 
     bool MeshAsset::Load() {
-        if (m_Loaded && m_CPUMesh && m_GPUMesh)
+        std::lock_guard<std::mutex> lock(m_LoadMutex);
+        if (m_Loaded.load(std::memory_order_relaxed) && m_CPUMesh && m_GPUMesh)
             return true;
 
         m_CPUMesh.reset();
@@ -30,6 +31,7 @@ namespace Nova::Core::Asset::Assets {
             NV_LOG_WARN(("MeshAsset load failed: " + m_Path.generic_string()).c_str());
             return false;
         }
+        ComputeBounds();
 
         GraphicsAPI api = Application::Get().GetWindow().GetGraphicsAPI();
         if (!BuildGpuMesh(api)) {
@@ -37,12 +39,12 @@ namespace Nova::Core::Asset::Assets {
             return false;
         }
 
-        m_Loaded = true;
+        m_Loaded.store(true, std::memory_order_release);
         return true;
     }
 
     bool MeshAsset::Reload() {
-        m_Loaded = false;
+        m_Loaded.store(false, std::memory_order_release);
         return Load();
     }
 
@@ -138,6 +140,29 @@ namespace Nova::Core::Asset::Assets {
         return (bool)m_CPUMesh;
     }
 
+    void MeshAsset::ComputeBounds() {
+        const auto& vertices = m_CPUMesh->GetVertices();
+        if (vertices.empty()) {
+            m_BoundingSphere = glm::vec4(0.0f);
+            return;
+        }
+
+        // Box center, then the farthest vertex from it: not minimal, but tight enough for culling.
+        glm::vec3 min(vertices[0].m_Position);
+        glm::vec3 max(vertices[0].m_Position);
+        for (const auto& v : vertices) {
+            min = glm::min(min, v.m_Position);
+            max = glm::max(max, v.m_Position);
+        }
+        const glm::vec3 center = (min + max) * 0.5f;
+        float radiusSq = 0.0f;
+        for (const auto& v : vertices) {
+            const glm::vec3 d = v.m_Position - center;
+            radiusSq = glm::max(radiusSq, glm::dot(d, d));
+        }
+        m_BoundingSphere = glm::vec4(center, glm::sqrt(radiusSq));
+    }
+
     bool MeshAsset::BuildGpuMesh(GraphicsAPI api) {
         if (!m_CPUMesh)
             return false;
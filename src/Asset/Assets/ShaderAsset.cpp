@@ -1,4 +1,7 @@
 #include "Asset/Assets/ShaderAsset.h"
+
+#include <chrono>
+
 #include "Core/Application.h"
 #include "Core/Log.h"
 
@@ -64,7 +67,46 @@ namespace Nova::Core::Asset::Assets {
         return CompileInternal(api, true);
     }
 
+    bool ShaderAsset::CompileAll(const std::vector<std::shared_ptr<ShaderAsset>>& shaders) {
+        return CompileAll(shaders, Application::Get().GetWindow().GetGraphicsAPI());
+    }
+
+    bool ShaderAsset::CompileAll(const std::vector<std::shared_ptr<ShaderAsset>>& shaders, GraphicsAPI api) {
+        std::vector<ShaderAsset*> pending;
+        std::vector<RHI::RHI_ShaderCompileInput> inputs;
+        bool ok = true;
+
+        for (const auto& shader : shaders) {
+            if (!shader) continue;
+            RHI::RHI_ShaderCompileInput opts;
+            bool done = false;
+            if (!shader->BeginCompile(api, false, opts, done)) {
+                ok = false;
+                continue;
+            }
+            if (done) continue;
+            pending.push_back(shader.get());
+            inputs.push_back(std::move(opts));
+        }
+
+        std::vector<RHI::RHI_ShaderCompileResult> results = RHI::RHI_ShaderCompiler::CompileBatch(inputs);
+        for (size_t i = 0; i < pending.size(); ++i) {
+            ok = pending[i]->FinishCompile(api, std::move(results[i])) && ok;
+        }
+        return ok;
+    }
+
     bool ShaderAsset::CompileInternal(GraphicsAPI api, bool force) {
+        RHI::RHI_ShaderCompileInput opts;
+        bool done = false;
+        if (!BeginCompile(api, force, opts, done)) return false;
+        if (done) return true;
+
+        return FinishCompile(api, RHI::RHI_ShaderCompiler::Compile(opts));
+    }
+
+    bool ShaderAsset::BeginCompile(GraphicsAPI api, bool force, RHI::RHI_ShaderCompileInput& outInput, bool& outUpToDate) {
+        outUpToDate = false;
         if (api != GraphicsAPI::Vulkan) {
             m_LastLog = "ShaderAsset::CompileInternal: la compilation de shaders n'est supportée que pour Vulkan (OpenGL retiré).";
             m_LastCompiledApi = api;
@@ -72,30 +114,101 @@ namespace Nova::Core::Asset::Assets {
         }
         if (api == GraphicsAPI::Vulkan && m_CompiledVulkan && !force) {
             m_LastCompiledApi = api;
+            outUpToDate = true;
             return true;
         }
 
-        RHI::RHI_ShaderCompileInput opts = m_Input;
-        opts.m_TargetApi = api;
+        // Keywords must be known before compiling so every compile keyword gets an explicit 0/1.
+        {
+            std::string source, readErr;
+            m_Keywords = RHI::ReadTextFile(m_Path, source, readErr)
+                ? RHI::RHI_ShaderKeywordSet::ParseSource(source)
+                : RHI::RHI_ShaderKeywordSet{};
+        }
+        ClearVariants();
+        m_ReloadBackup.reset(); // a full compile supersedes whatever a reload replaced
 
-        const std::filesystem::path engineShaderRoot =
-            std::filesystem::current_path() / "Nova-Core" / "Resources" / "Engine" / "Shaders";
+        outInput = BuildCompileInput(api, m_Keywords, 0, force);
+        return true;
+    }
 
-        const std::filesystem::path editorShaderRoot =
-            std::filesystem::current_path() / "Nova-Editor" / "Resources" / "Editor" / "Shaders";
+    RHI::RHI_ShaderCompileInput ShaderAsset::BuildReloadBase(GraphicsAPI api) const {
+        return BuildBaseInput(api, true);
+    }
 
-        opts.m_IncludeDirs.push_back(engineShaderRoot);
-        opts.m_IncludeDirs.push_back(editorShaderRoot);
+    RHI::RHI_ShaderCompileInput ShaderAsset::BuildReloadInput(RHI::RHI_ShaderCompileInput base, RHI::RHI_ShaderKeywordSet& outKeywords) {
+        std::string source, readErr;
+        outKeywords = RHI::ReadTextFile(base.m_File, source, readErr)
+            ? RHI::RHI_ShaderKeywordSet::ParseSource(source)
+            : RHI::RHI_ShaderKeywordSet{};
+        outKeywords.AppendDefines(0, base.m_Defines);
+        return base;
+    }
 
-        opts.m_File = m_Path;
-        opts.m_SkipCache = force;
+    std::vector<RHI::RHI_ShaderCompileInput> ShaderAsset::BuildPermutationInputs(GraphicsAPI api) const {
+        // Once compiled, the keywords include those of the shader's includes, as at runtime.
+        RHI::RHI_ShaderKeywordSet keywords = m_Keywords;
+        if (!m_CompiledVulkan) {
+            std::string source, readErr;
+            keywords = RHI::ReadTextFile(m_Path, source, readErr)
+                ? RHI::RHI_ShaderKeywordSet::ParseSource(source)
+                : RHI::RHI_ShaderKeywordSet{};
+        }
 
-        if (api == GraphicsAPI::Vulkan) {
-            opts.m_Defines.emplace_back("NOVA_VULKAN", "1");
+        // Every subset of the compile bits; specialization keywords never select a binary.
+        const RHI::RHI_ShaderVariantMask compileMask = keywords.GetCompileMask();
+        std::vector<RHI::RHI_ShaderCompileInput> inputs;
+        inputs.push_back(BuildCompileInput(api, keywords, 0, false));
+        for (RHI::RHI_ShaderVariantMask mask = compileMask; mask != 0; mask = (mask - 1) & compileMask) {
+            inputs.push_back(BuildCompileInput(api, keywords, mask, false));
         }
+        return inputs;
+    }
 
-        RHI::RHI_ShaderCompileResult out = RHI::RHI_ShaderCompiler::Compile(opts);
+    bool ShaderAsset::ApplyReload(GraphicsAPI api, RHI::RHI_ShaderKeywordSet&& keywords, RHI::RHI_ShaderCompileResult&& result) {
+        if (!result.m_Success) {
+            // Keep serving the last good binary.
+            m_LastLog = result.m_Log;
+            return false;
+        }
+
+        ReloadBackup backup;
+        backup.m_Format = m_FormatVulkan;
+        backup.m_Binary = std::move(m_BinaryVulkan);
+        backup.m_Source = std::move(m_SourceVulkan);
+        backup.m_Reflection = std::move(m_ReflectionVulkan);
+        backup.m_Dependencies = std::move(m_Dependencies);
+        backup.m_Keywords = std::move(m_Keywords);
+        backup.m_Variants = std::move(m_Variants);
+        backup.m_Stage = m_Input.m_Stage;
+        backup.m_LastCompiledApi = m_LastCompiledApi;
+        m_ReloadBackup = std::move(backup);
+
+        m_Keywords = std::move(keywords);
+        ClearVariants();
+        return FinishCompile(api, std::move(result));
+    }
+
+    bool ShaderAsset::RevertReload() {
+        if (!m_ReloadBackup) return false;
 
+        ReloadBackup& backup = *m_ReloadBackup;
+        m_FormatVulkan = backup.m_Format;
+        m_BinaryVulkan = std::move(backup.m_Binary);
+        m_SourceVulkan = std::move(backup.m_Source);
+        m_ReflectionVulkan = std::move(backup.m_Reflection);
+        m_Dependencies = std::move(backup.m_Dependencies);
+        m_Keywords = std::move(backup.m_Keywords);
+        ClearVariants();
+        m_Variants = std::move(backup.m_Variants);
+        m_Input.m_Stage = backup.m_Stage;
+        m_LastCompiledApi = backup.m_LastCompiledApi;
+        m_CompiledVulkan = true;
+        m_ReloadBackup.reset();
+        return true;
+    }
+
+    bool ShaderAsset::FinishCompile(GraphicsAPI api, RHI::RHI_ShaderCompileResult&& out) {
         m_LastLog = out.m_Log;
         if (!out.m_Success) {
             if (api == GraphicsAPI::Vulkan) m_CompiledVulkan = false;
@@ -106,12 +219,116 @@ namespace Nova::Core::Asset::Assets {
         m_BinaryVulkan = std::move(out.m_Binary);
         m_SourceVulkan = std::move(out.m_Source);
         m_ReflectionVulkan = std::move(out.m_Reflection);
+        m_Dependencies = std::move(out.m_Dependencies);
         m_CompiledVulkan = true;
+        MergeDependencyKeywords();
 
         m_Input.m_Stage = out.m_Stage;
         m_LastCompiledApi = api;
         return true;
     }
 
+    RHI::RHI_ShaderCompileInput ShaderAsset::BuildCompileInput(GraphicsAPI api, const RHI::RHI_ShaderKeywordSet& keywords,
+        RHI::RHI_ShaderVariantMask mask, bool force) const
+    {
+        RHI::RHI_ShaderCompileInput opts = BuildBaseInput(api, force);
+        keywords.AppendDefines(mask, opts.m_Defines);
+        return opts;
+    }
+
+    RHI::RHI_ShaderCompileInput ShaderAsset::BuildBaseInput(GraphicsAPI api, bool force) const {
+        RHI::RHI_ShaderCompileInput opts = m_Input;
+        opts.m_TargetApi = api;
+
+        const std::filesystem::path engineShaderRoot =
+            std::filesystem::current_path() / "Nova-Core" / "Resources" / "Engine" / "Shaders";
+
+        const std::filesystem::path editorShaderRoot =
+            std::filesystem::current_path() / "Nova-Editor" / "Resources" / "Editor" / "Shaders";
+
+        opts.m_IncludeDirs.push_back(engineShaderRoot);
+        opts.m_IncludeDirs.push_back(editorShaderRoot);
+
+        opts.m_File = m_Path;
+        opts.m_SkipCache = force;
+
+        if (api == GraphicsAPI::Vulkan) {
+            opts.m_Defines.emplace_back("NOVA_VULKAN", "1");
+        }
+        return opts;
+    }
+
+    void ShaderAsset::MergeDependencyKeywords() {
+        // Keywords are read before the first compile, when only the shader itself is known. Leaving an
+        // included file's keyword undefined in that compile is the same as defining it to 0 (`#if NAME`).
+        const std::filesystem::path self = m_Path.lexically_normal();
+        for (const auto& dependency : m_Dependencies) {
+            if (dependency.lexically_normal() == self) continue;
+            std::string source, readErr;
+            if (RHI::ReadTextFile(dependency, source, readErr))
+                m_Keywords.Merge(RHI::RHI_ShaderKeywordSet::ParseSource(source));
+        }
+    }
+
+    void ShaderAsset::ClearVariants() {
+        // Compiles still queued finish on their own and only land in the compiler cache.
+        m_Variants.clear();
+        m_PendingVariants.clear();
+        m_FailedVariants.clear();
+    }
+
+    ShaderAsset::VariantState ShaderAsset::RequestVariantBinary(RHI::RHI_ShaderVariantMask mask,
+        const std::vector<uint8_t>*& outBinary)
+    {
+        outBinary = nullptr;
+        if (!m_CompiledVulkan && !Compile())
+            return VariantState::Failed;
+
+        mask &= m_Keywords.GetCompileMask();
+        if (mask == 0) {
+            outBinary = &m_BinaryVulkan;
+            return VariantState::Ready;
+        }
+
+        if (auto it = m_Variants.find(mask); it != m_Variants.end()) {
+            outBinary = &it->second;
+            return VariantState::Ready;
+        }
+        if (m_FailedVariants.contains(mask))
+            return VariantState::Failed;
+
+        auto pending = m_PendingVariants.find(mask);
+        if (pending == m_PendingVariants.end()) {
+            pending = m_PendingVariants.emplace(mask,
+                RHI::RHI_ShaderCompiler::CompileAsync(BuildCompileInput(m_LastCompiledApi, m_Keywords, mask, false))).first;
+        }
+        if (pending->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return VariantState::Pending;
+
+        RHI::RHI_ShaderCompileResult out = pending->second.get();
+        m_PendingVariants.erase(pending);
+        if (!out.m_Success) {
+            m_LastLog = out.m_Log;
+            NV_LOG_WARN(("Shader variant compile failed (" + m_Path.generic_string() + "):\n" + out.m_Log).c_str());
+            m_FailedVariants.insert(mask);
+            return VariantState::Failed;
+        }
+
+        auto [it, inserted] = m_Variants.emplace(mask, std::move(out.m_Binary));
+        outBinary = &it->second;
+        return VariantState::Ready;
+    }
+
+    void ShaderAsset::WarmVariants() {
+        if (!m_CompiledVulkan) return;
+
+        const RHI::RHI_ShaderVariantMask compileMask = m_Keywords.GetCompileMask();
+        for (RHI::RHI_ShaderVariantMask mask = compileMask; mask != 0; mask = (mask - 1) & compileMask) {
+            if (m_Variants.contains(mask) || m_PendingVariants.contains(mask) || m_FailedVariants.contains(mask))
+                continue;
+            m_PendingVariants.emplace(mask,
+                RHI::RHI_ShaderCompiler::CompileAsync(BuildCompileInput(m_LastCompiledApi, m_Keywords, mask, false)));
+        }
+    }
 
 } // namespace Nova::Core::Asset::Assets
\ No newline at end of file
@@ -0,0 +1,293 @@
+#include "Asset/ShaderHotReload.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace Nova::Core::Asset {
+
+    using namespace Nova::Core::Renderer;
+
+    // Editors often save in several steps (truncate + write, or write temp + rename):
+    // wait for this much quiet time before recompiling.
+    static constexpr auto kDebounce = std::chrono::milliseconds(150);
+
+    static std::string NormalizeWatchPath(const std::filesystem::path& path) {
+        std::error_code ec;
+        std::filesystem::path normalized = std::filesystem::weakly_canonical(path, ec);
+        return (ec ? path.lexically_normal() : normalized).generic_string();
+    }
+
+    ShaderHotReload::~ShaderHotReload() {
+        Stop();
+    }
+
+    bool ShaderHotReload::Start(GraphicsAPI api) {
+        if (IsRunning()) return true;
+
+        {
+            // Assets watched before Start() were snapshotted for the previous API.
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Api = api;
+            RebuildDependentsLocked();
+        }
+        m_StopRequested = false;
+        m_Thread = std::thread([this]() { ThreadMain(); });
+        NV_LOG_INFO("Shader hot-reload watcher started.");
+        return true;
+    }
+
+    void ShaderHotReload::Stop() {
+        if (!IsRunning()) return;
+        m_StopRequested = true;
+        m_Thread.join();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Pending.clear();
+    }
+
+    void ShaderHotReload::Watch(const std::shared_ptr<Assets::ShaderAsset>& shader) {
+        if (!shader) return;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (const auto& w : m_Watched) {
+            if (w.m_Shader.lock() == shader) return;
+        }
+        m_Watched.push_back(WatchedShader{ shader, {} });
+        RebuildDependentsLocked();
+    }
+
+    void ShaderHotReload::Unwatch(const Assets::ShaderAsset* shader) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Watched.erase(std::remove_if(m_Watched.begin(), m_Watched.end(),
+            [shader](const WatchedShader& w) {
+                auto locked = w.m_Shader.lock();
+                return !locked || locked.get() == shader;
+            }), m_Watched.end());
+        RebuildDependentsLocked();
+    }
+
+    uint32_t ShaderHotReload::AddListener(ReloadListener listener) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        const uint32_t id = m_NextListenerId++;
+        m_Listeners.emplace_back(id, std::move(listener));
+        return id;
+    }
+
+    void ShaderHotReload::RemoveListener(uint32_t id) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Listeners.erase(std::remove_if(m_Listeners.begin(), m_Listeners.end(),
+            [id](const auto& entry) { return entry.first == id; }), m_Listeners.end());
+    }
+
+    void ShaderHotReload::ApplyPending() {
+        std::vector<PendingReload> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Pending.empty()) return;
+            pending.swap(m_Pending);
+        }
+
+        ShaderList reloaded;
+        for (auto& p : pending) {
+            const std::string path = p.m_Shader->GetPath().generic_string();
+            if (p.m_Shader->ApplyReload(m_Api, std::move(p.m_Keywords), std::move(p.m_Result))) {
+                NV_LOG_INFO(("Shader reloaded: " + path).c_str());
+                reloaded.push_back(p.m_Shader);
+            }
+            else {
+                NV_LOG_WARN(("Shader reload failed, keeping previous version (" + path + "):\n" + p.m_Shader->GetLastLog()).c_str());
+            }
+        }
+        if (reloaded.empty()) return;
+
+        std::vector<ReloadListener> listeners;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (const auto& [id, listener] : m_Listeners) listeners.push_back(listener);
+        }
+        for (const auto& listener : listeners) {
+            listener(reloaded);
+        }
+
+        // After the listeners, which may have reverted some of them: includes may have been added or removed
+        // by the edit, and the stage may have changed.
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        RebuildDependentsLocked();
+    }
+
+    void ShaderHotReload::RebuildDependentsLocked() {
+        m_Dependents.clear();
+        for (auto& w : m_Watched) {
+            auto shader = w.m_Shader.lock();
+            if (!shader) continue;
+            w.m_ReloadBase = shader->BuildReloadBase(m_Api);
+
+            const auto& deps = shader->GetDependencies();
+            if (deps.empty()) {
+                m_Dependents[NormalizeWatchPath(shader->GetPath())].push_back(shader);
+                continue;
+            }
+            for (const auto& dep : deps) {
+                m_Dependents[NormalizeWatchPath(dep)].push_back(shader);
+            }
+        }
+        m_DependentsChanged = true;
+    }
+
+    void ShaderHotReload::RecompileDependents(const std::vector<std::string>& changedFiles) {
+        // Copy the snapshots under the lock: the render thread owns the assets themselves.
+        ShaderList shaders;
+        std::vector<RHI::RHI_ShaderCompileInput> bases;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (const auto& file : changedFiles) {
+                auto it = m_Dependents.find(file);
+                if (it == m_Dependents.end()) continue;
+                for (const auto& w : it->second) {
+                    auto shader = w.lock();
+                    if (!shader || std::find(shaders.begin(), shaders.end(), shader) != shaders.end()) continue;
+                    const auto watched = std::find_if(m_Watched.begin(), m_Watched.end(),
+                        [&shader](const WatchedShader& entry) { return entry.m_Shader.lock() == shader; });
+                    if (watched == m_Watched.end()) continue;
+                    bases.push_back(watched->m_ReloadBase);
+                    shaders.push_back(std::move(shader));
+                }
+            }
+        }
+        if (shaders.empty()) return;
+
+        std::vector<RHI::RHI_ShaderKeywordSet> keywords(shaders.size());
+        std::vector<RHI::RHI_ShaderCompileInput> inputs;
+        inputs.reserve(shaders.size());
+        for (size_t i = 0; i < shaders.size(); ++i) {
+            inputs.push_back(Assets::ShaderAsset::BuildReloadInput(std::move(bases[i]), keywords[i]));
+        }
+
+        std::vector<RHI::RHI_ShaderCompileResult> results = RHI::RHI_ShaderCompiler::CompileBatch(inputs);
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (size_t i = 0; i < shaders.size(); ++i) {
+            m_Pending.push_back(PendingReload{ shaders[i], std::move(keywords[i]), std::move(results[i]) });
+        }
+    }
+
+#if defined(__linux__)
+
+    void ShaderHotReload::ThreadMain() {
+        const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0) {
+            NV_LOG_ERROR(("ShaderHotReload: inotify_init1 failed (errno " + std::to_string(errno) + ")").c_str());
+            return;
+        }
+
+        std::unordered_map<int, std::string> dirByWatch;
+        std::unordered_map<std::string, int> watchByDir;
+        std::unordered_set<std::string> changed;
+        auto lastEvent = std::chrono::steady_clock::now();
+
+        alignas(inotify_event) char buffer[4096];
+
+        while (!m_StopRequested) {
+            // Watch directories rather than files: saving through a rename replaces the inode.
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (m_DependentsChanged) {
+                    m_DependentsChanged = false;
+
+                    std::unordered_set<std::string> wanted;
+                    for (const auto& [file, shaders] : m_Dependents) {
+                        wanted.insert(std::filesystem::path(file).parent_path().generic_string());
+                    }
+                    for (auto it = watchByDir.begin(); it != watchByDir.end();) {
+                        if (wanted.count(it->first)) { ++it; continue; }
+                        inotify_rm_watch(fd, it->second);
+                        dirByWatch.erase(it->second);
+                        it = watchByDir.erase(it);
+                    }
+                    for (const auto& dir : wanted) {
+                        if (watchByDir.count(dir)) continue;
+                        const int wd = inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+                        if (wd < 0) {
+                            NV_LOG_WARN(("ShaderHotReload: cannot watch " + dir).c_str());
+                            continue;
+                        }
+                        watchByDir[dir] = wd;
+                        dirByWatch[wd] = dir;
+                    }
+                }
+            }
+
+            pollfd pfd{ fd, POLLIN, 0 };
+            const int ready = poll(&pfd, 1, static_cast<int>(kDebounce.count()));
+            if (ready > 0 && (pfd.revents & POLLIN)) {
+                for (;;) {
+                    const ssize_t len = read(fd, buffer, sizeof(buffer));
+                    if (len <= 0) break;
+                    for (char* ptr = buffer; ptr < buffer + len;) {
+                        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                        ptr += sizeof(inotify_event) + event->len;
+                        if (event->len == 0) continue;
+                        if (auto it = dirByWatch.find(event->wd); it != dirByWatch.end()) {
+                            changed.insert(it->second + "/" + event->name);
+                        }
+                    }
+                }
+                lastEvent = std::chrono::steady_clock::now();
+                continue;
+            }
+
+            if (!changed.empty() && std::chrono::steady_clock::now() - lastEvent >= kDebounce) {
+                std::vector<std::string> files(changed.begin(), changed.end());
+                changed.clear();
+                RecompileDependents(files);
+            }
+        }
+
+        close(fd);
+    }
+
+#else
+
+    void ShaderHotReload::ThreadMain() {
+        std::unordered_map<std::string, std::filesystem::file_time_type> writeTimes;
+
+        while (!m_StopRequested) {
+            std::vector<std::string> files;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_DependentsChanged = false;
+                for (const auto& [file, shaders] : m_Dependents) files.push_back(file);
+            }
+
+            std::vector<std::string> changed;
+            for (const auto& file : files) {
+                std::error_code ec;
+                const auto time = std::filesystem::last_write_time(file, ec);
+                if (ec) continue;
+                auto [it, inserted] = writeTimes.emplace(file, time);
+                if (!inserted && it->second != time) {
+                    it->second = time;
+                    changed.push_back(file);
+                }
+            }
+            if (!changed.empty()) {
+                // Let the writer finish before reading the file.
+                std::this_thread::sleep_for(kDebounce);
+                RecompileDependents(changed);
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+    }
+
+#endif
+
+} // Nova::Core::Asset
@@ -1,4 +1,5 @@
 #include "Core/Application.h"
+#include "Core/JobSystem.h"
 #include "Core/Log.h"
 
 #include <cstdlib>
@@ -29,21 +30,46 @@ namespace Nova::Core {
             OnEvent(e);
         };
 
+        // Default settings, unless the game already called JobSystem::Initialize() with its own.
+        JobSystem::Initialize();
         InitWindow(desc);
         m_ImGuiLayer = &m_LayerStack.PushOverlay<ImGuiLayer>(*m_Window, desc.m_GraphicsAPI);
     }
 
     void Application::DestroyEngine() {
+        // Queued jobs may still use the renderer.
+        JobSystem::Shutdown();
         DestroyWindow();
     }
 
     void Application::Run() {
         m_IsRunning = true;
 
+        for (auto& frame : m_Frames) {
+            if (!frame) frame = std::make_unique<RenderFrame>();
+        }
+        if (m_RenderThreadRequested)
+            StartRenderThread();
+
         uint64_t prev = SDL_GetPerformanceCounter();
         const double freq = (double)SDL_GetPerformanceFrequency();
 
+        uint64_t nextFrameNS = SDL_GetTicksNS();
+
         while(m_IsRunning) {
+            // Frame limiter: sleep before polling events rather than after present, so the
+            // input used to build the frame is sampled as late as possible.
+            if (const uint32_t maxFps = m_Window->GetMaxFrameRate(); maxFps > 0) {
+                const uint64_t frameNS = SDL_NS_PER_SECOND / maxFps;
+                uint64_t nowNS = SDL_GetTicksNS();
+                if (nowNS < nextFrameNS) {
+                    SDL_DelayPrecise(nextFrameNS - nowNS);
+                    nowNS = nextFrameNS;
+                }
+                // Advance from the deadline to avoid drift, resync if we fell more than a frame behind.
+                nextFrameNS = (nowNS - nextFrameNS > frameNS) ? nowNS + frameNS : nextFrameNS + frameNS;
+            }
+
             SDL_WindowID mainWindowID = SDL_GetWindowID(m_Window->GetSDLWindow());
 
             SDL_Event event;
@@ -123,6 +149,8 @@ namespace Nova::Core {
                 }
             }
 
+            JobSystem::RunMainThreadJobs();
+
             if (SDL_GetWindowFlags(m_Window->GetSDLWindow()) & SDL_WINDOW_MINIMIZED) {
                 SDL_Delay(10);
                 continue;
@@ -133,40 +161,164 @@ namespace Nova::Core {
             float dt = (float)((now - prev) / freq);
             prev = now;
 
-            if (m_Window->GetSDLRenderer()) {
-                SDL_Renderer* r = m_Window->GetSDLRenderer();
-                SDL_SetRenderDrawColor(r, 0, 0, 0, 255);
-                SDL_RenderClear(r);
-            }
+            if (IsRenderThreadEnabled())
+                SubmitFrame(dt);
+            else
+                RunFrame(dt);
+        }
+
+        StopRenderThread();
+    }
+
+    void Application::RunFrame(float dt) {
+        if (m_Window->GetSDLRenderer()) {
+            SDL_Renderer* r = m_Window->GetSDLRenderer();
+            SDL_SetRenderDrawColor(r, 0, 0, 0, 255);
+            SDL_RenderClear(r);
+        }
+
+        RenderFrame& frame = *m_Frames[0];
+        frame.m_Index = m_FrameIndex++;
+        frame.m_DeltaTime = dt;
+
+        //TODO only update layers when the window is not minimized
+
+        for (Layer* layer : m_LayerStack)
+            layer->OnUpdate(dt);
 
-            //TODO only update layers when the window is not minimized
+        for (Layer* layer : m_LayerStack)
+            layer->OnExtract(frame);
+
+        m_RenderingFrame = &frame;
+
+        for (Layer* layer : m_LayerStack)
+            layer->OnBegin();
+
+        frame.ExecuteCommands();
+
+        for (Layer* layer : m_LayerStack)
+            layer->OnRender();
+        
+        if (m_ImGuiLayer) {
+            m_ImGuiLayer->Begin();
 
             for (Layer* layer : m_LayerStack)
-                layer->OnUpdate(dt);
+                layer->OnImGuiRender();
+
+            m_ImGuiLayer->End();
+        }
+
+        for (Layer* layer : m_LayerStack)
+            layer->OnEnd();
+
+        m_RenderingFrame = nullptr;
+        frame.Reset();
+
+        m_LayerStack.ProcessPendingTransitions();
+
+        if (m_Window->GetSDLRenderer()) {
+            m_Window->PresentRenderer();
+        }
+    }
+
+    void Application::SubmitFrame(float dt) {
+        // Blocks only when the render thread is kMaxQueuedFrames behind.
+        RenderFrame* frame = nullptr;
+        if (!m_FreeFrames.Pop(frame))
+            return;
+        frame->m_Index = m_FrameIndex++;
+        frame->m_DeltaTime = dt;
+
+        for (Layer* layer : m_LayerStack)
+            layer->OnUpdate(dt);
+
+        for (Layer* layer : m_LayerStack)
+            layer->OnExtract(*frame);
+
+        // ImGui widgets read live state, so they are built here; only the draw data goes to the render thread.
+        if (m_ImGuiLayer) {
+            m_ImGuiLayer->Begin();
 
             for (Layer* layer : m_LayerStack)
+                layer->OnImGuiRender();
+
+            m_ImGuiLayer->EndDeferred(frame->m_ImGui);
+        }
+
+        frame->m_Layers.assign(m_LayerStack.begin(), m_LayerStack.end());
+        ++m_FramesSubmitted;
+        m_SubmittedFrames.Push(frame);
+
+        // Transitions delete layers the render thread may still be calling.
+        if (m_LayerStack.HasPendingTransitions()) {
+            FlushRenderThread();
+            m_LayerStack.ProcessPendingTransitions();
+        }
+    }
+
+    void Application::StartRenderThread() {
+        if (m_Window->GetGraphicsAPI() != GraphicsAPI::Vulkan) {
+            NV_LOG_WARN("Render thread requires the Vulkan backend; rendering on the main thread.");
+            return;
+        }
+
+        // Secondary ImGui viewports render through their own swapchains, outside the frame we hand off.
+        if (m_ImGuiLayer)
+            ImGui::GetIO().ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+
+        for (auto& frame : m_Frames)
+            m_FreeFrames.Push(frame.get());
+
+        m_RenderThread = std::thread([this]() { RenderThreadLoop(); });
+    }
+
+    void Application::StopRenderThread() {
+        if (!m_RenderThread.joinable())
+            return;
+
+        // The render thread drains the frames already queued, then exits.
+        m_SubmittedFrames.Close();
+        m_RenderThread.join();
+    }
+
+    void Application::FlushRenderThread() {
+        if (!m_RenderThread.joinable() || std::this_thread::get_id() == m_RenderThread.get_id())
+            return;
+
+        uint64_t completed = m_FramesCompleted.load(std::memory_order_acquire);
+        while (completed < m_FramesSubmitted) {
+            m_FramesCompleted.wait(completed, std::memory_order_acquire);
+            completed = m_FramesCompleted.load(std::memory_order_acquire);
+        }
+    }
+
+    void Application::RenderThreadLoop() {
+        JobSystem::SetCurrentThreadName("Nova Render");
+
+        RenderFrame* frame = nullptr;
+        while (m_SubmittedFrames.Pop(frame)) {
+            m_RenderingFrame = frame;
+
+            for (Layer* layer : frame->m_Layers)
                 layer->OnBegin();
 
-            for (Layer* layer : m_LayerStack)
-                layer->OnRender();
-            
-            if (m_ImGuiLayer) {
-                m_ImGuiLayer->Begin();
+            frame->ExecuteCommands();
 
-                for (Layer* layer : m_LayerStack)
-                    layer->OnImGuiRender();
+            for (Layer* layer : frame->m_Layers)
+                layer->OnRender();
 
-                m_ImGuiLayer->End();
-            }
+            if (m_ImGuiLayer)
+                m_ImGuiLayer->RenderSnapshot(frame->m_ImGui);
 
-            for (Layer* layer : m_LayerStack)
+            for (Layer* layer : frame->m_Layers)
                 layer->OnEnd();
 
-            m_LayerStack.ProcessPendingTransitions();
+            m_RenderingFrame = nullptr;
+            frame->Reset();
 
-            if (m_Window->GetSDLRenderer()) {
-                m_Window->PresentRenderer();
-            }
+            m_FramesCompleted.fetch_add(1, std::memory_order_release);
+            m_FramesCompleted.notify_all();
+            m_FreeFrames.Push(frame);
         }
     }
 
@@ -207,7 +359,8 @@ namespace Nova::Core {
     }
 
     bool Application::OnWindowResize(WindowResizeEvent& e) {
-        //TODO do something
+        // Layers resize the renderer from OnEvent on the main thread; let the render thread go idle first.
+        FlushRenderThread();
         (void)e;
         return false;
     }
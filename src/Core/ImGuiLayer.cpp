@@ -136,6 +136,55 @@ namespace Nova::Core {
         ImGui::NewFrame();
     }
 
+    void ImGuiDrawSnapshot::Capture(const ImDrawData* drawData) {
+        Clear();
+        if (!drawData || !drawData->Valid)
+            return;
+
+        m_DrawData = *drawData;
+        for (int i = 0; i < m_DrawData.CmdLists.Size; ++i)
+            m_DrawData.CmdLists[i] = drawData->CmdLists[i]->CloneOutput();
+    }
+
+    void ImGuiDrawSnapshot::Clear() {
+        for (ImDrawList* list : m_DrawData.CmdLists)
+            IM_DELETE(list);
+        m_DrawData.Clear();
+    }
+
+    void ImGuiLayer::EndDeferred(ImGuiDrawSnapshot& out) {
+        if(!m_IsRendererInitialized) {
+            NV_LOG_ERROR("ImGui backend not initialized!");
+            out.Clear();
+            return;
+        }
+
+        ImGuiIO& io = ImGui::GetIO();
+
+        int w, h;
+        m_Window.GetWindowSize(w, h);
+        io.DisplaySize = ImVec2((float)w, (float)h);
+
+        ImGui::Render();
+        out.Capture(ImGui::GetDrawData());
+    }
+
+    void ImGuiLayer::RenderSnapshot(ImGuiDrawSnapshot& snapshot) {
+        if (!snapshot.IsValid() || m_GraphicsAPI != GraphicsAPI::Vulkan)
+            return;
+
+        if (m_VulkanBeforeRenderCallback) {
+            m_VulkanBeforeRenderCallback();
+        }
+
+        if (m_CurrentCommandBuffer != VK_NULL_HANDLE) {
+            ImGui_ImplVulkan_RenderDrawData(&snapshot.m_DrawData, m_CurrentCommandBuffer);
+        }
+        else {
+            NV_LOG_ERROR("Vulkan Command Buffer not set for ImGuiLayer!");
+        }
+    }
+
     void ImGuiLayer::End() {
         if(!m_IsRendererInitialized) {
             NV_LOG_ERROR("ImGui backend not initialized!");
@@ -0,0 +1,42 @@
+#include "Core/InternedString.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Nova::Core {
+
+    namespace {
+        struct InternPool {
+            std::mutex m_Mutex;
+            // Keys view the owned strings, whose addresses never change.
+            std::unordered_map<std::string_view, std::unique_ptr<std::string>> m_Strings;
+        };
+
+        InternPool& GetPool() {
+            static InternPool pool;
+            return pool;
+        }
+    }
+
+    InternedString::InternedString(std::string_view value) {
+        if (value.empty())
+            return;
+
+        InternPool& pool = GetPool();
+        std::lock_guard<std::mutex> lock(pool.m_Mutex);
+        auto it = pool.m_Strings.find(value);
+        if (it == pool.m_Strings.end()) {
+            auto owned = std::make_unique<std::string>(value);
+            const std::string_view key(*owned);
+            it = pool.m_Strings.emplace(key, std::move(owned)).first;
+        }
+        m_String = it->second.get();
+    }
+
+    const std::string& InternedString::Str() const {
+        static const std::string s_Empty;
+        return m_String ? *m_String : s_Empty;
+    }
+
+} // namespace Nova::Core
@@ -0,0 +1,447 @@
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Core/Assert.h"
+#include "Core/WorkStealingDeque.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #if defined(__linux__)
+        #include <sched.h>
+    #endif
+#endif
+
+namespace Nova::Core {
+
+    namespace Detail {
+
+        struct Job {
+            std::function<void()> m_Fn;
+            const char* m_Name = nullptr;
+            JobCounter* m_Counter = nullptr;
+            bool m_MainThread = false;
+        };
+
+        struct JobCounterAccess {
+            static void Add(JobCounter& counter) { counter.m_Pending.fetch_add(1, std::memory_order_relaxed); }
+
+            // False when `counter` is already done, in which case the caller queues the job itself.
+            static bool HoldUntilDone(JobCounter& counter, Job* job) {
+                std::lock_guard<std::mutex> lock(counter.m_Mutex);
+                if (counter.m_Pending.load(std::memory_order_acquire) == 0)
+                    return false;
+                counter.m_Waiting.push_back(job);
+                return true;
+            }
+
+            // Decrements; the last decrement happens under the mutex and hands back the held jobs. Wait() takes
+            // the same mutex before returning, so the counter outlives this call.
+            static bool Complete(JobCounter& counter, std::vector<Job*>& outReady) {
+                uint32_t value = counter.m_Pending.load(std::memory_order_relaxed);
+                while (value > 1) {
+                    if (counter.m_Pending.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                        return false;
+                }
+
+                std::lock_guard<std::mutex> lock(counter.m_Mutex);
+                if (counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    return false;
+                outReady.swap(counter.m_Waiting);
+                return true;
+            }
+
+            static std::mutex& Mutex(JobCounter& counter) { return counter.m_Mutex; }
+        };
+
+    } // namespace Detail
+
+    namespace {
+
+        using Detail::Job;
+        using Detail::JobCounterAccess;
+
+        // Jobs a worker can queue locally before spilling into the shared queue.
+        constexpr size_t kDequeCapacity = 4096;
+
+        struct Worker {
+            WorkStealingDeque<Job, kDequeCapacity> m_Deque;
+            std::thread m_Thread;
+            uint32_t m_Index = 0;
+        };
+
+        struct JobSystemState {
+            // Tools that never call Shutdown() must not exit with joinable threads.
+            ~JobSystemState() { JobSystem::Shutdown(); }
+
+            std::mutex m_StartMutex; // Initialize / Shutdown
+            std::vector<std::unique_ptr<Worker>> m_Workers;
+            std::atomic<bool> m_Running{ false };
+            std::atomic<bool> m_Stop{ false };
+            std::atomic<uint32_t> m_LiveWorkers{ 0 };
+            std::thread::id m_MainThread;
+
+            // Jobs queued from threads without a deque, or from a worker whose deque is full.
+            std::mutex m_SharedMutex;
+            std::deque<Job*> m_Shared;
+            std::atomic<size_t> m_SharedCount{ 0 };
+
+            std::mutex m_MainMutex;
+            std::deque<Job*> m_MainJobs;
+
+            // Idle workers sleep on m_WorkSignal, bumped once per queued job (wakes one worker). Threads in
+            // Wait() sleep on m_WakeSignal, bumped for every queued job and finished counter (wakes them all,
+            // they are few).
+            alignas(64) std::atomic<uint32_t> m_WorkSignal{ 0 };
+            alignas(64) std::atomic<uint32_t> m_WakeSignal{ 0 };
+        };
+
+        JobSystemState g_State;
+
+        thread_local Worker* t_Worker = nullptr;
+        thread_local const char* t_JobName = nullptr;
+        thread_local uint32_t t_StealSeed = 0;
+
+        void Signal(std::atomic<uint32_t>& signal, bool all) {
+            signal.fetch_add(1, std::memory_order_release);
+            if (all)
+                signal.notify_all();
+            else
+                signal.notify_one();
+        }
+
+        void Schedule(Job* job) {
+            if (job->m_MainThread) {
+                std::lock_guard<std::mutex> lock(g_State.m_MainMutex);
+                g_State.m_MainJobs.push_back(job);
+            }
+            else {
+                if (!t_Worker || !t_Worker->m_Deque.Push(job)) {
+                    std::lock_guard<std::mutex> lock(g_State.m_SharedMutex);
+                    g_State.m_Shared.push_back(job);
+                    g_State.m_SharedCount.fetch_add(1, std::memory_order_release);
+                }
+                Signal(g_State.m_WorkSignal, false);
+            }
+            Signal(g_State.m_WakeSignal, true);
+        }
+
+        Job* PopMainJob() {
+            std::lock_guard<std::mutex> lock(g_State.m_MainMutex);
+            if (g_State.m_MainJobs.empty())
+                return nullptr;
+            Job* job = g_State.m_MainJobs.front();
+            g_State.m_MainJobs.pop_front();
+            return job;
+        }
+
+        Job* PopSharedJob() {
+            if (g_State.m_SharedCount.load(std::memory_order_acquire) == 0)
+                return nullptr;
+            std::lock_guard<std::mutex> lock(g_State.m_SharedMutex);
+            if (g_State.m_Shared.empty())
+                return nullptr;
+            Job* job = g_State.m_Shared.front();
+            g_State.m_Shared.pop_front();
+            g_State.m_SharedCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+
+        // Own deque first (newest, cache-warm), then the shared queue, then the other workers from a random
+        // starting point so thieves spread out.
+        Job* FindJob() {
+            if (t_Worker) {
+                if (Job* job = t_Worker->m_Deque.Pop())
+                    return job;
+            }
+            if (Job* job = PopSharedJob())
+                return job;
+
+            const auto& workers = g_State.m_Workers;
+            if (workers.empty())
+                return nullptr;
+
+            uint32_t seed = t_StealSeed ? t_StealSeed : 0x9E3779B9u;
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            t_StealSeed = seed;
+
+            for (size_t i = 0; i < workers.size(); ++i) {
+                Worker* victim = workers[(seed + i) % workers.size()].get();
+                if (victim == t_Worker)
+                    continue;
+                if (Job* job = victim->m_Deque.Steal())
+                    return job;
+            }
+            return nullptr;
+        }
+
+        void Execute(Job* job) {
+            const char* outer = t_JobName;
+            t_JobName = job->m_Name;
+            job->m_Fn();
+            t_JobName = outer;
+
+            JobCounter* counter = job->m_Counter;
+            delete job;
+            if (!counter)
+                return;
+
+            std::vector<Job*> ready;
+            if (!JobCounterAccess::Complete(*counter, ready))
+                return;
+            for (Job* held : ready)
+                Schedule(held);
+            Signal(g_State.m_WakeSignal, true);
+        }
+
+        void PinCurrentThread(uint32_t core) {
+#if defined(_WIN32)
+            if (core < 64)
+                SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core);
+#elif defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+            (void)core; // macOS has no hard affinity
+#endif
+        }
+
+        void WorkerLoop(Worker* worker, bool pin) {
+            t_Worker = worker;
+            t_StealSeed = worker->m_Index + 1;
+            JobSystem::SetCurrentThreadName(("Nova Worker " + std::to_string(worker->m_Index)).c_str());
+            if (pin)
+                PinCurrentThread((worker->m_Index + 1) % std::max(std::thread::hardware_concurrency(), 1u));
+
+            for (;;) {
+                // Read the signal before looking, so a job queued in between is never slept through.
+                const uint32_t signal = g_State.m_WorkSignal.load(std::memory_order_acquire);
+                if (Job* job = FindJob()) {
+                    Execute(job);
+                    continue;
+                }
+                if (g_State.m_Stop.load(std::memory_order_acquire))
+                    break;
+                g_State.m_WorkSignal.wait(signal, std::memory_order_acquire);
+            }
+
+            t_Worker = nullptr;
+            g_State.m_LiveWorkers.fetch_sub(1, std::memory_order_release);
+            Signal(g_State.m_WakeSignal, true);
+        }
+
+        void EnsureStarted() {
+            if (!g_State.m_Running.load(std::memory_order_acquire))
+                JobSystem::Initialize();
+        }
+
+    } // namespace
+
+    void JobSystem::Initialize(const JobSystemSettings& settings) {
+        std::lock_guard<std::mutex> lock(g_State.m_StartMutex);
+        if (g_State.m_Running.load(std::memory_order_relaxed))
+            return;
+
+        const unsigned hw = std::thread::hardware_concurrency();
+        const uint32_t count = settings.m_WorkerCount ? settings.m_WorkerCount : std::max(hw, 2u) - 1;
+
+        g_State.m_MainThread = std::this_thread::get_id();
+        g_State.m_Stop.store(false, std::memory_order_relaxed);
+        g_State.m_LiveWorkers.store(count, std::memory_order_relaxed);
+
+        // Every deque exists before the first thief starts.
+        for (uint32_t i = 0; i < count; ++i) {
+            auto& worker = g_State.m_Workers.emplace_back(std::make_unique<Worker>());
+            worker->m_Index = i;
+        }
+        for (auto& worker : g_State.m_Workers)
+            worker->m_Thread = std::thread(WorkerLoop, worker.get(), settings.m_PinThreads);
+
+        g_State.m_Running.store(true, std::memory_order_release);
+    }
+
+    void JobSystem::Shutdown() {
+        std::lock_guard<std::mutex> lock(g_State.m_StartMutex);
+        if (!g_State.m_Running.load(std::memory_order_relaxed))
+            return;
+
+        g_State.m_Stop.store(true, std::memory_order_release);
+        Signal(g_State.m_WorkSignal, true);
+
+        // Workers drain their deques before leaving; help them, and run the main-thread jobs they may wait on.
+        const bool main = IsMainThread();
+        while (g_State.m_LiveWorkers.load(std::memory_order_acquire) > 0) {
+            const uint32_t signal = g_State.m_WakeSignal.load(std::memory_order_acquire);
+            Job* job = main ? PopMainJob() : nullptr;
+            if (!job)
+                job = FindJob();
+            if (job) {
+                Execute(job);
+                continue;
+            }
+            if (g_State.m_LiveWorkers.load(std::memory_order_acquire) == 0)
+                break;
+            g_State.m_WakeSignal.wait(signal, std::memory_order_acquire);
+        }
+        for (auto& worker : g_State.m_Workers)
+            worker->m_Thread.join();
+        g_State.m_Workers.clear();
+
+        // Whatever the last jobs queued runs here.
+        for (;;) {
+            Job* job = PopSharedJob();
+            if (!job)
+                job = PopMainJob();
+            if (!job)
+                break;
+            Execute(job);
+        }
+
+        g_State.m_Running.store(false, std::memory_order_release);
+    }
+
+    void JobSystem::Run(std::function<void()> job, const JobOptions& options) {
+        EnsureStarted();
+
+        Job* queued = new Job{ std::move(job), options.m_Name, options.m_Counter, options.m_MainThread };
+        if (options.m_Counter)
+            JobCounterAccess::Add(*options.m_Counter);
+        if (options.m_DependsOn && JobCounterAccess::HoldUntilDone(*options.m_DependsOn, queued))
+            return;
+        Schedule(queued);
+    }
+
+    void JobSystem::Wait(JobCounter& counter) {
+        // Never runs m_MainThread jobs: Wait() is called from inside engine systems, which must not see
+        // arbitrary main-thread work (registry edits, ...) interleaved with their own.
+        while (!counter.IsDone()) {
+            // Read the signal before looking, so a job queued or a counter finished in between wakes us.
+            const uint32_t signal = g_State.m_WakeSignal.load(std::memory_order_acquire);
+            if (Job* job = FindJob()) {
+                Execute(job);
+                continue;
+            }
+            if (counter.IsDone())
+                break;
+            g_State.m_WakeSignal.wait(signal, std::memory_order_acquire);
+        }
+        // The thread that finished the last job may still hold the mutex; see JobCounterAccess::Complete.
+        std::lock_guard<std::mutex> lock(JobCounterAccess::Mutex(counter));
+    }
+
+    void JobSystem::RunMainThreadJobs() {
+        NV_ASSERT_MSG(IsMainThread() || !g_State.m_Running.load(std::memory_order_acquire),
+            "JobSystem::RunMainThreadJobs() called off the main thread.");
+
+        // Only what is queued now: a job that queues another one runs it next frame.
+        std::deque<Job*> jobs;
+        {
+            std::lock_guard<std::mutex> lock(g_State.m_MainMutex);
+            jobs.swap(g_State.m_MainJobs);
+        }
+        for (Job* job : jobs)
+            Execute(job);
+    }
+
+    void JobSystem::ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn, const char* name) {
+        if (count == 0)
+            return;
+        grain = std::max<size_t>(grain, 1);
+        const size_t chunks = (count + grain - 1) / grain;
+        if (chunks == 1) {
+            fn(0, count);
+            return;
+        }
+        EnsureStarted();
+
+        // Helpers claim chunks from a shared cursor instead of getting one job per chunk: queuing stays cheap,
+        // and a helper that starts late finds nothing left and returns at once. The caller waits for finished
+        // chunks, not for its helpers, so it never runs unrelated jobs; the range is refcounted because late
+        // helpers may still run after the caller returned.
+        struct Range {
+            const std::function<void(size_t, size_t)>* m_Fn;
+            size_t m_Count;
+            size_t m_Grain;
+            size_t m_Chunks;
+            std::atomic<size_t> m_Next{ 0 };
+            std::atomic<size_t> m_Done{ 0 };
+            std::atomic<uint32_t> m_Refs{ 0 };
+
+            void RunChunks() {
+                size_t done = 0;
+                for (size_t chunk = m_Next.fetch_add(1, std::memory_order_relaxed); chunk < m_Chunks;
+                    chunk = m_Next.fetch_add(1, std::memory_order_relaxed)) {
+                    const size_t begin = chunk * m_Grain;
+                    (*m_Fn)(begin, std::min(begin + m_Grain, m_Count));
+                    ++done;
+                }
+                if (done != 0 && m_Done.fetch_add(done, std::memory_order_acq_rel) + done == m_Chunks)
+                    m_Done.notify_all();
+            }
+
+            void Release() {
+                if (m_Refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    delete this;
+            }
+        };
+
+        const size_t helpers = std::min(chunks - 1, g_State.m_Workers.size());
+        Range* range = new Range{ &fn, count, grain, chunks };
+        range->m_Refs.store(static_cast<uint32_t>(helpers + 1), std::memory_order_relaxed);
+        for (size_t i = 0; i < helpers; ++i) {
+            Run([range]() {
+                range->RunChunks();
+                range->Release();
+            }, { name });
+        }
+
+        range->RunChunks();
+        // Chunks still running belong to helpers that already started; block on them instead of helping.
+        for (size_t done = range->m_Done.load(std::memory_order_acquire); done != chunks;
+            done = range->m_Done.load(std::memory_order_acquire)) {
+            range->m_Done.wait(done, std::memory_order_acquire);
+        }
+        range->Release();
+    }
+
+    uint32_t JobSystem::GetWorkerCount() {
+        return g_State.m_Running.load(std::memory_order_acquire) ? static_cast<uint32_t>(g_State.m_Workers.size()) : 0;
+    }
+
+    bool JobSystem::IsMainThread() {
+        return g_State.m_Running.load(std::memory_order_acquire) && std::this_thread::get_id() == g_State.m_MainThread;
+    }
+
+    const char* JobSystem::GetCurrentJobName() {
+        return t_JobName;
+    }
+
+    void JobSystem::SetCurrentThreadName(const char* name) {
+#if defined(_WIN32)
+        wchar_t wide[64] = {};
+        MultiByteToWideChar(CP_UTF8, 0, name, -1, wide, static_cast<int>(sizeof(wide) / sizeof(wide[0])) - 1);
+        SetThreadDescription(GetCurrentThread(), wide);
+#elif defined(__APPLE__)
+        pthread_setname_np(name);
+#else
+        char truncated[16] = {};
+        std::strncpy(truncated, name, sizeof(truncated) - 1);
+        pthread_setname_np(pthread_self(), truncated);
+#endif
+    }
+
+} // namespace Nova::Core
@@ -0,0 +1,90 @@
+#include "Core/MappedFile.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace Nova::Core {
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_Data(std::exchange(other.m_Data, nullptr)),
+        m_Size(std::exchange(other.m_Size, 0)),
+        m_Handle(std::exchange(other.m_Handle, nullptr))
+    {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            m_Data = std::exchange(other.m_Data, nullptr);
+            m_Size = std::exchange(other.m_Size, 0);
+            m_Handle = std::exchange(other.m_Handle, nullptr);
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& path) {
+        Close();
+
+        std::error_code ec;
+        const uint64_t size = std::filesystem::file_size(path, ec);
+        if (ec || size == 0) return false;
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file); // the mapping keeps the file open
+        if (!mapping) return false;
+
+        const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!data) {
+            CloseHandle(mapping);
+            return false;
+        }
+        m_Handle = mapping;
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        void* data = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file open
+        if (data == MAP_FAILED) return false;
+#endif
+        m_Data = static_cast<const uint8_t*>(data);
+        m_Size = static_cast<size_t>(size);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (!m_Data) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Data);
+        if (m_Handle) CloseHandle(static_cast<HANDLE>(m_Handle));
+#else
+        ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Handle = nullptr;
+    }
+
+    void MappedFile::Prefault() const {
+        constexpr size_t kPageSize = 4096;
+        uint8_t sum = 0;
+        for (size_t offset = 0; offset < m_Size; offset += kPageSize)
+            sum ^= m_Data[offset];
+        volatile uint8_t sink = sum; // keeps the loads
+        (void)sink;
+    }
+
+} // namespace Nova::Core
@@ -0,0 +1,18 @@
+#include "Core/RenderFrame.h"
+
+namespace Nova::Core {
+
+    void RenderFrame::ExecuteCommands() {
+        for (auto& command : m_Commands)
+            command();
+        m_Commands.clear();
+    }
+
+    void RenderFrame::Reset() {
+        m_Commands.clear();
+        m_Layers.clear();
+        m_ImGui.Clear();
+        m_Scene.Clear();
+    }
+
+} // namespace Nova::Core
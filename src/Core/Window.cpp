@@ -57,6 +57,14 @@ namespace Nova::Core {
             SDL_SetRenderVSync(m_Renderer, enabled ? 1 : 0);
         }
         m_Desc.m_VSync = enabled;
+        // A VSync toggle overrides any explicit present mode.
+        m_Desc.m_PresentMode = PresentMode::Auto;
+    }
+
+    PresentMode Window::GetPresentMode() const {
+        if (m_Desc.m_PresentMode != PresentMode::Auto)
+            return m_Desc.m_PresentMode;
+        return m_Desc.m_VSync ? PresentMode::Fifo : PresentMode::Mailbox;
     }
 
     void Window::SetTitle(const char* title) {
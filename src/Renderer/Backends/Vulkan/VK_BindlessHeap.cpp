@@ -0,0 +1,280 @@
+#include "Renderer/Backends/Vulkan/VK_BindlessHeap.h"
+#include "Renderer/Backends/Vulkan/VK_Common.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorLayoutCache.h"
+
+#include "Core/Assert.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    // --- SlotAllocator ---
+    uint32_t VK_BindlessHeap::SlotAllocator::Allocate() {
+        uint32_t index = RHI::kInvalidBindlessIndex;
+        if (!m_Free.empty()) {
+            index = m_Free.back();
+            m_Free.pop_back();
+        } else if (m_Next < m_Capacity) {
+            index = m_Next++;
+        } else {
+            return index;
+        }
+        m_Live[index] = true;
+        return index;
+    }
+
+    bool VK_BindlessHeap::SlotAllocator::Release(uint32_t index, uint64_t frame) {
+        // A slot retired twice would come back out of the free list twice, one per owner.
+        if (index >= m_Next || !m_Live[index]) {
+            NV_ASSERT_MSG(false, "VK_BindlessHeap: release of a slot that is not live");
+            return false;
+        }
+        m_Live[index] = false;
+        m_Retired.push_back({ index, frame });
+        return true;
+    }
+
+    void VK_BindlessHeap::SlotAllocator::Reclaim(uint64_t frame, uint32_t latency) {
+        // Retired in release order, so the reclaimable ones form a prefix.
+        size_t count = 0;
+        while (count < m_Retired.size() && m_Retired[count].m_Frame + latency <= frame) {
+            m_Free.push_back(m_Retired[count].m_Index);
+            ++count;
+        }
+        m_Retired.erase(m_Retired.begin(), m_Retired.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+
+    void VK_BindlessHeap::SlotAllocator::Reset(uint32_t capacity) {
+        m_Capacity = capacity;
+        m_Next = 0;
+        m_Free.clear();
+        m_Retired.clear();
+        m_Live.assign(capacity, false);
+    }
+
+    // --- VK_BindlessHeap ---
+    bool VK_BindlessHeap::Create(VkDevice device, VK_DescriptorLayoutCache& layoutCache,
+        const VkPhysicalDeviceDescriptorIndexingProperties& limits,
+        uint32_t maxTextures, uint32_t maxBuffers, uint32_t framesInFlight)
+    {
+        Destroy();
+
+        constexpr uint32_t samplerCount = static_cast<uint32_t>(RHI::BindlessSampler::Count);
+
+        // Every stage sees the heap, so the per-stage limits apply to the whole array.
+        maxTextures = std::min({ maxTextures,
+            limits.maxDescriptorSetUpdateAfterBindSampledImages,
+            limits.maxPerStageDescriptorUpdateAfterBindSampledImages });
+        maxBuffers = std::min({ maxBuffers,
+            limits.maxDescriptorSetUpdateAfterBindStorageBuffers,
+            limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers });
+        if (maxTextures == 0 || maxBuffers == 0 || limits.maxDescriptorSetUpdateAfterBindSamplers < samplerCount) {
+            NV_LOG_WARN("VK_BindlessHeap: device limits too small for a bindless heap");
+            return false;
+        }
+
+        m_Device = device;
+        m_FramesInFlight = std::max(framesInFlight, 1u);
+
+        // ---- Layout ----
+        std::vector<VkDescriptorSetLayoutBinding> bindings(3);
+        bindings[0].binding = static_cast<uint32_t>(RHI::BindlessBinding::Textures);
+        bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        bindings[0].descriptorCount = maxTextures;
+        bindings[0].stageFlags = VK_SHADER_STAGE_ALL;
+        bindings[1].binding = static_cast<uint32_t>(RHI::BindlessBinding::Samplers);
+        bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+        bindings[1].descriptorCount = samplerCount;
+        bindings[1].stageFlags = VK_SHADER_STAGE_ALL;
+        bindings[2].binding = static_cast<uint32_t>(RHI::BindlessBinding::Buffers);
+        bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[2].descriptorCount = maxBuffers;
+        bindings[2].stageFlags = VK_SHADER_STAGE_ALL;
+
+        const VkDescriptorBindingFlags arrayFlags =
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+        // Samplers are written once, before the set is ever bound.
+        const std::vector<VkDescriptorBindingFlags> bindingFlags = { arrayFlags, 0, arrayFlags };
+
+        m_SetLayout = layoutCache.GetSetLayout(bindings,
+            VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT, bindingFlags);
+        if (m_SetLayout == VK_NULL_HANDLE) {
+            NV_LOG_WARN("VK_BindlessHeap: failed to create set layout");
+            Destroy();
+            return false;
+        }
+
+        // ---- Pool + set ----
+        const VkDescriptorPoolSize poolSizes[] = {
+            { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, maxTextures },
+            { VK_DESCRIPTOR_TYPE_SAMPLER, samplerCount },
+            { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, maxBuffers },
+        };
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        poolInfo.maxSets = 1;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(std::size(poolSizes));
+        poolInfo.pPoolSizes = poolSizes;
+        VkResult res = vkCreateDescriptorPool(m_Device, &poolInfo, nullptr, &m_Pool);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_BindlessHeap: failed to create descriptor pool");
+            Destroy();
+            return false;
+        }
+
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_Pool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &m_SetLayout;
+        res = vkAllocateDescriptorSets(m_Device, &allocInfo, &m_DescriptorSet);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_BindlessHeap: failed to allocate descriptor set");
+            Destroy();
+            return false;
+        }
+
+        // ---- Fixed samplers (RHI::BindlessSampler order) ----
+        for (uint32_t i = 0; i < samplerCount; ++i) {
+            const bool linear = (i == static_cast<uint32_t>(RHI::BindlessSampler::LinearClamp) ||
+                                 i == static_cast<uint32_t>(RHI::BindlessSampler::LinearRepeat));
+            const bool repeat = (i == static_cast<uint32_t>(RHI::BindlessSampler::LinearRepeat) ||
+                                 i == static_cast<uint32_t>(RHI::BindlessSampler::NearestRepeat));
+
+            VkSamplerCreateInfo samplerInfo{};
+            samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+            samplerInfo.magFilter = linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+            samplerInfo.minFilter = linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+            samplerInfo.mipmapMode = linear ? VK_SAMPLER_MIPMAP_MODE_LINEAR : VK_SAMPLER_MIPMAP_MODE_NEAREST;
+            const VkSamplerAddressMode mode = repeat ? VK_SAMPLER_ADDRESS_MODE_REPEAT : VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+            samplerInfo.addressModeU = mode;
+            samplerInfo.addressModeV = mode;
+            samplerInfo.addressModeW = mode;
+            samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+            res = vkCreateSampler(m_Device, &samplerInfo, nullptr, &m_Samplers[i]);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) {
+                NV_LOG_WARN("VK_BindlessHeap: failed to create sampler");
+                Destroy();
+                return false;
+            }
+
+            VkDescriptorImageInfo ii{};
+            ii.sampler = m_Samplers[i];
+            Write(RHI::BindlessBinding::Samplers, i, VK_DESCRIPTOR_TYPE_SAMPLER, &ii, nullptr);
+        }
+
+        m_Textures.Reset(maxTextures);
+        m_Buffers.Reset(maxBuffers);
+        m_Frame = 0;
+
+        NV_LOG_INFO(("VK_BindlessHeap created (" + std::to_string(maxTextures) + " textures, " +
+            std::to_string(maxBuffers) + " buffers).").c_str());
+        return true;
+    }
+
+    void VK_BindlessHeap::Destroy() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE) return;
+
+        for (VkSampler& sampler : m_Samplers) {
+            if (sampler != VK_NULL_HANDLE) vkDestroySampler(m_Device, sampler, nullptr);
+            sampler = VK_NULL_HANDLE;
+        }
+        // Destroying the pool frees the set.
+        if (m_Pool != VK_NULL_HANDLE) vkDestroyDescriptorPool(m_Device, m_Pool, nullptr);
+
+        m_Pool = VK_NULL_HANDLE;
+        m_DescriptorSet = VK_NULL_HANDLE;
+        m_SetLayout = VK_NULL_HANDLE;
+        m_Textures.Reset(0);
+        m_Buffers.Reset(0);
+        m_Device = VK_NULL_HANDLE;
+    }
+
+    void VK_BindlessHeap::Write(RHI::BindlessBinding binding, uint32_t index, VkDescriptorType type,
+        const VkDescriptorImageInfo* imageInfo, const VkDescriptorBufferInfo* bufferInfo)
+    {
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_DescriptorSet;
+        write.dstBinding = static_cast<uint32_t>(binding);
+        write.dstArrayElement = index;
+        write.descriptorCount = 1;
+        write.descriptorType = type;
+        write.pImageInfo = imageInfo;
+        write.pBufferInfo = bufferInfo;
+        vkUpdateDescriptorSets(m_Device, 1, &write, 0, nullptr);
+    }
+
+    uint32_t VK_BindlessHeap::RegisterTexture(VkImageView view, VkImageLayout layout) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_DescriptorSet == VK_NULL_HANDLE || view == VK_NULL_HANDLE) return RHI::kInvalidBindlessIndex;
+
+        const uint32_t index = m_Textures.Allocate();
+        if (index == RHI::kInvalidBindlessIndex) {
+            NV_LOG_WARN("VK_BindlessHeap: texture heap is full");
+            return index;
+        }
+
+        VkDescriptorImageInfo ii{};
+        ii.imageView = view;
+        ii.imageLayout = layout;
+        Write(RHI::BindlessBinding::Textures, index, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, &ii, nullptr);
+        return index;
+    }
+
+    uint32_t VK_BindlessHeap::RegisterBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_DescriptorSet == VK_NULL_HANDLE || buffer == VK_NULL_HANDLE) return RHI::kInvalidBindlessIndex;
+
+        const uint32_t index = m_Buffers.Allocate();
+        if (index == RHI::kInvalidBindlessIndex) {
+            NV_LOG_WARN("VK_BindlessHeap: buffer heap is full");
+            return index;
+        }
+
+        VkDescriptorBufferInfo bi{};
+        bi.buffer = buffer;
+        bi.offset = offset;
+        bi.range = range;
+        Write(RHI::BindlessBinding::Buffers, index, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, nullptr, &bi);
+        return index;
+    }
+
+    void VK_BindlessHeap::ReleaseTexture(uint32_t index) {
+        if (index == RHI::kInvalidBindlessIndex) return;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Textures.Release(index, m_Frame)) {
+            NV_LOG_WARN((std::string("VK_BindlessHeap: ignoring release of texture slot ") +
+                std::to_string(index) + " (not live)").c_str());
+        }
+    }
+
+    void VK_BindlessHeap::ReleaseBuffer(uint32_t index) {
+        if (index == RHI::kInvalidBindlessIndex) return;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Buffers.Release(index, m_Frame)) {
+            NV_LOG_WARN((std::string("VK_BindlessHeap: ignoring release of buffer slot ") +
+                std::to_string(index) + " (not live)").c_str());
+        }
+    }
+
+    void VK_BindlessHeap::BeginFrame() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        ++m_Frame;
+        // Partially bound: a recycled slot keeps its stale descriptor until rewritten, which is
+        // fine since nothing may read it once released.
+        m_Textures.Reclaim(m_Frame, m_FramesInFlight);
+        m_Buffers.Reclaim(m_Frame, m_FramesInFlight);
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
@@ -0,0 +1,172 @@
+#include "Renderer/Backends/Vulkan/VK_Buffer.h"
+#include "Renderer/Backends/Vulkan/VK_Common.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    static uint32_t FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties) {
+        VkPhysicalDeviceMemoryProperties memProps;
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProps);
+
+        for (uint32_t i = 0; i < memProps.memoryTypeCount; ++i) {
+            if ((typeFilter & (1u << i)) &&
+                (memProps.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                return i;
+            }
+        }
+        return UINT32_MAX;
+    }
+
+    static VkBufferUsageFlags ToVkBufferUsage(RHI::RHI_BufferUsage usage) {
+        using BU = RHI::RHI_BufferUsage;
+        VkBufferUsageFlags out = 0;
+        if (RHI::HasUsage(usage, BU::Storage))     out |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        if (RHI::HasUsage(usage, BU::Uniform))     out |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        if (RHI::HasUsage(usage, BU::Indirect))    out |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        if (RHI::HasUsage(usage, BU::Vertex))      out |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+        if (RHI::HasUsage(usage, BU::Index))       out |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+        if (RHI::HasUsage(usage, BU::TransferSrc)) out |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        if (RHI::HasUsage(usage, BU::TransferDst)) out |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        return out;
+    }
+
+    bool VK_Buffer::Create(VkPhysicalDevice physicalDevice, VkDevice device,
+        const RHI::RHI_BufferDesc& desc, const std::vector<uint32_t>& queueFamilies)
+    {
+        Destroy();
+
+        if (device == VK_NULL_HANDLE || desc.m_Size == 0) {
+            NV_LOG_ERROR("VK_Buffer::Create - invalid device or zero size");
+            return false;
+        }
+
+        m_Desc = desc;
+        m_Device = device;
+
+        std::vector<uint32_t> families = queueFamilies;
+        std::sort(families.begin(), families.end());
+        families.erase(std::unique(families.begin(), families.end()), families.end());
+        families.erase(std::remove(families.begin(), families.end(), UINT32_MAX), families.end());
+
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = desc.m_Size;
+        bufferInfo.usage = ToVkBufferUsage(desc.m_Usage) | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        if (families.size() > 1) {
+            bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            bufferInfo.queueFamilyIndexCount = static_cast<uint32_t>(families.size());
+            bufferInfo.pQueueFamilyIndices = families.data();
+        }
+        else {
+            bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        }
+
+        VkResult res = vkCreateBuffer(m_Device, &bufferInfo, nullptr, &m_Buffer);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_ERROR(("VK_Buffer::Create - vkCreateBuffer failed for '" + desc.m_DebugName + "'").c_str());
+            Destroy();
+            return false;
+        }
+
+        VkMemoryRequirements memReq;
+        vkGetBufferMemoryRequirements(m_Device, m_Buffer, &memReq);
+
+        uint32_t memTypeIndex = UINT32_MAX;
+        switch (desc.m_Memory) {
+        case RHI::RHI_MemoryUsage::GpuOnly:
+            memTypeIndex = FindMemoryType(physicalDevice, memReq.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+            break;
+        case RHI::RHI_MemoryUsage::CpuToGpu:
+            memTypeIndex = FindMemoryType(physicalDevice, memReq.memoryTypeBits,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            break;
+        case RHI::RHI_MemoryUsage::GpuToCpu:
+            memTypeIndex = FindMemoryType(physicalDevice, memReq.memoryTypeBits,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+            if (memTypeIndex == UINT32_MAX) {
+                memTypeIndex = FindMemoryType(physicalDevice, memReq.memoryTypeBits,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            }
+            break;
+        }
+
+        if (memTypeIndex == UINT32_MAX) {
+            NV_LOG_ERROR(("VK_Buffer::Create - no suitable memory type for '" + desc.m_DebugName + "'").c_str());
+            Destroy();
+            return false;
+        }
+
+        VkPhysicalDeviceMemoryProperties memProps;
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProps);
+        m_HostCoherent = (memProps.memoryTypes[memTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memReq.size;
+        allocInfo.memoryTypeIndex = memTypeIndex;
+
+        res = vkAllocateMemory(m_Device, &allocInfo, nullptr, &m_Memory);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            Destroy();
+            return false;
+        }
+
+        vkBindBufferMemory(m_Device, m_Buffer, m_Memory, 0);
+
+        if (desc.m_Memory != RHI::RHI_MemoryUsage::GpuOnly) {
+            res = vkMapMemory(m_Device, m_Memory, 0, VK_WHOLE_SIZE, 0, &m_Mapped);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) {
+                Destroy();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void VK_Buffer::Destroy() {
+        if (m_Device == VK_NULL_HANDLE)
+            return;
+
+        if (m_Mapped) {
+            vkUnmapMemory(m_Device, m_Memory);
+            m_Mapped = nullptr;
+        }
+        if (m_Buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(m_Device, m_Buffer, nullptr);
+            m_Buffer = VK_NULL_HANDLE;
+        }
+        if (m_Memory != VK_NULL_HANDLE) {
+            vkFreeMemory(m_Device, m_Memory, nullptr);
+            m_Memory = VK_NULL_HANDLE;
+        }
+        m_Device = VK_NULL_HANDLE;
+    }
+
+    bool VK_Buffer::Write(const void* data, uint64_t size, uint64_t offset) {
+        if (!m_Mapped || !data || offset + size > m_Desc.m_Size)
+            return false;
+
+        std::memcpy(static_cast<char*>(m_Mapped) + offset, data, static_cast<size_t>(size));
+
+        if (!m_HostCoherent) {
+            VkMappedMemoryRange range{};
+            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = m_Memory;
+            range.offset = 0;
+            range.size = VK_WHOLE_SIZE;
+            vkFlushMappedMemoryRanges(m_Device, 1, &range);
+        }
+        return true;
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
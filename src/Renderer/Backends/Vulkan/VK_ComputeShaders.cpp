@@ -0,0 +1,207 @@
+#include "Renderer/Backends/Vulkan/VK_ComputeShaders.h"
+#include "Renderer/Backends/Vulkan/VK_BindlessHeap.h"
+#include "Renderer/Backends/Vulkan/VK_Common.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorAllocator.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorLayoutCache.h"
+#include "Renderer/Backends/Vulkan/VK_Shaders.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    static VkDescriptorType ToVkDescriptorType(RHI::RHI_ResourceKind kind) {
+        using RK = RHI::RHI_ResourceKind;
+        switch (kind) {
+            case RK::ConstantBuffer: return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            case RK::StorageBuffer:  return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            case RK::RWBuffer:       return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            case RK::Texture:        return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            case RK::Sampler:        return VK_DESCRIPTOR_TYPE_SAMPLER;
+            case RK::CombinedTextureSampler: return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            case RK::RWTexture:      return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            default:                 return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        }
+    }
+
+    bool VK_ComputeShaders::Create(VkDevice device, VK_DescriptorAllocator& transientDescriptors, VK_DescriptorLayoutCache& layoutCache,
+        const VK_BindlessHeap* bindlessHeap, const std::vector<uint8_t>& spirv, const RHI::RHI_ProgramReflection& reflection,
+        const char* entryPoint)
+    {
+        Destroy();
+
+        m_Device = device;
+        m_TransientDescriptors = &transientDescriptors;
+        SetReflection(reflection);
+
+        // ---- Set layouts (0..maxSet, compute stage only) ----
+        const uint32_t setCount = reflection.m_Sets.empty() ? 0u : reflection.m_Sets.back().m_Set + 1u;
+        m_SetLayouts.assign(setCount, VK_NULL_HANDLE);
+        m_Sets.assign(setCount, TransientSet{});
+
+        for (uint32_t setIndex = 0; setIndex < setCount; ++setIndex) {
+            // Shaders that include Bindless.slang share the global heap set instead of getting their own.
+            if (setIndex == RHI::kBindlessDescriptorSet && bindlessHeap && bindlessHeap->IsValid() && reflection.FindSet(setIndex)) {
+                m_SetLayouts[setIndex] = bindlessHeap->GetSetLayout();
+                m_BindlessSet = bindlessHeap->GetDescriptorSet();
+                continue;
+            }
+
+            std::vector<VkDescriptorSetLayoutBinding> bindings;
+            if (const auto* set = reflection.FindSet(setIndex)) {
+                bindings.reserve(set->m_Bindings.size());
+                for (const auto& b : set->m_Bindings) {
+                    const VkDescriptorType type = ToVkDescriptorType(b.m_Kind);
+                    if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) continue;
+
+                    VkDescriptorSetLayoutBinding vkB{};
+                    vkB.binding = b.m_Key.m_Binding;
+                    vkB.descriptorType = type;
+                    vkB.descriptorCount = (b.m_ArrayCount == 0) ? 1u : b.m_ArrayCount;
+                    vkB.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+                    bindings.push_back(vkB);
+                }
+            }
+
+            m_Sets[setIndex].m_HasBindings = !bindings.empty();
+            m_SetLayouts[setIndex] = layoutCache.GetSetLayout(std::move(bindings));
+            if (m_SetLayouts[setIndex] == VK_NULL_HANDLE) {
+                NV_LOG_WARN("VK_ComputeShaders: failed to create descriptor set layout");
+                Destroy();
+                return false;
+            }
+        }
+
+        // ---- Pipeline layout ----
+        VkPushConstantRange pushRange{};
+        if (reflection.m_PushConstants && reflection.m_PushConstants->m_SizeBytes > 0) {
+            m_PushConstantSize = static_cast<uint32_t>(reflection.m_PushConstants->m_SizeBytes);
+            m_PushConstantData.assign(m_PushConstantSize, 0);
+            pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+            pushRange.offset = 0;
+            pushRange.size = m_PushConstantSize;
+        }
+
+        std::vector<VkPushConstantRange> pushRanges;
+        if (m_PushConstantSize > 0) pushRanges.push_back(pushRange);
+
+        m_PipelineLayout = layoutCache.GetPipelineLayout(m_SetLayouts, pushRanges);
+        if (m_PipelineLayout == VK_NULL_HANDLE) {
+            Destroy();
+            return false;
+        }
+
+        // ---- Pipeline ----
+        VK_ShaderModule module;
+        if (!module.Create(m_Device, spirv)) {
+            NV_LOG_WARN("VK_ComputeShaders: failed to create shader module");
+            Destroy();
+            return false;
+        }
+
+        VkComputePipelineCreateInfo pipe{};
+        pipe.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipe.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipe.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipe.stage.module = module.GetModule();
+        pipe.stage.pName = entryPoint;
+        pipe.layout = m_PipelineLayout;
+
+        VkResult res = vkCreateComputePipelines(m_Device, VK_NULL_HANDLE, 1, &pipe, nullptr, &m_Pipeline);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_ComputeShaders: compute pipeline creation failed");
+            Destroy();
+            return false;
+        }
+
+        return true;
+    }
+
+    void VK_ComputeShaders::Destroy() {
+        if (m_Device == VK_NULL_HANDLE)
+            return;
+
+        if (m_Pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(m_Device, m_Pipeline, nullptr);
+            m_Pipeline = VK_NULL_HANDLE;
+        }
+        m_PipelineLayout = VK_NULL_HANDLE; // owned by the layout cache
+        // Descriptor sets are transient: the allocator reclaims them with their frame.
+        m_Sets.clear();
+        m_SetLayouts.clear();
+        m_BindlessSet = VK_NULL_HANDLE; // owned by the bindless heap
+        m_PushConstantData.clear();
+        m_PushConstantSize = 0;
+
+        m_Device = VK_NULL_HANDLE;
+        m_TransientDescriptors = nullptr;
+    }
+
+    void VK_ComputeShaders::SetPushConstants(const void* data, uint32_t size) {
+        if (!data || m_PushConstantSize == 0) return;
+        std::memcpy(m_PushConstantData.data(), data, std::min(size, m_PushConstantSize));
+    }
+
+    bool VK_ComputeShaders::ApplyResourceBinding(const RHI::RHI_BindingInfo& info, const RHI::RHI_ResourceBinding& value) {
+        const uint32_t setIndex = info.m_Key.m_Set;
+        if (m_Device == VK_NULL_HANDLE || setIndex >= m_Sets.size() || !m_Sets[setIndex].m_HasBindings)
+            return false;
+
+        const VkDescriptorType type = ToVkDescriptorType(info.m_Kind);
+        if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) return false;
+
+        // Recorded only: the next ApplyParameters() writes a fresh transient set, so frames
+        // still in flight keep reading the values they were recorded with.
+        VK_DescriptorWrite write;
+        if (!MakeDescriptorWrite(info.m_Key.m_Binding, type, value, write)) return false;
+        StoreDescriptorWrite(m_Sets[setIndex].m_Writes, write);
+        m_Sets[setIndex].m_Dirty = true;
+        return true;
+    }
+
+    void VK_ComputeShaders::Bind(void* apiContext) {
+        if (!apiContext || m_Pipeline == VK_NULL_HANDLE) return;
+        VkCommandBuffer cmd = static_cast<VkCommandBuffer>(apiContext);
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_Pipeline);
+    }
+
+    void VK_ComputeShaders::ApplyParameters(void* apiContext) {
+        if (!apiContext || m_PipelineLayout == VK_NULL_HANDLE) return;
+        VkCommandBuffer cmd = static_cast<VkCommandBuffer>(apiContext);
+
+        const uint64_t frameSerial = m_TransientDescriptors ? m_TransientDescriptors->GetFrameSerial() : 0;
+        for (uint32_t setIndex = 0; setIndex < m_Sets.size(); ++setIndex) {
+            TransientSet& set = m_Sets[setIndex];
+            if (!set.m_HasBindings || set.m_Writes.empty()) continue;
+
+            // A set stays valid for the frame it was allocated in; reuse it until a binding changes.
+            if (set.m_Dirty || set.m_Set == VK_NULL_HANDLE || set.m_FrameSerial != frameSerial) {
+                set.m_Set = m_TransientDescriptors ? m_TransientDescriptors->Allocate(m_SetLayouts[setIndex]) : VK_NULL_HANDLE;
+                if (set.m_Set == VK_NULL_HANDLE) continue;
+                ApplyDescriptorWrites(m_Device, set.m_Set, set.m_Writes);
+                set.m_FrameSerial = frameSerial;
+                set.m_Dirty = false;
+            }
+
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout,
+                setIndex, 1, &set.m_Set, 0, nullptr);
+        }
+        if (m_BindlessSet != VK_NULL_HANDLE) {
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout,
+                RHI::kBindlessDescriptorSet, 1, &m_BindlessSet, 0, nullptr);
+        }
+
+        if (m_PushConstantSize > 0) {
+            vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                0, m_PushConstantSize, m_PushConstantData.data());
+        }
+    }
+
+    void* VK_ComputeShaders::GetNativeHandle() const {
+        return reinterpret_cast<void*>(m_Pipeline);
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
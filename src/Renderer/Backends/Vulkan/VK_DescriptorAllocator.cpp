@@ -0,0 +1,216 @@
+#include "Renderer/Backends/Vulkan/VK_DescriptorAllocator.h"
+#include "Renderer/Backends/Vulkan/VK_Common.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    // Descriptors reserved per set, by type. Post-process and compute sets are small and
+    // buffer/image heavy; a pool that runs out of one type is simply replaced by the next one.
+    struct PoolRatio {
+        VkDescriptorType m_Type;
+        float m_PerSet;
+    };
+    static constexpr PoolRatio kPoolRatios[] = {
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         2.0f },
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.0f },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         4.0f },
+        { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,          4.0f },
+        { VK_DESCRIPTOR_TYPE_SAMPLER,                1.0f },
+        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4.0f },
+        { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          2.0f },
+    };
+    static constexpr uint32_t kMaxSetsPerPool = 4096;
+
+    bool MakeDescriptorWrite(uint32_t binding, VkDescriptorType type,
+        const RHI::RHI_ResourceBinding& value, VK_DescriptorWrite& out)
+    {
+        out = {};
+        out.m_Binding = binding;
+        out.m_Type = type;
+
+        if (std::holds_alternative<RHI::RHI_BufferBinding>(value)) {
+            const auto& b = std::get<RHI::RHI_BufferBinding>(value);
+            out.m_BufferInfo.buffer = reinterpret_cast<VkBuffer>(b.m_Handle);
+            out.m_BufferInfo.offset = static_cast<VkDeviceSize>(b.m_Offset);
+            out.m_BufferInfo.range = (b.m_Range == 0) ? VK_WHOLE_SIZE : static_cast<VkDeviceSize>(b.m_Range);
+            return true;
+        }
+        if (std::holds_alternative<RHI::RHI_TextureBinding>(value)) {
+            const auto& t = std::get<RHI::RHI_TextureBinding>(value);
+            // Storage images live in GENERAL (see VK_StorageImage); sampled images default to read-only.
+            const VkImageLayout defaultLayout = (type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE)
+                ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            out.m_ImageInfo.imageView = reinterpret_cast<VkImageView>(t.m_TextureHandle);
+            out.m_ImageInfo.imageLayout = (t.m_ImageLayout == 0) ? defaultLayout : static_cast<VkImageLayout>(t.m_ImageLayout);
+            return true;
+        }
+        if (std::holds_alternative<RHI::RHI_SamplerBinding>(value)) {
+            const auto& s = std::get<RHI::RHI_SamplerBinding>(value);
+            out.m_ImageInfo.sampler = reinterpret_cast<VkSampler>(s.m_SamplerHandle);
+            return true;
+        }
+        return false;
+    }
+
+    void StoreDescriptorWrite(std::vector<VK_DescriptorWrite>& writes, const VK_DescriptorWrite& write) {
+        auto it = std::find_if(writes.begin(), writes.end(),
+            [&write](const VK_DescriptorWrite& w) { return w.m_Binding == write.m_Binding; });
+        if (it != writes.end()) *it = write;
+        else writes.push_back(write);
+    }
+
+    void ApplyDescriptorWrites(VkDevice device, VkDescriptorSet set, const std::vector<VK_DescriptorWrite>& writes) {
+        if (device == VK_NULL_HANDLE || set == VK_NULL_HANDLE || writes.empty()) return;
+
+        std::vector<VkWriteDescriptorSet> vkWrites;
+        vkWrites.reserve(writes.size());
+        for (const auto& w : writes) {
+            const bool isBuffer =
+                w.m_Type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || w.m_Type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+                w.m_Type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER || w.m_Type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+
+            VkWriteDescriptorSet write{};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = set;
+            write.dstBinding = w.m_Binding;
+            write.dstArrayElement = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = w.m_Type;
+            write.pBufferInfo = isBuffer ? &w.m_BufferInfo : nullptr;
+            write.pImageInfo = isBuffer ? nullptr : &w.m_ImageInfo;
+            vkWrites.push_back(write);
+        }
+        vkUpdateDescriptorSets(device, static_cast<uint32_t>(vkWrites.size()), vkWrites.data(), 0, nullptr);
+    }
+
+    // --- VK_DescriptorAllocator ---
+    bool VK_DescriptorAllocator::Create(VkDevice device, uint32_t framesInFlight, uint32_t initialSetsPerPool) {
+        Destroy();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Device = device;
+        m_Frames.assign(std::max(framesInFlight, 1u), Frame{});
+        m_FrameIndex = 0;
+        m_NextPoolSets = std::clamp(initialSetsPerPool, 1u, kMaxSetsPerPool);
+        m_FrameSerial = 1;
+        return m_Device != VK_NULL_HANDLE;
+    }
+
+    void VK_DescriptorAllocator::Destroy() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE) return;
+
+        for (VkDescriptorPool pool : m_AllPools) {
+            vkDestroyDescriptorPool(m_Device, pool, nullptr);
+        }
+        m_AllPools.clear();
+        m_FreePools.clear();
+        m_Frames.clear();
+        m_Device = VK_NULL_HANDLE;
+    }
+
+    void VK_DescriptorAllocator::BeginFrame(uint32_t frameIndex) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE || m_Frames.empty()) return;
+
+        m_FrameIndex = frameIndex % static_cast<uint32_t>(m_Frames.size());
+        ++m_FrameSerial;
+
+        // Keep the frame's first pool (the common case needs exactly one), hand the rest back.
+        Frame& frame = m_Frames[m_FrameIndex];
+        for (size_t i = 0; i < frame.m_Pools.size(); ++i) {
+            CheckVkResult(vkResetDescriptorPool(m_Device, frame.m_Pools[i], 0));
+            if (i > 0) m_FreePools.push_back(frame.m_Pools[i]);
+        }
+        if (frame.m_Pools.size() > 1) frame.m_Pools.resize(1);
+    }
+
+    VkDescriptorPool VK_DescriptorAllocator::AcquirePool() {
+        if (!m_FreePools.empty()) {
+            VkDescriptorPool pool = m_FreePools.back();
+            m_FreePools.pop_back();
+            return pool;
+        }
+
+        const uint32_t sets = m_NextPoolSets;
+        std::vector<VkDescriptorPoolSize> sizes;
+        sizes.reserve(std::size(kPoolRatios));
+        for (const auto& ratio : kPoolRatios) {
+            sizes.push_back({ ratio.m_Type, std::max(1u, static_cast<uint32_t>(ratio.m_PerSet * static_cast<float>(sets))) });
+        }
+
+        VkDescriptorPoolCreateInfo info{};
+        info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        info.flags = 0; // reset wholesale, never freed per set
+        info.maxSets = sets;
+        info.poolSizeCount = static_cast<uint32_t>(sizes.size());
+        info.pPoolSizes = sizes.data();
+
+        VkDescriptorPool pool = VK_NULL_HANDLE;
+        const VkResult res = vkCreateDescriptorPool(m_Device, &info, nullptr, &pool);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_DescriptorAllocator: failed to create descriptor pool");
+            return VK_NULL_HANDLE;
+        }
+
+        m_AllPools.push_back(pool);
+        m_NextPoolSets = std::min(sets * 2, kMaxSetsPerPool);
+        if (m_AllPools.size() > m_Frames.size()) {
+            NV_LOG_INFO(("VK_DescriptorAllocator: grew to " + std::to_string(m_AllPools.size()) + " pools").c_str());
+        }
+        return pool;
+    }
+
+    VkDescriptorSet VK_DescriptorAllocator::Allocate(VkDescriptorSetLayout layout) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE || m_Frames.empty() || layout == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+
+        Frame& frame = m_Frames[m_FrameIndex];
+        if (frame.m_Pools.empty()) {
+            VkDescriptorPool pool = AcquirePool();
+            if (pool == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+            frame.m_Pools.push_back(pool);
+        }
+
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &layout;
+
+        VkDescriptorSet set = VK_NULL_HANDLE;
+        allocInfo.descriptorPool = frame.m_Pools.back();
+        VkResult res = vkAllocateDescriptorSets(m_Device, &allocInfo, &set);
+        if (res == VK_ERROR_OUT_OF_POOL_MEMORY || res == VK_ERROR_FRAGMENTED_POOL) {
+            // Current pool is exhausted: move on to another one for the rest of the frame.
+            VkDescriptorPool pool = AcquirePool();
+            if (pool == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+            frame.m_Pools.push_back(pool);
+
+            allocInfo.descriptorPool = pool;
+            res = vkAllocateDescriptorSets(m_Device, &allocInfo, &set);
+        }
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_DescriptorAllocator: failed to allocate descriptor set");
+            return VK_NULL_HANDLE;
+        }
+        return set;
+    }
+
+    uint64_t VK_DescriptorAllocator::GetFrameSerial() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_FrameSerial;
+    }
+
+    size_t VK_DescriptorAllocator::GetPoolCount() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_AllPools.size();
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
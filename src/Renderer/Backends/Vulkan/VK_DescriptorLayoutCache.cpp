@@ -0,0 +1,268 @@
+#include "Renderer/Backends/Vulkan/VK_DescriptorLayoutCache.h"
+#include "Renderer/Backends/Vulkan/VK_Common.h"
+
+#include "Core/Hash.h"
+#include "Core/Log.h"
+#include "Renderer/RHI/RHI_ShaderUniforms.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    VkShaderStageFlags ToVkStageFlags(RHI::RHI_ShaderStageMask mask) {
+        VkShaderStageFlags out = 0;
+        const uint32_t m = static_cast<uint32_t>(mask);
+        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Vertex)) out |= VK_SHADER_STAGE_VERTEX_BIT;
+        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Fragment)) out |= VK_SHADER_STAGE_FRAGMENT_BIT;
+        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Geometry)) out |= VK_SHADER_STAGE_GEOMETRY_BIT;
+        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::TessCtrl)) out |= VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::TessEval)) out |= VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Compute)) out |= VK_SHADER_STAGE_COMPUTE_BIT;
+        return out;
+    }
+
+    VkDescriptorType ToVkDescriptorType(const RHI::RHI_BindingInfo& b) {
+        using RK = RHI::RHI_ResourceKind;
+        switch (b.m_Kind) {
+            case RK::ConstantBuffer: return b.m_IsDynamicUniformBuffer ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            case RK::StorageBuffer:  return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            case RK::Texture:        return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            case RK::Sampler:        return VK_DESCRIPTOR_TYPE_SAMPLER;
+            case RK::CombinedTextureSampler: return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            case RK::RWTexture:      return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            case RK::RWBuffer:       return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            default:                 return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        }
+    }
+
+    size_t VK_DescriptorLayoutCache::KeyHash::operator()(const Key& key) const {
+        return static_cast<size_t>(HashBytes128(key.data(), key.size() * sizeof(uint64_t)).m_Low);
+    }
+
+    void VK_DescriptorLayoutCache::Create(VkDevice device) {
+        Destroy();
+        m_Device = device;
+    }
+
+    void VK_DescriptorLayoutCache::Destroy() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE) return;
+
+        // Pipeline layouts reference set layouts: destroy them first.
+        for (auto& [key, layout] : m_PipelineLayouts) {
+            vkDestroyPipelineLayout(m_Device, layout, nullptr);
+        }
+        for (auto& [key, layout] : m_SetLayouts) {
+            vkDestroyDescriptorSetLayout(m_Device, layout, nullptr);
+        }
+        m_PipelineLayouts.clear();
+        m_SetLayouts.clear();
+        m_Device = VK_NULL_HANDLE;
+    }
+
+    VkDescriptorSetLayout VK_DescriptorLayoutCache::GetSetLayout(std::vector<VkDescriptorSetLayoutBinding> bindings,
+        VkDescriptorSetLayoutCreateFlags flags, const std::vector<VkDescriptorBindingFlags>& bindingFlags)
+    {
+        if (!bindingFlags.empty() && bindingFlags.size() != bindings.size()) {
+            NV_LOG_WARN("VK_DescriptorLayoutCache: binding flags do not match the binding list");
+            return VK_NULL_HANDLE;
+        }
+
+        // Sort bindings and their flags together.
+        std::vector<size_t> order(bindings.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(),
+            [&bindings](size_t a, size_t b) { return bindings[a].binding < bindings[b].binding; });
+
+        std::vector<VkDescriptorSetLayoutBinding> sorted;
+        std::vector<VkDescriptorBindingFlags> sortedFlags;
+        sorted.reserve(bindings.size());
+        sortedFlags.reserve(bindingFlags.size());
+        for (size_t i : order) {
+            sorted.push_back(bindings[i]);
+            if (!bindingFlags.empty()) sortedFlags.push_back(bindingFlags[i]);
+        }
+        bindings = std::move(sorted);
+
+        Key key;
+        key.reserve(1 + bindings.size() * 3);
+        key.push_back(flags);
+        for (size_t i = 0; i < bindings.size(); ++i) {
+            const auto& b = bindings[i];
+            // Immutable samplers are not used by reflected layouts and are not part of the key.
+            key.push_back((static_cast<uint64_t>(b.binding) << 32) | static_cast<uint32_t>(b.descriptorType));
+            key.push_back((static_cast<uint64_t>(b.descriptorCount) << 32) | b.stageFlags);
+            if (!sortedFlags.empty()) key.push_back(sortedFlags[i]);
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+        if (auto it = m_SetLayouts.find(key); it != m_SetLayouts.end()) {
+            return it->second;
+        }
+
+        VkDescriptorSetLayoutCreateInfo info{};
+        info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        info.flags = flags;
+        info.bindingCount = static_cast<uint32_t>(bindings.size());
+        info.pBindings = bindings.data();
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo{};
+        if (!sortedFlags.empty()) {
+            flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+            flagsInfo.bindingCount = static_cast<uint32_t>(sortedFlags.size());
+            flagsInfo.pBindingFlags = sortedFlags.data();
+            info.pNext = &flagsInfo;
+        }
+
+        VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+        const VkResult res = vkCreateDescriptorSetLayout(m_Device, &info, nullptr, &layout);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_DescriptorLayoutCache: failed to create descriptor set layout");
+            return VK_NULL_HANDLE;
+        }
+
+        m_SetLayouts.emplace(std::move(key), layout);
+        return layout;
+    }
+
+    VkDescriptorSetLayout VK_DescriptorLayoutCache::GetSetLayout(const RHI::RHI_ProgramReflection& refl, uint32_t setIndex) {
+        const auto* set = refl.FindSet(setIndex);
+        if ((!set || set->m_Bindings.empty()) && setIndex != RHI::kUserDescriptorSet) return VK_NULL_HANDLE;
+
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+        if (set) {
+            bindings.reserve(set->m_Bindings.size());
+            for (const auto& b : set->m_Bindings) {
+                const VkDescriptorType type = ToVkDescriptorType(b);
+                if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) continue;
+
+                VkDescriptorSetLayoutBinding vkB{};
+                vkB.binding = b.m_Key.m_Binding;
+                vkB.descriptorType = type;
+                vkB.descriptorCount = (b.m_ArrayCount == 0) ? 1u : b.m_ArrayCount;
+                vkB.stageFlags = ToVkStageFlags(b.m_Stages);
+                bindings.push_back(vkB);
+            }
+        }
+
+        // Safety net for the user set: ensure binding 0 exists. This matches the common case (first
+        // user cbuffer at binding 0) and avoids a pipeline-layout mismatch when reflection is incomplete.
+        if (setIndex == RHI::kUserDescriptorSet) {
+            const bool has0 = std::any_of(bindings.begin(), bindings.end(),
+                [](const VkDescriptorSetLayoutBinding& b) { return b.binding == 0; });
+            if (!has0) {
+                VkDescriptorSetLayoutBinding vkB{};
+                vkB.binding = 0;
+                vkB.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                vkB.descriptorCount = 1;
+                vkB.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+                bindings.push_back(vkB);
+            }
+        }
+
+        if (bindings.empty()) return VK_NULL_HANDLE;
+        return GetSetLayout(std::move(bindings));
+    }
+
+    // Descriptor type of each EngineResourceSlot, in slot order (see NovaUniforms.slang).
+    static constexpr VkDescriptorType kEngineSlotTypes[] = {
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         // FrameUniforms
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, // Mvp
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         // Instances
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, // Material
+    };
+    static_assert(std::size(kEngineSlotTypes) == static_cast<size_t>(RHI::EngineResourceSlot::Count),
+        "kEngineSlotTypes must cover every EngineResourceSlot");
+
+    VkDescriptorSetLayout VK_DescriptorLayoutCache::GetEngineSetLayout() {
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+        bindings.reserve(std::size(kEngineSlotTypes));
+        for (uint32_t slot = 0; slot < std::size(kEngineSlotTypes); ++slot) {
+            VkDescriptorSetLayoutBinding vkB{};
+            vkB.binding = slot;
+            vkB.descriptorType = kEngineSlotTypes[slot];
+            vkB.descriptorCount = 1;
+            vkB.stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS;
+            bindings.push_back(vkB);
+        }
+        return GetSetLayout(std::move(bindings));
+    }
+
+    bool VK_DescriptorLayoutCache::IsEngineSetCompatible(const RHI::RHI_ProgramReflection& refl, const char* who) {
+        const auto* set = refl.FindSet(RHI::kEngineDescriptorSet);
+        if (!set) return true;
+
+        for (const auto& b : set->m_Bindings) {
+            const uint32_t slot = b.m_Key.m_Binding;
+            VkDescriptorType type = ToVkDescriptorType(b);
+            if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) continue;
+            // Reflection cannot tell dynamic uniform buffers apart; the engine decides which are.
+            if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER && slot < std::size(kEngineSlotTypes) &&
+                kEngineSlotTypes[slot] == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+            {
+                type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            }
+            if (slot >= std::size(kEngineSlotTypes) || type != kEngineSlotTypes[slot] || b.m_ArrayCount > 1) {
+                NV_LOG_WARN((std::string(who) + ": set 0 binding " + std::to_string(slot) + " (" + b.m_FullName +
+                    ") does not match the engine resource layout").c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    VkPipelineLayout VK_DescriptorLayoutCache::GetPipelineLayout(const std::vector<VkDescriptorSetLayout>& setLayouts,
+        const std::vector<VkPushConstantRange>& pushConstantRanges)
+    {
+        Key key;
+        key.reserve(2 + setLayouts.size() + pushConstantRanges.size() * 2);
+        key.push_back(setLayouts.size());
+        for (VkDescriptorSetLayout layout : setLayouts) {
+            key.push_back(reinterpret_cast<uint64_t>(layout));
+        }
+        key.push_back(pushConstantRanges.size());
+        for (const auto& range : pushConstantRanges) {
+            key.push_back((static_cast<uint64_t>(range.offset) << 32) | range.size);
+            key.push_back(range.stageFlags);
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Device == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+        if (auto it = m_PipelineLayouts.find(key); it != m_PipelineLayouts.end()) {
+            return it->second;
+        }
+
+        VkPipelineLayoutCreateInfo info{};
+        info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        info.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
+        info.pSetLayouts = setLayouts.data();
+        info.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+        info.pPushConstantRanges = pushConstantRanges.data();
+
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        const VkResult res = vkCreatePipelineLayout(m_Device, &info, nullptr, &layout);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            NV_LOG_WARN("VK_DescriptorLayoutCache: failed to create pipeline layout");
+            return VK_NULL_HANDLE;
+        }
+
+        m_PipelineLayouts.emplace(std::move(key), layout);
+        return layout;
+    }
+
+    size_t VK_DescriptorLayoutCache::GetSetLayoutCount() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_SetLayouts.size();
+    }
+
+    size_t VK_DescriptorLayoutCache::GetPipelineLayoutCount() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_PipelineLayouts.size();
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
@@ -50,6 +50,14 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         return formatCount > 0 && presentModeCount > 0;
     }
 
+    bool VK_Device::IsExtensionEnabled(const char* extName) const {
+        for (const auto& e : m_EnabledExtensions) {
+            if (e == extName)
+                return true;
+        }
+        return false;
+    }
+
     const VK_Device::VK_QueueFamily* VK_Device::GetQueueFamily(uint32_t familyIndex) const {
         for (const auto& f : m_QueueFamilies) {
             if (f.index == familyIndex)
@@ -58,7 +66,9 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         return nullptr;
     }
 
-    bool VK_Device::Create(const VkInstance instance, const VkSurfaceKHR surface, const std::vector<const char*>& requiredDeviceExtensions) {
+    bool VK_Device::Create(const VkInstance instance, const VkSurfaceKHR surface,
+        const std::vector<const char*>& requiredDeviceExtensions,
+        const std::vector<const char*>& optionalDeviceExtensions) {
         if(instance == VK_NULL_HANDLE || surface == VK_NULL_HANDLE) {
             NV_LOG_ERROR("VK_Device::Create failed: VK_Instance is not initialized (instance/surface null)");
             return false;
@@ -68,15 +78,19 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             return false;
         }
 
-        if (!CreateLogicalDevice(requiredDeviceExtensions)) {
+        if (!CreateLogicalDevice(requiredDeviceExtensions, optionalDeviceExtensions)) {
             return false;
         }
 
+        m_LayoutCache.Create(m_Device);
+
         NV_LOG_INFO("VK_Device created successfully.");
         return true;
     }
 
     void VK_Device::Destroy() {
+        m_LayoutCache.Destroy();
+
         if (m_Device != VK_NULL_HANDLE) {
             vkDestroyDevice(m_Device, nullptr);
             m_Device = VK_NULL_HANDLE;
@@ -88,6 +102,12 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         m_Features = {};
         m_MemoryProperties = {};
 
+        m_EnabledExtensions.clear();
+        m_PresentWaitSupported = false;
+        m_DescriptorIndexingSupported = false;
+        m_DescriptorIndexingProperties = {};
+        m_TimelineSemaphoreSupported = false;
+
         NV_LOG_INFO("VK_Device destroyed.");
     }
 
@@ -306,7 +326,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         return true;
     }
 
-    bool VK_Device::CreateLogicalDevice(const std::vector<const char*>& requiredDeviceExtensions) {
+    bool VK_Device::CreateLogicalDevice(const std::vector<const char*>& requiredDeviceExtensions,
+        const std::vector<const char*>& optionalDeviceExtensions) {
         if (m_PhysicalDevice == VK_NULL_HANDLE) {
             NV_LOG_ERROR("CreateLogicalDevice failed: physical device is null");
             return false;
@@ -345,6 +366,90 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         features11.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
         features11.shaderDrawParameters = VK_TRUE;
 
+        std::vector<const char*> enabledExtensions = requiredDeviceExtensions;
+        for (const char* ext : optionalDeviceExtensions) {
+            if (HasDeviceExtension(m_PhysicalDevice, ext)) {
+                enabledExtensions.push_back(ext);
+            }
+            else {
+                NV_LOG_INFO((std::string("Optional device extension not available: ") + ext).c_str());
+            }
+        }
+
+        m_EnabledExtensions.assign(enabledExtensions.begin(), enabledExtensions.end());
+
+        // Present wait (low-latency pacing) needs both extensions and both features.
+        VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures{};
+        presentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+        VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures{};
+        presentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
+        // Bindless heap (VK_BindlessHeap): descriptor indexing is core since Vulkan 1.2, but each
+        // feature it relies on is optional, so the set is enabled all together or not at all.
+        VkPhysicalDeviceVulkan12Features features12{};
+        features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        features11.pNext = &features12;
+
+        m_DescriptorIndexingSupported = false;
+        m_DescriptorIndexingProperties = {};
+        m_TimelineSemaphoreSupported = false;
+        {
+            VkPhysicalDeviceVulkan12Features supported12{};
+            supported12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+            VkPhysicalDeviceFeatures2 supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            supported.pNext = &supported12;
+            vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &supported);
+
+            m_DescriptorIndexingSupported =
+                supported12.descriptorIndexing == VK_TRUE &&
+                supported12.runtimeDescriptorArray == VK_TRUE &&
+                supported12.descriptorBindingPartiallyBound == VK_TRUE &&
+                supported12.descriptorBindingUpdateUnusedWhilePending == VK_TRUE &&
+                supported12.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE &&
+                supported12.descriptorBindingStorageBufferUpdateAfterBind == VK_TRUE &&
+                supported12.shaderSampledImageArrayNonUniformIndexing == VK_TRUE &&
+                supported12.shaderStorageBufferArrayNonUniformIndexing == VK_TRUE;
+
+            if (m_DescriptorIndexingSupported) {
+                features12.descriptorIndexing = VK_TRUE;
+                features12.runtimeDescriptorArray = VK_TRUE;
+                features12.descriptorBindingPartiallyBound = VK_TRUE;
+                features12.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+                features12.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+                features12.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+                features12.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+                features12.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+
+                m_DescriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+                VkPhysicalDeviceProperties2 props2{};
+                props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+                props2.pNext = &m_DescriptorIndexingProperties;
+                vkGetPhysicalDeviceProperties2(m_PhysicalDevice, &props2);
+                m_DescriptorIndexingProperties.pNext = nullptr;
+            }
+
+            // Async compute waits on the graphics queue through a timeline semaphore.
+            m_TimelineSemaphoreSupported = supported12.timelineSemaphore == VK_TRUE;
+            if (m_TimelineSemaphoreSupported)
+                features12.timelineSemaphore = VK_TRUE;
+        }
+
+        m_PresentWaitSupported = false;
+        if (IsExtensionEnabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && IsExtensionEnabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+            presentIdFeatures.pNext = &presentWaitFeatures;
+
+            VkPhysicalDeviceFeatures2 supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            supported.pNext = &presentIdFeatures;
+            vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &supported);
+
+            m_PresentWaitSupported = presentIdFeatures.presentId == VK_TRUE && presentWaitFeatures.presentWait == VK_TRUE;
+            if (m_PresentWaitSupported) {
+                features12.pNext = &presentIdFeatures;
+            }
+        }
+
         VkPhysicalDeviceFeatures2 features2{};
         features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
         features2.pNext = &features11;
@@ -356,8 +461,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         dci.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
         dci.pQueueCreateInfos = queueCreateInfos.data();
         dci.pEnabledFeatures = nullptr;
-        dci.enabledExtensionCount = static_cast<uint32_t>(requiredDeviceExtensions.size());
-        dci.ppEnabledExtensionNames = requiredDeviceExtensions.data();
+        dci.enabledExtensionCount = static_cast<uint32_t>(enabledExtensions.size());
+        dci.ppEnabledExtensionNames = enabledExtensions.data();
 
         VkResult res = vkCreateDevice(m_PhysicalDevice, &dci, nullptr, &m_Device);
         CheckVkResult(res);
@@ -378,7 +483,10 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         if (m_TransferQueueFamily != UINT32_MAX)
             vkGetDeviceQueue(m_Device, m_TransferQueueFamily, 0, &m_TransferQueue);
 
-        NV_LOG_INFO("Vulkan logical device created.");
+        NV_LOG_INFO((std::string("Vulkan logical device created (present wait: ") +
+            (m_PresentWaitSupported ? "yes" : "no") + ", descriptor indexing: " +
+            (m_DescriptorIndexingSupported ? "yes" : "no") + ", timeline semaphores: " +
+            (m_TimelineSemaphoreSupported ? "yes" : "no") + ").").c_str());
         return true;
     }
 
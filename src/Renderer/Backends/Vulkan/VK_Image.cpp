@@ -0,0 +1,200 @@
+#include "Renderer/Backends/Vulkan/VK_Image.h"
+#include "Renderer/Backends/Vulkan/VK_Common.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Nova::Core::Renderer::Backends::Vulkan {
+
+    static VkFormat ToVkFormat(RHI::RHI_ImageFormat format) {
+        switch (format) {
+        case RHI::RHI_ImageFormat::RGBA8Unorm:  return VK_FORMAT_R8G8B8A8_UNORM;
+        case RHI::RHI_ImageFormat::RGBA16Float: return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case RHI::RHI_ImageFormat::RGBA32Float: return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case RHI::RHI_ImageFormat::R32Float:    return VK_FORMAT_R32_SFLOAT;
+        case RHI::RHI_ImageFormat::R32Uint:     return VK_FORMAT_R32_UINT;
+        default:                                return VK_FORMAT_UNDEFINED;
+        }
+    }
+
+    bool VK_StorageImage::Create(VkPhysicalDevice physicalDevice, VkDevice device,
+        VkCommandPool commandPool, VkQueue queue,
+        const RHI::RHI_ImageDesc& desc, const std::vector<uint32_t>& queueFamilies)
+    {
+        Destroy();
+
+        m_Format = ToVkFormat(desc.m_Format);
+        if (device == VK_NULL_HANDLE || desc.m_Width == 0 || desc.m_Height == 0 || m_Format == VK_FORMAT_UNDEFINED) {
+            NV_LOG_ERROR("VK_StorageImage::Create - invalid device, size or format");
+            return false;
+        }
+
+        VkFormatProperties formatProps;
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, m_Format, &formatProps);
+        if ((formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) == 0) {
+            NV_LOG_ERROR(("VK_StorageImage::Create - format not usable as storage image for '" + desc.m_DebugName + "'").c_str());
+            return false;
+        }
+
+        m_Desc = desc;
+        m_Device = device;
+
+        std::vector<uint32_t> families = queueFamilies;
+        std::sort(families.begin(), families.end());
+        families.erase(std::unique(families.begin(), families.end()), families.end());
+        families.erase(std::remove(families.begin(), families.end(), UINT32_MAX), families.end());
+
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = m_Format;
+        imageInfo.extent = { desc.m_Width, desc.m_Height, 1 };
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT
+            | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        if (families.size() > 1) {
+            imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            imageInfo.queueFamilyIndexCount = static_cast<uint32_t>(families.size());
+            imageInfo.pQueueFamilyIndices = families.data();
+        }
+        else {
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        }
+
+        VkResult res = vkCreateImage(m_Device, &imageInfo, nullptr, &m_Image);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            Destroy();
+            return false;
+        }
+
+        VkMemoryRequirements memReq;
+        vkGetImageMemoryRequirements(m_Device, m_Image, &memReq);
+        VkPhysicalDeviceMemoryProperties memProps;
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProps);
+        uint32_t memTypeIndex = UINT32_MAX;
+        for (uint32_t i = 0; i < memProps.memoryTypeCount; ++i) {
+            if ((memReq.memoryTypeBits & (1u << i)) &&
+                (memProps.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+                memTypeIndex = i;
+                break;
+            }
+        }
+        if (memTypeIndex == UINT32_MAX) {
+            NV_LOG_ERROR("VK_StorageImage::Create - no device-local memory type");
+            Destroy();
+            return false;
+        }
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memReq.size;
+        allocInfo.memoryTypeIndex = memTypeIndex;
+        res = vkAllocateMemory(m_Device, &allocInfo, nullptr, &m_Memory);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            Destroy();
+            return false;
+        }
+        vkBindImageMemory(m_Device, m_Image, m_Memory, 0);
+
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_Image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = m_Format;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.layerCount = 1;
+        res = vkCreateImageView(m_Device, &viewInfo, nullptr, &m_ImageView);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) {
+            Destroy();
+            return false;
+        }
+
+        if (!TransitionToGeneral(commandPool, queue)) {
+            NV_LOG_ERROR("VK_StorageImage::Create - initial layout transition failed");
+            Destroy();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool VK_StorageImage::TransitionToGeneral(VkCommandPool commandPool, VkQueue queue) {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = commandPool;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer cmd;
+        VkResult res = vkAllocateCommandBuffers(m_Device, &allocInfo, &cmd);
+        CheckVkResult(res);
+        if (res != VK_SUCCESS) return false;
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(cmd, &beginInfo);
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_Image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.layerCount = 1;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(cmd,
+            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        vkEndCommandBuffer(cmd);
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &cmd;
+
+        // Creation path, not hot path.
+        res = vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+        CheckVkResult(res);
+        vkQueueWaitIdle(queue);
+
+        vkFreeCommandBuffers(m_Device, commandPool, 1, &cmd);
+        return res == VK_SUCCESS;
+    }
+
+    void VK_StorageImage::Destroy() {
+        if (m_Device == VK_NULL_HANDLE)
+            return;
+
+        if (m_ImageView != VK_NULL_HANDLE) {
+            vkDestroyImageView(m_Device, m_ImageView, nullptr);
+            m_ImageView = VK_NULL_HANDLE;
+        }
+        if (m_Image != VK_NULL_HANDLE) {
+            vkDestroyImage(m_Device, m_Image, nullptr);
+            m_Image = VK_NULL_HANDLE;
+        }
+        if (m_Memory != VK_NULL_HANDLE) {
+            vkFreeMemory(m_Device, m_Memory, nullptr);
+            m_Memory = VK_NULL_HANDLE;
+        }
+        m_Device = VK_NULL_HANDLE;
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
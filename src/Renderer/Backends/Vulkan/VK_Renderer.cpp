@@ -5,6 +5,7 @@
 #include "Core/Window.h"
 #include "Core/ImGuiLayer.h"
 #include "Core/Log.h"
+#include "Core/Math.h"
 
 #include "imgui.h"
 #include "backends/imgui_impl_vulkan.h"
@@ -21,93 +22,15 @@
 #include <vector>
 #include <filesystem>
 
+#include "Asset/ShaderHotReload.h"
 #include "Renderer/RHI/RHI_ShaderCompiler.h"
 #include "Renderer/RHI/RHI_ShaderReflection.h"
 
 namespace Nova::Core::Renderer::Backends::Vulkan {
 
-    static VkShaderStageFlags ToVkStageFlags(RHI::RHI_ShaderStageMask mask) {
-        VkShaderStageFlags out = 0;
-        const uint32_t m = static_cast<uint32_t>(mask);
-        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Vertex)) out |= VK_SHADER_STAGE_VERTEX_BIT;
-        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Fragment)) out |= VK_SHADER_STAGE_FRAGMENT_BIT;
-        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Geometry)) out |= VK_SHADER_STAGE_GEOMETRY_BIT;
-        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::TessCtrl)) out |= VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
-        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::TessEval)) out |= VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
-        if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Compute)) out |= VK_SHADER_STAGE_COMPUTE_BIT;
-        return out;
-    }
-
-    static VkDescriptorType ToVkDescriptorType(const RHI::RHI_BindingInfo& b) {
-        using RK = RHI::RHI_ResourceKind;
-        switch (b.m_Kind) {
-            case RK::ConstantBuffer: return b.m_IsDynamicUniformBuffer ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-            case RK::StorageBuffer:  return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            case RK::Texture:        return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-            case RK::Sampler:        return VK_DESCRIPTOR_TYPE_SAMPLER;
-            case RK::CombinedTextureSampler: return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-            case RK::RWTexture:      return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-            case RK::RWBuffer:       return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            default:                 return VK_DESCRIPTOR_TYPE_MAX_ENUM;
-        }
-    }
-
-    static bool CreateDescriptorSetLayoutFromReflection(
-        VkDevice device,
-        const RHI::RHI_ProgramReflection& refl,
-        uint32_t setIndex,
-        VkDescriptorSetLayout& outLayout)
-    {
-        outLayout = VK_NULL_HANDLE;
-        const auto* set = refl.FindSet(setIndex);
-        if ((!set || set->m_Bindings.empty()) && setIndex != RHI::kUserDescriptorSet) return false;
-
-        std::vector<VkDescriptorSetLayoutBinding> bindings;
-        if (set) {
-            bindings.reserve(set->m_Bindings.size());
-            for (const auto& b : set->m_Bindings) {
-                VkDescriptorType type = ToVkDescriptorType(b);
-                if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) continue;
-
-                VkDescriptorSetLayoutBinding vkB{};
-                vkB.binding = b.m_Key.m_Binding;
-                vkB.descriptorType = type;
-                vkB.descriptorCount = (b.m_ArrayCount == 0) ? 1u : b.m_ArrayCount;
-                vkB.stageFlags = ToVkStageFlags(b.m_Stages);
-                bindings.push_back(vkB);
-            }
-        }
-
-        // Safety net: if the reflection name map references (set,binding) pairs that didn't
-        // end up in `set->bindings` (known Slang reflection corner-cases), ensure they exist
-        // so pipeline layout matches SPIR-V usage.
-        if (setIndex == RHI::kUserDescriptorSet) {
-            // Conservative default: ensure binding 0 exists for user set.
-            // This matches the common case (first user cbuffer at binding 0) and avoids
-            // pipeline-layout mismatch when reflection is incomplete.
-            const bool has0 = std::any_of(bindings.begin(), bindings.end(),
-                [](const VkDescriptorSetLayoutBinding& b) { return b.binding == 0; });
-            if (!has0) {
-                VkDescriptorSetLayoutBinding vkB{};
-                vkB.binding = 0;
-                vkB.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-                vkB.descriptorCount = 1;
-                vkB.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-                bindings.push_back(vkB);
-            }
-        }
-
-        if (bindings.empty()) return false;
-
-        VkDescriptorSetLayoutCreateInfo info{};
-        info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-        info.bindingCount = static_cast<uint32_t>(bindings.size());
-        info.pBindings = bindings.data();
-
-        const VkResult res = vkCreateDescriptorSetLayout(device, &info, nullptr, &outLayout);
-        CheckVkResult(res);
-        return (res == VK_SUCCESS);
-    }
+    // Bindless heap array sizes (clamped to the device's update-after-bind limits).
+    static constexpr uint32_t kMaxBindlessTextures = 16384;
+    static constexpr uint32_t kMaxBindlessBuffers = 4096;
 
     bool VK_Renderer::TransitionViewportImageToShaderRead() {
         if (m_ViewportImage == VK_NULL_HANDLE)
@@ -190,6 +113,12 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             VK_KHR_SWAPCHAIN_EXTENSION_NAME
         };
 
+        // Low-latency frame pacing, enabled only where the driver exposes it.
+        const std::vector<const char*> optionalDeviceExtensions = {
+            VK_KHR_PRESENT_ID_EXTENSION_NAME,
+            VK_KHR_PRESENT_WAIT_EXTENSION_NAME
+        };
+
         // Instance
         if (!m_VKInstance.Create()) {
             NV_LOG_ERROR("VK_Instance::Create failed");
@@ -197,12 +126,33 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         }
 
         // Device
-        if (!m_VKDevice.Create(m_VKInstance.GetInstance(), m_VKInstance.GetSurface(), deviceExtensions)) {
+        if (!m_VKDevice.Create(m_VKInstance.GetInstance(), m_VKInstance.GetSurface(), deviceExtensions, optionalDeviceExtensions)) {
             NV_LOG_ERROR("VK_Device::Create failed");
             return false;
         }
 
+        // Bindless heap: set 2 of every pipeline layout, when the device supports descriptor indexing.
+        if (m_VKDevice.IsDescriptorIndexingSupported()) {
+            if (!m_BindlessHeap.Create(m_VKDevice.GetDevice(), m_VKDevice.GetLayoutCache(),
+                    m_VKDevice.GetDescriptorIndexingProperties(), kMaxBindlessTextures, kMaxBindlessBuffers,
+                    VK_Swapchain::FRAMES_IN_FLIGHT))
+            {
+                NV_LOG_WARN("Bindless heap creation failed; bindless registration is disabled");
+            }
+        }
+        else {
+            NV_LOG_WARN("Descriptor indexing not supported; bindless registration is disabled");
+        }
+
+        if (!m_TransientDescriptors.Create(m_VKDevice.GetDevice(), VK_Swapchain::FRAMES_IN_FLIGHT)) {
+            NV_LOG_ERROR("VK_DescriptorAllocator::Create failed");
+            return false;
+        }
+
         // Swapchain
+        m_VKSwapchain.SetLayoutCache(&m_VKDevice.GetLayoutCache());
+        m_VKSwapchain.SetBindlessSetLayout(m_BindlessHeap.GetSetLayout());
+        m_VKSwapchain.SetRequestedPresentMode(Nova::Core::Application::Get().GetWindow().GetPresentMode());
         if (!m_VKSwapchain.Create(
                 m_VKDevice.GetPhysicalDevice(),
                 m_VKDevice.GetDevice(),
@@ -215,6 +165,9 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             NV_LOG_ERROR("Failed to create swapchain");
             return false;
         }
+
+        if (m_VKDevice.IsPresentWaitSupported())
+            m_VKSwapchain.EnablePresentWait();
         
         ImGui_ImplVulkan_InitInfo initInfo{};
         initInfo.ApiVersion = VK_API_VERSION_1_3;
@@ -269,10 +222,32 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             m_VKSwapchain.GetEngineDescriptorSet(),
             m_VKSwapchain.GetUserDescriptorSet()
         );
+        m_Shader->SetBindlessSet(m_BindlessHeap.GetDescriptorSet());
         m_Shader->SetReflection(m_VKSwapchain.GetModelPipelineReflection());
+        m_Shader->SetKeywords(m_VKSwapchain.GetModelKeywords());
+        m_Shader->SetPipelineVariantFactory([this](RHI::RHI_ShaderVariantMask mask) {
+            return m_VKSwapchain.GetModelPipelineVariant(mask);
+        });
+
+#if defined(NOVA_SHADER_HOT_RELOAD)
+        {
+            auto& hotReload = Asset::ShaderHotReload::Get();
+            hotReload.Watch(m_VKSwapchain.GetModelVertexShader());
+            hotReload.Watch(m_VKSwapchain.GetModelFragmentShader());
+            m_ShaderReloadListener = hotReload.AddListener([this](const Asset::ShaderHotReload::ShaderList& reloaded) {
+                OnShadersReloaded(reloaded);
+            });
+            hotReload.Start(GraphicsAPI::Vulkan);
+        }
+#endif
 
         CreateFullscreenQuadBuffer();
 
+        if (!CreateComputeResources()) {
+            NV_LOG_ERROR("Failed to create compute command buffers");
+            return false;
+        }
+
         NV_LOG_INFO("Vulkan renderer created successfully (minimal mode).");
         return true;
     }
@@ -280,6 +255,12 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
     void VK_Renderer::Destroy() {
         NV_LOG_INFO("Destroying Vulkan renderer...");
 
+        if (m_ShaderReloadListener != 0) {
+            Asset::ShaderHotReload::Get().Stop();
+            Asset::ShaderHotReload::Get().RemoveListener(m_ShaderReloadListener);
+            m_ShaderReloadListener = 0;
+        }
+
         if (m_VKDevice.GetDevice() != VK_NULL_HANDLE) {
             vkDeviceWaitIdle(m_VKDevice.GetDevice());
         }
@@ -289,6 +270,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
         DestroyFullscreenQuadBuffer();
 
+        DestroyComputeResources();
+
         // Shutdown ImGui's Vulkan backend before the descriptor pool and device are destroyed.
         auto& imguiLayer = Nova::Core::Application::Get().GetImGuiLayer();
         imguiLayer.DestroyImGuiBackend(GraphicsAPI::Vulkan);
@@ -299,29 +282,23 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             vkDestroyPipeline(m_VKDevice.GetDevice(), p, nullptr);
         m_FullscreenPipelines.clear();
 
-        // Ensure any dynamically-created pipeline layouts / set layouts / descriptor sets are destroyed
-        // before the device is torn down, even if individual DestroyFullscreenShader() calls were skipped.
-        if (m_VKDevice.GetDevice() != VK_NULL_HANDLE) {
-            VkDescriptorPool pool = m_VKSwapchain.GetImGuiDescriptorPool();
-            for (auto& [pipeline, state] : m_FullscreenPipelineState) {
-                if (state.userSet != VK_NULL_HANDLE && pool != VK_NULL_HANDLE) {
-                    vkFreeDescriptorSets(m_VKDevice.GetDevice(), pool, 1, &state.userSet);
-                }
-                if (state.layout != VK_NULL_HANDLE) vkDestroyPipelineLayout(m_VKDevice.GetDevice(), state.layout, nullptr);
-                if (state.set0Layout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(m_VKDevice.GetDevice(), state.set0Layout, nullptr);
-                if (state.set1Layout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(m_VKDevice.GetDevice(), state.set1Layout, nullptr);
+        for (auto& [key, entry] : m_MeshCache) {
+            if (entry.m_GPU) {
+                entry.m_GPU->Release();
             }
         }
-        m_FullscreenPipelineState.clear();
-
-        for (auto& [key, mesh] : m_MeshCache) {
-            if (mesh) {
-                mesh->Release();
+        m_MeshCache.clear();
+        for (auto& retired : m_RetiredMeshes) {
+            if (retired.m_GPU) {
+                retired.m_GPU->Release();
             }
         }
-        m_MeshCache.clear();
+        m_RetiredMeshes.clear();
+        m_MeshFrame = 0;
 
         m_VKSwapchain.Destroy();
+        m_TransientDescriptors.Destroy();
+        m_BindlessHeap.Destroy();
         m_VKDevice.Destroy();
         m_VKInstance.Destroy();
 
@@ -361,10 +338,21 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             imguiLayer.SetVulkanBeforeRenderCallback({});
         }
 
-        SDL_Window* window = Nova::Core::Application::Get().GetWindow().GetSDLWindow();
+        Nova::Core::Window& appWindow = Nova::Core::Application::Get().GetWindow();
+        SDL_Window* window = appWindow.GetSDLWindow();
         if (SDL_GetWindowFlags(window) & SDL_WINDOW_MINIMIZED)
             return;
 
+        // Present mode changes (VSync toggle, explicit policy) are applied at the frame boundary.
+        const Nova::Core::PresentMode presentMode = appWindow.GetPresentMode();
+        if (presentMode != m_VKSwapchain.GetRequestedPresentMode()) {
+            m_VKSwapchain.SetRequestedPresentMode(presentMode);
+            m_FramebufferResized = true;
+        }
+
+        // Shaders recompiled in the background are swapped in between frames.
+        Asset::ShaderHotReload::Get().ApplyPending();
+
         // Recreate the swapchain if requested before acquiring an image.
         if (m_FramebufferResized) {
             m_FramebufferResized = false;
@@ -379,6 +367,12 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         // Wait until the current frame-in-flight is available.
         CheckVkResult(vkWaitForFences(m_VKDevice.GetDevice(), 1, &fs.m_InFlightFence, VK_TRUE, UINT64_MAX));
 
+        // The oldest frame in flight is done: bindless slots it could read can be reused,
+        // and its transient descriptor pools can be reset.
+        m_BindlessHeap.BeginFrame();
+        m_TransientDescriptors.BeginFrame(frameIndex);
+        CollectDeadMeshes();
+
         // Acquire a swapchain image and retrieve its image index.
         uint32_t imageIndex = 0;
         VkResult acquireRes = vkAcquireNextImageKHR(
@@ -518,6 +512,35 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         m_FrameActive = true;
     }
 
+    void VK_Renderer::OnShadersReloaded(const std::vector<std::shared_ptr<Asset::Assets::ShaderAsset>>& reloaded) {
+        const auto& vert = m_VKSwapchain.GetModelVertexShader();
+        const auto& frag = m_VKSwapchain.GetModelFragmentShader();
+        const bool affectsModel = std::any_of(reloaded.begin(), reloaded.end(),
+            [&](const auto& shader) { return shader == vert || shader == frag; });
+        if (!affectsModel) return;
+        if (!m_VKSwapchain.ReloadModelPipeline()) {
+            // Keep the assets in step with the pipeline still in use, so reflection and later variants match it.
+            for (const auto& shader : reloaded) {
+                if (shader == vert || shader == frag) shader->RevertReload();
+            }
+            return;
+        }
+
+        if (m_Shader) {
+            // Keep the caller's keyword toggles across the keyword set refresh.
+            std::vector<std::string> enabled;
+            for (const auto& keyword : m_Shader->GetKeywords().GetKeywords()) {
+                if (m_Shader->IsKeywordEnabled(keyword.m_Name)) enabled.push_back(keyword.m_Name);
+            }
+
+            m_Shader->SetPipeline(m_VKSwapchain.GetModelPipeline(), m_VKSwapchain.GetModelPipelineLayout());
+            m_Shader->SetKeywords(m_VKSwapchain.GetModelKeywords());
+            for (const auto& name : enabled) m_Shader->SetKeyword(name, true);
+            m_Shader->InvalidateBindings();
+        }
+        NV_LOG_INFO("Model pipeline reloaded.");
+    }
+
     void VK_Renderer::BeginScene(const glm::mat4& view, const glm::mat4& proj) {
         if (!m_Shader || !m_Shader->IsValid()) return;
 
@@ -528,8 +551,13 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
     }
 
     void VK_Renderer::SetModelMatrix(const glm::mat4& model) {
+        SetModelMatrix(model, ComputeNormalMatrix(model));
+    }
+
+    void VK_Renderer::SetModelMatrix(const glm::mat4& model, const glm::mat4& normalMatrix) {
         if (!m_Shader || !m_Shader->IsValid()) return;
         m_Shader->SetParameter("model", model);
+        m_Shader->SetParameter("normalMatrix", normalMatrix);
     }
 
     void VK_Renderer::Draw(const RHI::RHI_DrawCommand& cmd) {
@@ -597,6 +625,9 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
     void VK_Renderer::PrepareForImGui() {
         if (!m_FrameActive)
             return;
+        // ImGui binds its own descriptor sets with an unrelated layout.
+        if (m_Shader)
+            m_Shader->InvalidateBindings();
         if (m_RenderedToViewportThisFrame) {
             BeginImGuiRenderPass();
             return;
@@ -625,8 +656,13 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             return nullptr;
 
         auto it = m_MeshCache.find(cpuMesh.get());
-        if (it != m_MeshCache.end())
-            return it->second;
+        if (it != m_MeshCache.end()) {
+            if (!it->second.m_Source.expired())
+                return it->second.m_GPU;
+            // The cached mesh died and this one reuses its address.
+            RetireMesh(std::move(it->second.m_GPU));
+            m_MeshCache.erase(it);
+        }
 
         auto vkMesh = std::make_shared<VK_Mesh>(*cpuMesh);
         vkMesh->Init(
@@ -639,10 +675,40 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         // IMPORTANT: Init() needs the command pool, not a command buffer.
         vkMesh->Upload(*cpuMesh);
 
-        m_MeshCache[cpuMesh.get()] = vkMesh;
+        m_MeshCache[cpuMesh.get()] = CachedMesh{ cpuMesh, vkMesh };
         return vkMesh;
     }
 
+    void VK_Renderer::RetireMesh(std::shared_ptr<VK_Mesh> mesh) {
+        if (mesh)
+            m_RetiredMeshes.push_back({ std::move(mesh), m_MeshFrame });
+    }
+
+    void VK_Renderer::CollectDeadMeshes() {
+        ++m_MeshFrame;
+
+        // Retired in frame order, so the releasable ones form a prefix (see VK_BindlessHeap::BeginFrame).
+        size_t count = 0;
+        while (count < m_RetiredMeshes.size() &&
+            m_RetiredMeshes[count].m_Frame + VK_Swapchain::FRAMES_IN_FLIGHT <= m_MeshFrame)
+        {
+            m_RetiredMeshes[count].m_GPU->Release();
+            ++count;
+        }
+        m_RetiredMeshes.erase(m_RetiredMeshes.begin(), m_RetiredMeshes.begin() + static_cast<std::ptrdiff_t>(count));
+
+        // Meshes nothing references any more cannot be drawn again.
+        for (auto it = m_MeshCache.begin(); it != m_MeshCache.end();) {
+            if (it->second.m_Source.expired()) {
+                RetireMesh(std::move(it->second.m_GPU));
+                it = m_MeshCache.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
     void VK_Renderer::CreateViewportFramebuffer(int w, int h) {
         if (w <= 0 || h <= 0) return;
 
@@ -911,25 +977,107 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         vkCmdEndRenderPass(cmd);
         CheckVkResult(vkEndCommandBuffer(cmd));
 
+        // Stages of the frame that may consume compute results.
+        constexpr VkPipelineStageFlags kComputeConsumerStages =
+            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+            VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+        auto& computeFrame = m_ComputeFrames[frameIndex];
+
+        VkCommandBuffer submitCmds[2] = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+        uint32_t submitCmdCount = 0;
+
+        if (computeFrame.m_GraphicsRecording) {
+            // Compute writes become visible to everything recorded after them on this queue.
+            VkMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(computeFrame.m_GraphicsCmd,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, kComputeConsumerStages,
+                0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+            CheckVkResult(vkEndCommandBuffer(computeFrame.m_GraphicsCmd));
+            submitCmds[submitCmdCount++] = computeFrame.m_GraphicsCmd;
+            computeFrame.m_GraphicsRecording = false;
+        }
+        submitCmds[submitCmdCount++] = cmd;
+
+        VkSemaphore waitSemaphores[2] = { fs.m_ImageAvailableSemaphore, VK_NULL_HANDLE };   // [0] signaled by this frame's acquire
+        VkPipelineStageFlags waitStages[2] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, kComputeConsumerStages };
+        uint32_t waitSemaphoreCount = 1;
+
+        if (computeFrame.m_AsyncRecording) {
+            CheckVkResult(vkEndCommandBuffer(computeFrame.m_AsyncCmd));
+            computeFrame.m_AsyncRecording = false;
+
+            VkSubmitInfo computeSubmit{};
+            computeSubmit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            computeSubmit.commandBufferCount = 1;
+            computeSubmit.pCommandBuffers = &computeFrame.m_AsyncCmd;
+            computeSubmit.signalSemaphoreCount = 1;
+            computeSubmit.pSignalSemaphores = &computeFrame.m_AsyncDone;
+
+            // Write-after-read: wait until the previous graphics submit has finished consuming
+            // whatever this compute work overwrites.
+            const VkPipelineStageFlags graphicsWaitStage = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            const uint64_t graphicsWaitValue = m_GraphicsTimelineValue;
+            const uint64_t asyncSignalValue = 0;    // m_AsyncDone is binary
+            VkTimelineSemaphoreSubmitInfo computeTimeline{};
+            computeTimeline.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            computeTimeline.waitSemaphoreValueCount = 1;
+            computeTimeline.pWaitSemaphoreValues = &graphicsWaitValue;
+            computeTimeline.signalSemaphoreValueCount = 1;
+            computeTimeline.pSignalSemaphoreValues = &asyncSignalValue;
+            computeSubmit.pNext = &computeTimeline;
+            computeSubmit.waitSemaphoreCount = 1;
+            computeSubmit.pWaitSemaphores = &m_GraphicsTimeline;
+            computeSubmit.pWaitDstStageMask = &graphicsWaitStage;
+
+            // No fence: the graphics submit waits on m_AsyncDone, so the frame fence covers this work too.
+            VkResult computeRes = vkQueueSubmit(m_VKDevice.GetComputeQueue(), 1, &computeSubmit, VK_NULL_HANDLE);
+            CheckVkResult(computeRes);
+            if (computeRes == VK_SUCCESS) {
+                waitSemaphores[waitSemaphoreCount++] = computeFrame.m_AsyncDone;
+            }
+            else {
+                NV_LOG_ERROR("vkQueueSubmit (async compute) failed");
+            }
+        }
+
         // Reset the fence right before queue submission.
         CheckVkResult(vkResetFences(m_VKDevice.GetDevice(), 1, &fs.m_InFlightFence));
 
-        VkSemaphore waitSemaphores[] = { fs.m_ImageAvailableSemaphore };   // signaled by this frame's acquire
-        VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
         VkSemaphore renderFinishedSemaphore = m_VKSwapchain.GetRenderFinishedSemaphore(imageIndex);
-        VkSemaphore signalSemaphores[] = { renderFinishedSemaphore };
+        VkSemaphore signalSemaphores[2] = { renderFinishedSemaphore, m_GraphicsTimeline };
+        const uint64_t signalValues[2] = { 0, m_GraphicsTimelineValue + 1 };
 
         VkSubmitInfo submitInfo{};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.waitSemaphoreCount = waitSemaphoreCount;
         submitInfo.pWaitSemaphores = waitSemaphores;
         submitInfo.pWaitDstStageMask = waitStages;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &cmd;
+        submitInfo.commandBufferCount = submitCmdCount;
+        submitInfo.pCommandBuffers = submitCmds;
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores = signalSemaphores;
 
-        CheckVkResult(vkQueueSubmit(m_VKDevice.GetGraphicsQueue(), 1, &submitInfo, fs.m_InFlightFence));
+        // With async compute, the next frame's compute submit waits on this value.
+        VkTimelineSemaphoreSubmitInfo graphicsTimeline{};
+        if (m_GraphicsTimeline != VK_NULL_HANDLE) {
+            graphicsTimeline.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            graphicsTimeline.signalSemaphoreValueCount = 2;
+            graphicsTimeline.pSignalSemaphoreValues = signalValues;
+            submitInfo.pNext = &graphicsTimeline;
+            submitInfo.signalSemaphoreCount = 2;
+        }
+
+        VkResult submitRes = vkQueueSubmit(m_VKDevice.GetGraphicsQueue(), 1, &submitInfo, fs.m_InFlightFence);
+        CheckVkResult(submitRes);
+        if (submitRes == VK_SUCCESS && m_GraphicsTimeline != VK_NULL_HANDLE)
+            ++m_GraphicsTimelineValue;
 
         VkSwapchainKHR swapchains[] = { m_VKSwapchain.GetSwapchain() };
 
@@ -941,6 +1089,17 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         presentInfo.pSwapchains = swapchains;
         presentInfo.pImageIndices = &imageIndex; // index of the acquired swapchain image
 
+        // Tag every present so the low-latency mode can wait on it.
+        uint64_t presentId = 0;
+        VkPresentIdKHR presentIdInfo{};
+        if (m_VKSwapchain.IsPresentWaitEnabled()) {
+            presentId = m_VKSwapchain.NextPresentId();
+            presentIdInfo.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+            presentIdInfo.swapchainCount = 1;
+            presentIdInfo.pPresentIds = &presentId;
+            presentInfo.pNext = &presentIdInfo;
+        }
+
         VkResult presentRes = vkQueuePresentKHR(m_VKDevice.GetPresentQueue(), &presentInfo);
         if (presentRes == VK_ERROR_OUT_OF_DATE_KHR || presentRes == VK_SUBOPTIMAL_KHR) {
             m_FramebufferResized = true;
@@ -949,6 +1108,16 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             NV_LOG_ERROR("vkQueuePresentKHR failed");
         }
 
+        // Low-latency mode: block until the previous frame is on screen, so at most one frame
+        // is queued and the next iteration samples input right after scanout.
+        if (presentRes == VK_SUCCESS && presentId > 1 && Nova::Core::Application::Get().GetWindow().IsLowLatency()) {
+            constexpr uint64_t kPresentWaitTimeoutNs = 100'000'000; // never stall longer than 100 ms
+            VkResult waitRes = m_VKSwapchain.WaitForPresent(presentId - 1, kPresentWaitTimeoutNs);
+            if (waitRes == VK_ERROR_OUT_OF_DATE_KHR || waitRes == VK_ERROR_SURFACE_LOST_KHR) {
+                m_FramebufferResized = true;
+            }
+        }
+
         m_FrameActive = false;
 
         // next frame-in-flight
@@ -1050,12 +1219,13 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         const RHI::RHI_ShaderCompileInput& vertIn,
         const RHI::RHI_ShaderCompileInput& fragIn)
     {
-        RHI::RHI_ShaderCompileResult vertOut = RHI::RHI_ShaderCompiler::Compile(vertIn);
+        std::vector<RHI::RHI_ShaderCompileResult> outs = RHI::RHI_ShaderCompiler::CompileProgram({ vertIn, fragIn });
+        RHI::RHI_ShaderCompileResult& vertOut = outs[0];
+        RHI::RHI_ShaderCompileResult& fragOut = outs[1];
         if (!vertOut.m_Success) {
             NV_LOG_WARN(("CreateFullscreenShader vertex compile failed:\n" + vertOut.m_Log).c_str());
             return nullptr;
         }
-        RHI::RHI_ShaderCompileResult fragOut = RHI::RHI_ShaderCompiler::Compile(fragIn);
         if (!fragOut.m_Success) {
             NV_LOG_WARN(("CreateFullscreenShader fragment compile failed:\n" + fragOut.m_Log).c_str());
             return nullptr;
@@ -1157,40 +1327,30 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         RHI::RHI_ProgramReflection reflForVk =
             RHI::MergeProgramReflections({ vertOut.m_Reflection, fragOut.m_Reflection });
 
-        // Engine semantics: MVP + Material use dynamic uniform buffers.
-        if (auto* set0 = const_cast<RHI::RHI_DescriptorSetLayoutInfo*>(reflForVk.FindSet(RHI::kEngineDescriptorSet))) {
-            for (auto& b : set0->m_Bindings) {
-                if (b.m_Key.m_Binding == static_cast<uint32_t>(Renderer::RHI::EngineResourceSlot::Mvp) ||
-                    b.m_Key.m_Binding == static_cast<uint32_t>(Renderer::RHI::EngineResourceSlot::Material))
-                {
-                    if (b.m_Kind == RHI::RHI_ResourceKind::ConstantBuffer) b.m_IsDynamicUniformBuffer = true;
-                }
-            }
-        }
-
-        VkDescriptorSetLayout set0Layout = VK_NULL_HANDLE;
-        VkDescriptorSetLayout set1Layout = VK_NULL_HANDLE;
-        if (!CreateDescriptorSetLayoutFromReflection(device, reflForVk, RHI::kEngineDescriptorSet, set0Layout)) {
-            NV_LOG_WARN("CreateFullscreenShader: failed to create engine set layout from reflection");
+        // The canonical engine layout, shared with the model pipeline, so the engine set stays bound.
+        VK_DescriptorLayoutCache& layoutCache = m_VKDevice.GetLayoutCache();
+        const VkDescriptorSetLayout set0Layout = VK_DescriptorLayoutCache::IsEngineSetCompatible(reflForVk, "CreateFullscreenShader")
+            ? layoutCache.GetEngineSetLayout() : VK_NULL_HANDLE;
+        if (set0Layout == VK_NULL_HANDLE) {
+            NV_LOG_WARN("CreateFullscreenShader: failed to create engine set layout");
             vertModule.Destroy();
             fragModule.Destroy();
             return nullptr;
         }
-        (void)CreateDescriptorSetLayoutFromReflection(device, reflForVk, RHI::kUserDescriptorSet, set1Layout);
+        const VkDescriptorSetLayout set1Layout = layoutCache.GetSetLayout(reflForVk, RHI::kUserDescriptorSet);
 
-        VkDescriptorSetLayout setLayouts[2] = { set0Layout, set1Layout };
-        const uint32_t setLayoutCount = (set1Layout != VK_NULL_HANDLE) ? 2u : 1u;
+        std::vector<VkDescriptorSetLayout> setLayouts = { set0Layout };
+        if (set1Layout != VK_NULL_HANDLE) setLayouts.push_back(set1Layout);
+        const bool useBindless = m_BindlessHeap.IsValid() && setLayouts.size() == RHI::kBindlessDescriptorSet;
+        if (useBindless) setLayouts.push_back(m_BindlessHeap.GetSetLayout());
 
-        VkPipelineLayout layout = VK_NULL_HANDLE;
-        VkPipelineLayoutCreateInfo layoutInfo{};
-        layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-        layoutInfo.setLayoutCount = setLayoutCount;
-        layoutInfo.pSetLayouts = setLayouts;
-        VkResult res = vkCreatePipelineLayout(device, &layoutInfo, nullptr, &layout);
-        CheckVkResult(res);
-        if (res != VK_SUCCESS) {
-            vkDestroyDescriptorSetLayout(device, set0Layout, nullptr);
-            if (set1Layout) vkDestroyDescriptorSetLayout(device, set1Layout, nullptr);
+        // Same push-constant range as the model pipeline: keeps set 0 compatible between them.
+        const VkPushConstantRange pushRange = GetDrawPushConstantRange();
+        if (reflForVk.m_PushConstants && reflForVk.m_PushConstants->m_SizeBytes > pushRange.size)
+            NV_LOG_WARN("CreateFullscreenShader: shader push constants exceed RHI::DrawPushConstants");
+
+        const VkPipelineLayout layout = layoutCache.GetPipelineLayout(setLayouts, { pushRange });
+        if (layout == VK_NULL_HANDLE) {
             vertModule.Destroy();
             fragModule.Destroy();
             return nullptr;
@@ -1213,43 +1373,18 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         pipe.subpass             = 0;
 
         VkPipeline pipeline = VK_NULL_HANDLE;
-        res = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipe, nullptr, &pipeline);
+        VkResult res = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipe, nullptr, &pipeline);
 
         vertModule.Destroy();
         fragModule.Destroy();
 
         if (res != VK_SUCCESS) {
             NV_LOG_WARN("CreateFullscreenShader: pipeline creation failed");
-            vkDestroyPipelineLayout(device, layout, nullptr);
-            vkDestroyDescriptorSetLayout(device, set0Layout, nullptr);
-            if (set1Layout) vkDestroyDescriptorSetLayout(device, set1Layout, nullptr);
             return nullptr;
         }
 
         m_FullscreenPipelines.push_back(pipeline);
 
-        // Allocate a user descriptor set if needed (set 1).
-        VkDescriptorSet userSet = VK_NULL_HANDLE;
-        if (set1Layout != VK_NULL_HANDLE) {
-            VkDescriptorSetAllocateInfo allocInfo{};
-            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-            allocInfo.descriptorPool = m_VKSwapchain.GetImGuiDescriptorPool();
-            allocInfo.descriptorSetCount = 1;
-            allocInfo.pSetLayouts = &set1Layout;
-            res = vkAllocateDescriptorSets(device, &allocInfo, &userSet);
-            CheckVkResult(res);
-            if (res != VK_SUCCESS) {
-                NV_LOG_WARN("CreateFullscreenShader: failed to allocate user descriptor set");
-                vkDestroyPipeline(device, pipeline, nullptr);
-                vkDestroyPipelineLayout(device, layout, nullptr);
-                vkDestroyDescriptorSetLayout(device, set0Layout, nullptr);
-                vkDestroyDescriptorSetLayout(device, set1Layout, nullptr);
-                return nullptr;
-            }
-        }
-
-        m_FullscreenPipelineState[pipeline] = FullscreenPipelineState{ layout, set0Layout, set1Layout, userSet };
-
         auto* shader = new VK_Shaders();
         shader->SetPipeline(pipeline, layout);
         shader->SetSceneBuffers(device,
@@ -1259,7 +1394,10 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             m_VKSwapchain.GetBufInstances(),  m_VKSwapchain.GetBufInstancesMemory(),
             m_VKSwapchain.GetBufInstancesSize(),
             m_VKSwapchain.GetEngineDescriptorSet(),
-            userSet);
+            VK_NULL_HANDLE);
+        // The user set (set 1) is re-allocated from the per-frame pools whenever its bindings change.
+        shader->SetTransientUserSet(&m_TransientDescriptors, set1Layout);
+        if (useBindless) shader->SetBindlessSet(m_BindlessHeap.GetDescriptorSet());
         shader->SetReflection(reflForVk);
 
         NV_LOG_INFO("Fullscreen shader pipeline created.");
@@ -1277,20 +1415,6 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
             if (it != m_FullscreenPipelines.end())
                 m_FullscreenPipelines.erase(it);
 
-            if (auto itState = m_FullscreenPipelineState.find(pipeline); itState != m_FullscreenPipelineState.end()) {
-                const auto state = itState->second;
-                if (state.userSet != VK_NULL_HANDLE) {
-                    VkDescriptorPool pool = m_VKSwapchain.GetImGuiDescriptorPool();
-                    if (pool != VK_NULL_HANDLE) {
-                        vkFreeDescriptorSets(m_VKDevice.GetDevice(), pool, 1, &state.userSet);
-                    }
-                }
-                if (state.layout != VK_NULL_HANDLE) vkDestroyPipelineLayout(m_VKDevice.GetDevice(), state.layout, nullptr);
-                if (state.set0Layout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(m_VKDevice.GetDevice(), state.set0Layout, nullptr);
-                if (state.set1Layout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(m_VKDevice.GetDevice(), state.set1Layout, nullptr);
-                m_FullscreenPipelineState.erase(itState);
-            }
-
             vkDestroyPipeline(m_VKDevice.GetDevice(), pipeline, nullptr);
         }
 
@@ -1316,4 +1440,264 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         vkCmdDraw(cmd, 6, 1, 0, 0);
     }
 
-} // namespace Nova::Core::Renderer::Backends::Vulkan
\ No newline at end of file
+    // =========================================================================
+    // Compute
+    // =========================================================================
+
+    std::vector<uint32_t> VK_Renderer::GetSharedQueueFamilies() const {
+        std::vector<uint32_t> families = { m_VKDevice.GetGraphicsQueueFamily() };
+        if (m_HasAsyncCompute)
+            families.push_back(m_VKDevice.GetComputeQueueFamily());
+        return families;
+    }
+
+    bool VK_Renderer::CreateComputeResources() {
+        VkDevice device = m_VKDevice.GetDevice();
+
+        m_HasAsyncCompute = m_VKDevice.GetComputeQueue() != VK_NULL_HANDLE &&
+            m_VKDevice.GetComputeQueueFamily() != m_VKDevice.GetGraphicsQueueFamily();
+
+        if (m_HasAsyncCompute && !m_VKDevice.IsTimelineSemaphoreSupported()) {
+            NV_LOG_WARN("VK_Renderer: timeline semaphores unsupported, async dispatches run on the graphics queue.");
+            m_HasAsyncCompute = false;
+        }
+
+        if (m_HasAsyncCompute) {
+            VkSemaphoreTypeCreateInfo typeInfo{};
+            typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+            typeInfo.initialValue = 0;
+
+            VkSemaphoreCreateInfo timelineInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+            timelineInfo.pNext = &typeInfo;
+
+            VkResult res = vkCreateSemaphore(device, &timelineInfo, nullptr, &m_GraphicsTimeline);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) {
+                NV_LOG_WARN("VK_Renderer: graphics timeline semaphore creation failed, using the graphics queue.");
+                m_GraphicsTimeline = VK_NULL_HANDLE;
+                m_HasAsyncCompute = false;
+            }
+            m_GraphicsTimelineValue = 0;
+        }
+
+        if (m_HasAsyncCompute) {
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.queueFamilyIndex = m_VKDevice.GetComputeQueueFamily();
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+            VkResult res = vkCreateCommandPool(device, &poolInfo, nullptr, &m_AsyncComputeCommandPool);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) {
+                NV_LOG_WARN("VK_Renderer: async compute command pool creation failed, using the graphics queue.");
+                m_HasAsyncCompute = false;
+            }
+        }
+
+        for (auto& cf : m_ComputeFrames) {
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandPool = m_VKSwapchain.GetCommandPool();
+            allocInfo.commandBufferCount = 1;
+
+            VkResult res = vkAllocateCommandBuffers(device, &allocInfo, &cf.m_GraphicsCmd);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) return false;
+
+            if (!m_HasAsyncCompute)
+                continue;
+
+            allocInfo.commandPool = m_AsyncComputeCommandPool;
+            res = vkAllocateCommandBuffers(device, &allocInfo, &cf.m_AsyncCmd);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) return false;
+
+            VkSemaphoreCreateInfo semInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+            res = vkCreateSemaphore(device, &semInfo, nullptr, &cf.m_AsyncDone);
+            CheckVkResult(res);
+            if (res != VK_SUCCESS) return false;
+        }
+
+        NV_LOG_INFO(m_HasAsyncCompute
+            ? "Compute: async compute queue available."
+            : "Compute: no dedicated compute queue, async dispatches run on the graphics queue.");
+        return true;
+    }
+
+    void VK_Renderer::DestroyComputeResources() {
+        VkDevice device = m_VKDevice.GetDevice();
+        if (device == VK_NULL_HANDLE) return;
+
+        for (auto& cf : m_ComputeFrames) {
+            if (cf.m_GraphicsCmd != VK_NULL_HANDLE && m_VKSwapchain.GetCommandPool() != VK_NULL_HANDLE)
+                vkFreeCommandBuffers(device, m_VKSwapchain.GetCommandPool(), 1, &cf.m_GraphicsCmd);
+            if (cf.m_AsyncDone != VK_NULL_HANDLE)
+                vkDestroySemaphore(device, cf.m_AsyncDone, nullptr);
+            cf = ComputeFrame{};
+        }
+
+        // Destroying the pool frees the async command buffers.
+        if (m_AsyncComputeCommandPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(device, m_AsyncComputeCommandPool, nullptr);
+            m_AsyncComputeCommandPool = VK_NULL_HANDLE;
+        }
+        if (m_GraphicsTimeline != VK_NULL_HANDLE) {
+            vkDestroySemaphore(device, m_GraphicsTimeline, nullptr);
+            m_GraphicsTimeline = VK_NULL_HANDLE;
+        }
+        m_GraphicsTimelineValue = 0;
+        m_HasAsyncCompute = false;
+    }
+
+    VkCommandBuffer VK_Renderer::GetComputeCommandBuffer(RHI::RHI_QueueType queue) {
+        if (!m_FrameActive) return VK_NULL_HANDLE;
+
+        auto& cf = m_ComputeFrames[m_VKSwapchain.GetCurrentFrame()];
+        const bool async = (queue == RHI::RHI_QueueType::AsyncCompute) && m_HasAsyncCompute;
+
+        VkCommandBuffer cmd = async ? cf.m_AsyncCmd : cf.m_GraphicsCmd;
+        bool& recording = async ? cf.m_AsyncRecording : cf.m_GraphicsRecording;
+
+        if (!recording) {
+            // Safe to reuse: BeginFrame waited on this frame's fence, which also covers async work.
+            VkCommandBufferBeginInfo beginInfo{};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            CheckVkResult(vkBeginCommandBuffer(cmd, &beginInfo));
+            recording = true;
+
+            if (!async) {
+                // Write-after-read: the previous frame's submits on this queue may still be reading
+                // what this frame's dispatches overwrite (async work waits on m_GraphicsTimeline instead).
+                vkCmdPipelineBarrier(cmd,
+                    VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                    VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+                    VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                    VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                    0, 0, nullptr, 0, nullptr, 0, nullptr);
+            }
+        }
+        else {
+            // Serialize with the previous dispatch so chained passes see each other's writes.
+            VkMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            vkCmdPipelineBarrier(cmd,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                0, 1, &barrier, 0, nullptr, 0, nullptr);
+        }
+
+        return cmd;
+    }
+
+    RHI::RHI_Shaders* VK_Renderer::CreateComputeShader(const RHI::RHI_ShaderCompileInput& computeIn) {
+        RHI::RHI_ShaderCompileInput input = computeIn;
+        if (input.m_Stage == RHI::RHI_ShaderStage::Unknown)
+            input.m_Stage = RHI::ShaderStageFromFileExtension(input.m_File);
+
+        if (input.m_Stage != RHI::RHI_ShaderStage::Compute) {
+            NV_LOG_WARN(("CreateComputeShader: not a compute shader: " + input.m_File.generic_string()).c_str());
+            return nullptr;
+        }
+
+        RHI::RHI_ShaderCompileResult out = RHI::RHI_ShaderCompiler::Compile(input);
+        if (!out.m_Success) {
+            NV_LOG_WARN(("CreateComputeShader compile failed:\n" + out.m_Log).c_str());
+            return nullptr;
+        }
+
+        auto* shader = new VK_ComputeShaders();
+        if (!shader->Create(m_VKDevice.GetDevice(), m_TransientDescriptors, m_VKDevice.GetLayoutCache(),
+                &m_BindlessHeap, out.m_Binary, out.m_Reflection, input.m_EntryPoint.c_str())) {
+            delete shader;
+            return nullptr;
+        }
+
+        NV_LOG_INFO("Compute shader pipeline created.");
+        return shader;
+    }
+
+    void VK_Renderer::DestroyComputeShader(RHI::RHI_Shaders* shader) {
+        if (!shader) return;
+        vkDeviceWaitIdle(m_VKDevice.GetDevice());
+        delete static_cast<VK_ComputeShaders*>(shader);
+    }
+
+    void VK_Renderer::Dispatch(RHI::RHI_Shaders* shader, uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ, RHI::RHI_QueueType queue) {
+        auto* compute = dynamic_cast<VK_ComputeShaders*>(shader);
+        if (!compute || !compute->IsValid()) {
+            NV_LOG_WARN("Dispatch: shader was not created with CreateComputeShader()");
+            return;
+        }
+
+        VkCommandBuffer cmd = GetComputeCommandBuffer(queue);
+        if (cmd == VK_NULL_HANDLE) return;
+
+        compute->Bind(cmd);
+        compute->ApplyParameters(cmd);
+        vkCmdDispatch(cmd, groupsX, groupsY, groupsZ);
+    }
+
+    void VK_Renderer::DispatchIndirect(RHI::RHI_Shaders* shader, const RHI::RHI_Buffer& args, uint64_t offset, RHI::RHI_QueueType queue) {
+        auto* compute = dynamic_cast<VK_ComputeShaders*>(shader);
+        if (!compute || !compute->IsValid()) {
+            NV_LOG_WARN("DispatchIndirect: shader was not created with CreateComputeShader()");
+            return;
+        }
+        if (!RHI::HasUsage(args.GetDesc().m_Usage, RHI::RHI_BufferUsage::Indirect)) {
+            NV_LOG_WARN("DispatchIndirect: argument buffer was not created with RHI_BufferUsage::Indirect");
+            return;
+        }
+
+        VkCommandBuffer cmd = GetComputeCommandBuffer(queue);
+        if (cmd == VK_NULL_HANDLE) return;
+
+        compute->Bind(cmd);
+        compute->ApplyParameters(cmd);
+        vkCmdDispatchIndirect(cmd, reinterpret_cast<VkBuffer>(args.GetNativeHandle()), static_cast<VkDeviceSize>(offset));
+    }
+
+    std::shared_ptr<RHI::RHI_Buffer> VK_Renderer::CreateBuffer(const RHI::RHI_BufferDesc& desc) {
+        auto buffer = std::make_shared<VK_Buffer>();
+        if (!buffer->Create(m_VKDevice.GetPhysicalDevice(), m_VKDevice.GetDevice(), desc, GetSharedQueueFamilies()))
+            return nullptr;
+        return buffer;
+    }
+
+    std::shared_ptr<RHI::RHI_Image> VK_Renderer::CreateStorageImage(const RHI::RHI_ImageDesc& desc) {
+        auto image = std::make_shared<VK_StorageImage>();
+        if (!image->Create(m_VKDevice.GetPhysicalDevice(), m_VKDevice.GetDevice(),
+                m_VKSwapchain.GetCommandPool(), m_VKDevice.GetGraphicsQueue(),
+                desc, GetSharedQueueFamilies()))
+        {
+            return nullptr;
+        }
+        return image;
+    }
+
+    uint32_t VK_Renderer::RegisterBindlessTexture(const RHI::RHI_Image& image) {
+        // Storage images stay in the general layout (see VK_StorageImage).
+        return m_BindlessHeap.RegisterTexture(reinterpret_cast<VkImageView>(image.GetViewHandle()), VK_IMAGE_LAYOUT_GENERAL);
+    }
+
+    uint32_t VK_Renderer::RegisterBindlessBuffer(const RHI::RHI_Buffer& buffer) {
+        if (!RHI::HasUsage(buffer.GetDesc().m_Usage, RHI::RHI_BufferUsage::Storage)) {
+            NV_LOG_WARN("RegisterBindlessBuffer: buffer was not created with RHI_BufferUsage::Storage");
+            return RHI::kInvalidBindlessIndex;
+        }
+        return m_BindlessHeap.RegisterBuffer(reinterpret_cast<VkBuffer>(buffer.GetNativeHandle()));
+    }
+
+    void VK_Renderer::ReleaseBindlessTexture(uint32_t index) {
+        m_BindlessHeap.ReleaseTexture(index);
+    }
+
+    void VK_Renderer::ReleaseBindlessBuffer(uint32_t index) {
+        m_BindlessHeap.ReleaseBuffer(index);
+    }
+
+} // namespace Nova::Core::Renderer::Backends::Vulkan
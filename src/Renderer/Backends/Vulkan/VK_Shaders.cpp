@@ -38,6 +38,42 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         }
     }
 
+    VkPushConstantRange GetDrawPushConstantRange() {
+        VkPushConstantRange range{};
+        range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        range.offset = 0;
+        range.size = static_cast<uint32_t>(sizeof(RHI::DrawPushConstants));
+        return range;
+    }
+
+    void VK_SpecializationData::Build(const RHI::RHI_ShaderKeywordSet& keywords, RHI::RHI_ShaderVariantMask mask) {
+        m_Entries.clear();
+        m_Values.clear();
+
+        const auto& list = keywords.GetKeywords();
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (list[i].m_Kind != RHI::RHI_ShaderKeywordKind::Specialization) continue;
+            m_Values.push_back((mask & (RHI::RHI_ShaderVariantMask{ 1 } << i)) ? VK_TRUE : VK_FALSE);
+        }
+
+        uint32_t slot = 0;
+        for (const auto& k : list) {
+            if (k.m_Kind != RHI::RHI_ShaderKeywordKind::Specialization) continue;
+            VkSpecializationMapEntry entry{};
+            entry.constantID = k.m_SpecConstantId;
+            entry.offset = slot * static_cast<uint32_t>(sizeof(VkBool32));
+            entry.size = sizeof(VkBool32);
+            m_Entries.push_back(entry);
+            ++slot;
+        }
+
+        m_Info = {};
+        m_Info.mapEntryCount = static_cast<uint32_t>(m_Entries.size());
+        m_Info.pMapEntries = m_Entries.data();
+        m_Info.dataSize = m_Values.size() * sizeof(VkBool32);
+        m_Info.pData = m_Values.data();
+    }
+
     // --- VK_Shaders ---
     void VK_Shaders::SetPipeline(VkPipeline pipeline, VkPipelineLayout layout) {
         m_Pipeline = pipeline;
@@ -73,12 +109,43 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
     void VK_Shaders::ResetDynamicUBOs() {
         m_MvpDynamicOffset = 0;
         m_MaterialDynamicOffset = 0;
+        m_HasLastMvp = false;
+        m_HasLastMaterial = false;
+        InvalidateBindings();
+    }
+
+    void VK_Shaders::InvalidateBindings() {
+        m_BoundCmd = VK_NULL_HANDLE;
+        m_EngineSetBound = false;
+        m_UserSetBound = false;
+        m_BindlessSetBound = false;
+    }
+
+    void VK_Shaders::SetTransientUserSet(VK_DescriptorAllocator* allocator, VkDescriptorSetLayout userSetLayout) {
+        m_TransientDescriptors = allocator;
+        m_TransientUserLayout = userSetLayout;
+        m_UserWrites.clear();
+        m_UserWritesDirty = false;
+        m_UserSetSerial = 0;
+        if (m_TransientDescriptors) m_UserDescriptorSet = VK_NULL_HANDLE;
+        m_UserSetBound = false;
     }
 
     void VK_Shaders::WriteUserDescriptor(uint32_t binding, VkDescriptorType type,
         const VkDescriptorBufferInfo* bufferInfo,
         const VkDescriptorImageInfo* imageInfo)
     {
+        if (m_TransientDescriptors) {
+            VK_DescriptorWrite write;
+            write.m_Binding = binding;
+            write.m_Type = type;
+            if (bufferInfo) write.m_BufferInfo = *bufferInfo;
+            if (imageInfo) write.m_ImageInfo = *imageInfo;
+            StoreDescriptorWrite(m_UserWrites, write);
+            m_UserWritesDirty = true;
+            return;
+        }
+
         if (m_Device == VK_NULL_HANDLE || m_UserDescriptorSet == VK_NULL_HANDLE) return;
 
         VkWriteDescriptorSet write{};
@@ -111,47 +178,54 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
     bool VK_Shaders::ApplyResourceBinding(const RHI::RHI_BindingInfo& info, const RHI::RHI_ResourceBinding& value) {
         // This class only supports updating the user descriptor set (set 1).
         if (info.m_Key.m_Set != RHI::kUserDescriptorSet) return false;
-        if (m_Device == VK_NULL_HANDLE || m_UserDescriptorSet == VK_NULL_HANDLE) return false;
+        if (m_Device == VK_NULL_HANDLE) return false;
+        if (!m_TransientDescriptors && m_UserDescriptorSet == VK_NULL_HANDLE) return false;
 
         const VkDescriptorType type = ToVkDescriptorType(info.m_Kind);
         if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) return false;
 
-        const uint32_t binding = info.m_Key.m_Binding;
+        VK_DescriptorWrite write;
+        if (!MakeDescriptorWrite(info.m_Key.m_Binding, type, value, write)) return false;
 
-        if (std::holds_alternative<RHI::RHI_BufferBinding>(value)) {
-            const auto b = std::get<RHI::RHI_BufferBinding>(value);
-            VkDescriptorBufferInfo bi{};
-            bi.buffer = reinterpret_cast<VkBuffer>(b.m_Handle);
-            bi.offset = static_cast<VkDeviceSize>(b.m_Offset);
-            bi.range = (b.m_Range == 0) ? VK_WHOLE_SIZE : static_cast<VkDeviceSize>(b.m_Range);
-            WriteUserDescriptor(binding, type, &bi, nullptr);
-            return true;
-        }
+        const bool isBuffer = std::holds_alternative<RHI::RHI_BufferBinding>(value);
+        WriteUserDescriptor(write.m_Binding, write.m_Type,
+            isBuffer ? &write.m_BufferInfo : nullptr,
+            isBuffer ? nullptr : &write.m_ImageInfo);
+        return true;
+    }
 
-        if (std::holds_alternative<RHI::RHI_TextureBinding>(value)) {
-            const auto t = std::get<RHI::RHI_TextureBinding>(value);
-            VkDescriptorImageInfo ii{};
-            ii.imageView = reinterpret_cast<VkImageView>(t.m_TextureHandle);
-            ii.imageLayout = (t.m_ImageLayout == 0) ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : static_cast<VkImageLayout>(t.m_ImageLayout);
-            WriteUserDescriptor(binding, type, nullptr, &ii);
-            return true;
-        }
+    void VK_Shaders::RefreshTransientUserSet() {
+        if (!m_TransientDescriptors || m_TransientUserLayout == VK_NULL_HANDLE || m_UserWrites.empty()) return;
+
+        const uint64_t frameSerial = m_TransientDescriptors->GetFrameSerial();
+        if (!m_UserWritesDirty && m_UserDescriptorSet != VK_NULL_HANDLE && m_UserSetSerial == frameSerial) return;
 
-        if (std::holds_alternative<RHI::RHI_SamplerBinding>(value)) {
-            const auto s = std::get<RHI::RHI_SamplerBinding>(value);
-            VkDescriptorImageInfo ii{};
-            ii.sampler = reinterpret_cast<VkSampler>(s.m_SamplerHandle);
-            WriteUserDescriptor(binding, type, nullptr, &ii);
-            return true;
+        m_UserDescriptorSet = m_TransientDescriptors->Allocate(m_TransientUserLayout);
+        ApplyDescriptorWrites(m_Device, m_UserDescriptorSet, m_UserWrites);
+        m_UserSetSerial = frameSerial;
+        m_UserWritesDirty = false;
+        m_UserSetBound = false;
+    }
+
+    VkPipeline VK_Shaders::ResolvePipeline() {
+        RHI::RHI_ShaderVariantMask mask = GetKeywordMask();
+
+        // Legacy toggle: the u_UseInstancing frame uniform selects the USE_INSTANCING variant.
+        if (auto it = m_Parameters.find("u_UseInstancing"); it != m_Parameters.end() && std::holds_alternative<int>(it->second)) {
+            const RHI::RHI_ShaderVariantMask bit = m_Keywords.GetBit("USE_INSTANCING");
+            mask = (std::get<int>(it->second) != 0) ? (mask | bit) : (mask & ~bit);
         }
 
-        return false;
+        if (mask == 0 || !m_VariantFactory) return m_Pipeline;
+
+        VkPipeline variant = m_VariantFactory(mask);
+        return (variant != VK_NULL_HANDLE) ? variant : m_Pipeline;
     }
 
     void VK_Shaders::Bind(void* apiContext) {
         if (!apiContext || m_Pipeline == VK_NULL_HANDLE) return;
         VkCommandBuffer cmd = static_cast<VkCommandBuffer>(apiContext);
-        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, ResolvePipeline());
     }
 
     void VK_Shaders::UploadFrameUniforms() {
@@ -183,26 +257,39 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         }
     }
 
-    void VK_Shaders::UploadMvpUniforms(VkDeviceSize& outDynamicOffsetThisDraw) {
+    void VK_Shaders::UploadMvpUniforms(VkDeviceSize& outDynamicOffsetThisDraw, bool modelInPushConstants) {
         outDynamicOffsetThisDraw = 0;
 
         RHI::MVP mvp{};
         if (m_BufMvp != VK_NULL_HANDLE) {
             auto itM = m_Parameters.find("model"), itV = m_Parameters.find("view"), itP = m_Parameters.find("proj"), itVP = m_Parameters.find("viewProj"), itInvVP = m_Parameters.find("invViewProj");
-            if (itM != m_Parameters.end() && std::holds_alternative<glm::mat4>(itM->second)) mvp.m_Model = std::get<glm::mat4>(itM->second);
+            if (!modelInPushConstants && itM != m_Parameters.end() && std::holds_alternative<glm::mat4>(itM->second)) mvp.m_Model = std::get<glm::mat4>(itM->second);
             if (itV != m_Parameters.end() && std::holds_alternative<glm::mat4>(itV->second)) mvp.m_View = std::get<glm::mat4>(itV->second);
             if (itP != m_Parameters.end() && std::holds_alternative<glm::mat4>(itP->second)) mvp.m_Proj = std::get<glm::mat4>(itP->second);
             if (itVP != m_Parameters.end() && std::holds_alternative<glm::mat4>(itVP->second)) mvp.m_ViewProj = std::get<glm::mat4>(itVP->second);
             if (itInvVP != m_Parameters.end() && std::holds_alternative<glm::mat4>(itInvVP->second)) mvp.m_InvViewProj = std::get<glm::mat4>(itInvVP->second);
+            if (!modelInPushConstants) {
+                auto itN = m_Parameters.find("normalMatrix");
+                if (itN != m_Parameters.end() && std::holds_alternative<glm::mat4>(itN->second)) mvp.m_Normal = std::get<glm::mat4>(itN->second);
+            }
         }
 
         if (m_BufMvpMemory != VK_NULL_HANDLE && m_MvpDynamicStride != 0) {
+            // With the model matrix in push constants this only changes once per pass.
+            if (m_HasLastMvp && std::memcmp(&mvp, &m_LastMvp, sizeof(RHI::MVP)) == 0) {
+                outDynamicOffsetThisDraw = m_LastMvpOffset;
+                return;
+            }
+
             outDynamicOffsetThisDraw = m_MvpDynamicOffset;
             void* mapped = nullptr;
             if (vkMapMemory(m_Device, m_BufMvpMemory, outDynamicOffsetThisDraw, sizeof(RHI::MVP), 0, &mapped) == VK_SUCCESS) {
                 std::memcpy(mapped, &mvp, sizeof(RHI::MVP));
                 vkUnmapMemory(m_Device, m_BufMvpMemory);
             }
+            m_LastMvp = mvp;
+            m_LastMvpOffset = outDynamicOffsetThisDraw;
+            m_HasLastMvp = true;
             m_MvpDynamicOffset += m_MvpDynamicStride;
         }
     }
@@ -230,18 +317,34 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         }
 
         if (m_BufMaterialsMemory != VK_NULL_HANDLE && m_MaterialDynamicStride != 0) {
+            if (m_HasLastMaterial && material == m_LastMaterial) {
+                outDynamicOffsetThisDraw = m_LastMaterialOffset;
+                return;
+            }
+
             outDynamicOffsetThisDraw = m_MaterialDynamicOffset;
             void* mapped = nullptr;
             if (vkMapMemory(m_Device, m_BufMaterialsMemory, outDynamicOffsetThisDraw, sizeof(RHI::Material), 0, &mapped) == VK_SUCCESS) {
                 std::memcpy(mapped, &material, sizeof(RHI::Material));
                 vkUnmapMemory(m_Device, m_BufMaterialsMemory);
             }
+            m_LastMaterial = material;
+            m_LastMaterialOffset = outDynamicOffsetThisDraw;
+            m_HasLastMaterial = true;
             m_MaterialDynamicOffset += m_MaterialDynamicStride;
         }
     }
 
     void VK_Shaders::BindDescriptorSets(VkCommandBuffer cmd, VkDeviceSize mvpDynamicOffset, VkDeviceSize materialDynamicOffset) {
-        if (m_SceneDescriptorSet != VK_NULL_HANDLE) {
+        if (cmd != m_BoundCmd) {
+            InvalidateBindings();
+            m_BoundCmd = cmd;
+        }
+
+        const bool engineSetCurrent = m_EngineSetBound &&
+            m_BoundMvpOffset == mvpDynamicOffset && m_BoundMaterialOffset == materialDynamicOffset;
+
+        if (m_SceneDescriptorSet != VK_NULL_HANDLE && !engineSetCurrent) {
             uint32_t dynOffsets[2] = {
                 static_cast<uint32_t>(mvpDynamicOffset),
                 static_cast<uint32_t>(materialDynamicOffset)
@@ -261,26 +364,59 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
                 vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
                     static_cast<uint32_t>(RHI::kEngineDescriptorSet), 1, &m_SceneDescriptorSet, 0, nullptr);
             }
+
+            m_BoundMvpOffset = mvpDynamicOffset;
+            m_BoundMaterialOffset = materialDynamicOffset;
+            m_EngineSetBound = true;
         }
 
-        if (m_UserDescriptorSet != VK_NULL_HANDLE) {
+        RefreshTransientUserSet();
+        if (m_UserDescriptorSet != VK_NULL_HANDLE && !m_UserSetBound) {
             vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
                 static_cast<uint32_t>(RHI::kUserDescriptorSet), 1, &m_UserDescriptorSet, 0, nullptr);
+            m_UserSetBound = true;
+        }
+
+        if (m_BindlessDescriptorSet != VK_NULL_HANDLE && !m_BindlessSetBound) {
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
+                static_cast<uint32_t>(RHI::kBindlessDescriptorSet), 1, &m_BindlessDescriptorSet, 0, nullptr);
+            m_BindlessSetBound = true;
         }
     }
 
+    void VK_Shaders::PushDrawConstants(VkCommandBuffer cmd) {
+        RHI::DrawPushConstants constants{};
+        auto itM = m_Parameters.find("model");
+        if (itM != m_Parameters.end() && std::holds_alternative<glm::mat4>(itM->second))
+            constants.m_Model = std::get<glm::mat4>(itM->second);
+        auto itN = m_Parameters.find("normalMatrix");
+        if (itN != m_Parameters.end() && std::holds_alternative<glm::mat4>(itN->second))
+            constants.m_Normal = std::get<glm::mat4>(itN->second);
+
+        const VkPushConstantRange range = GetDrawPushConstantRange();
+        vkCmdPushConstants(cmd, m_PipelineLayout, range.stageFlags, range.offset, range.size, &constants);
+    }
+
     void VK_Shaders::ApplyParameters(void* apiContext) {
         if (!apiContext || m_PipelineLayout == VK_NULL_HANDLE) return;
         VkCommandBuffer cmd = static_cast<VkCommandBuffer>(apiContext);
 
         UploadFrameUniforms();
 
+        // Shaders that declare push constants (DrawConstants.slang) get the model matrix pushed,
+        // which keeps the MVP region, and therefore the engine set binding, stable across draws.
+        const auto& pushConstants = GetReflection().m_PushConstants;
+        const bool usePushConstants = pushConstants.has_value() && pushConstants->m_SizeBytes > 0;
+
         VkDeviceSize mvpOffsetThisDraw = 0;
         VkDeviceSize materialOffsetThisDraw = 0;
-        UploadMvpUniforms(mvpOffsetThisDraw);
+        UploadMvpUniforms(mvpOffsetThisDraw, usePushConstants);
         UploadMaterialUniforms(materialOffsetThisDraw);
 
         BindDescriptorSets(cmd, mvpOffsetThisDraw, materialOffsetThisDraw);
+
+        if (usePushConstants)
+            PushDrawConstants(cmd);
     }
 
     void VK_Shaders::UploadInstanceBuffer(const std::vector<RHI::Instance>& instances) {
@@ -295,6 +431,7 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
         if (vkMapMemory(m_Device, m_BufInstancesMemory, 0, requiredSize, 0, &mapped) != VK_SUCCESS)
             return;
 
+        // Normals come precomputed with the instances (see RHI::Instance), so this is a straight copy.
         std::memcpy(mapped, instances.data(), static_cast<size_t>(requiredSize));
         vkUnmapMemory(m_Device, m_BufInstancesMemory);
     }
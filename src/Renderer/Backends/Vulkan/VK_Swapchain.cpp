@@ -8,6 +8,7 @@
 #include "Core/Assert.h"
 #include "Core/Log.h"
 #include "Renderer/Backends/Vulkan/VK_Common.h"
+#include "Renderer/Backends/Vulkan/VK_DescriptorLayoutCache.h"
 #include "Renderer/RHI/RHI_Shaders.h"
 #include "Renderer/RHI/RHI_ShaderUniforms.h"
 #include "Renderer/RHI/RHI_ShaderReflection.h"
@@ -19,87 +20,6 @@
 
 namespace Nova::Core::Renderer::Backends::Vulkan {
 
-	static VkShaderStageFlags ToVkStageFlags(RHI::RHI_ShaderStageMask mask) {
-		VkShaderStageFlags out = 0;
-		const uint32_t m = static_cast<uint32_t>(mask);
-		if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Vertex)) out |= VK_SHADER_STAGE_VERTEX_BIT;
-		if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Fragment)) out |= VK_SHADER_STAGE_FRAGMENT_BIT;
-		if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Geometry)) out |= VK_SHADER_STAGE_GEOMETRY_BIT;
-		if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::TessCtrl)) out |= VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
-		if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::TessEval)) out |= VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
-		if (m & static_cast<uint32_t>(RHI::RHI_ShaderStageMask::Compute)) out |= VK_SHADER_STAGE_COMPUTE_BIT;
-		return out;
-	}
-
-	static VkDescriptorType ToVkDescriptorType(const RHI::RHI_BindingInfo& b) {
-		using RK = RHI::RHI_ResourceKind;
-		switch (b.m_Kind) {
-			case RK::ConstantBuffer: return b.m_IsDynamicUniformBuffer ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-			case RK::StorageBuffer:  return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-			case RK::Texture:        return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-			case RK::Sampler:        return VK_DESCRIPTOR_TYPE_SAMPLER;
-			case RK::CombinedTextureSampler: return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-			case RK::RWTexture:      return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-			case RK::RWBuffer:       return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-			default:                 return VK_DESCRIPTOR_TYPE_MAX_ENUM;
-		}
-	}
-
-	static bool CreateDescriptorSetLayoutFromReflection(
-		VkDevice device,
-		const RHI::RHI_ProgramReflection& refl,
-		uint32_t setIndex,
-		VkDescriptorSetLayout& outLayout)
-	{
-		outLayout = VK_NULL_HANDLE;
-		const auto* set = refl.FindSet(setIndex);
-		if ((!set || set->m_Bindings.empty()) && setIndex != RHI::kUserDescriptorSet) {
-			return false;
-		}
-
-		std::vector<VkDescriptorSetLayoutBinding> bindings;
-		if (set) {
-			bindings.reserve(set->m_Bindings.size());
-			for (const auto& b : set->m_Bindings) {
-				VkDescriptorType type = ToVkDescriptorType(b);
-				if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM) continue;
-
-				VkDescriptorSetLayoutBinding vkB{};
-				vkB.binding = b.m_Key.m_Binding;
-				vkB.descriptorType = type;
-				vkB.descriptorCount = (b.m_ArrayCount == 0) ? 1u : b.m_ArrayCount;
-				vkB.stageFlags = ToVkStageFlags(b.m_Stages);
-				bindings.push_back(vkB);
-			}
-		}
-
-		// Safety net: ensure (set,binding) pairs referenced by nameToBinding exist in the set layout.
-		if (setIndex == RHI::kUserDescriptorSet) {
-			// Conservative default: ensure binding 0 exists for user set.
-			const bool has0 = std::any_of(bindings.begin(), bindings.end(),
-				[](const VkDescriptorSetLayoutBinding& b) { return b.binding == 0; });
-			if (!has0) {
-				VkDescriptorSetLayoutBinding vkB{};
-				vkB.binding = 0;
-				vkB.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-				vkB.descriptorCount = 1;
-				vkB.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-				bindings.push_back(vkB);
-			}
-		}
-
-		if (bindings.empty()) return false;
-
-		VkDescriptorSetLayoutCreateInfo info{};
-		info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-		info.bindingCount = static_cast<uint32_t>(bindings.size());
-		info.pBindings = bindings.data();
-
-		const VkResult res = vkCreateDescriptorSetLayout(device, &info, nullptr, &outLayout);
-		CheckVkResult(res);
-		return (res == VK_SUCCESS);
-	}
-
 	VK_Swapchain::VK_SwapchainSupportDetails VK_Swapchain::QuerySwapChainSupport(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface) {
 
 		VK_SwapchainSupportDetails details{};
@@ -156,18 +76,64 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		return availableFormats[0];
 	}
 
-	VkPresentModeKHR VK_Swapchain::ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) {
-		// Mailbox = low latency, no tearing (if available).
-		for (const auto& pm : availablePresentModes) {
-			if (pm == VK_PRESENT_MODE_MAILBOX_KHR)
-				return pm;
+	// Hot reload keeps the descriptor sets and pipeline layout, so only programs that declare the
+	// same user resources (and no larger push constants) can be swapped in. Set 0 is the canonical
+	// engine layout, whatever subset of it a program reads (see IsEngineSetCompatible).
+	static bool HasCompatibleBindings(const RHI::RHI_ProgramReflection& a, const RHI::RHI_ProgramReflection& b) {
+		auto userSets = [](const RHI::RHI_ProgramReflection& r) {
+			return std::count_if(r.m_Sets.begin(), r.m_Sets.end(),
+				[](const RHI::RHI_DescriptorSetLayoutInfo& set) { return set.m_Set != RHI::kEngineDescriptorSet; });
+		};
+		if (userSets(a) != userSets(b)) return false;
+		for (const auto& setA : a.m_Sets) {
+			if (setA.m_Set == RHI::kEngineDescriptorSet) continue;
+			const RHI::RHI_DescriptorSetLayoutInfo* setB = b.FindSet(setA.m_Set);
+			if (!setB || setA.m_Bindings.size() != setB->m_Bindings.size()) return false;
+			for (const auto& binding : setA.m_Bindings) {
+				const RHI::RHI_BindingInfo* other = b.FindBinding(binding.m_Key.m_Set, binding.m_Key.m_Binding);
+				if (!other || other->m_Kind != binding.m_Kind || other->m_ArrayCount != binding.m_ArrayCount) return false;
+			}
 		}
+		const size_t pushA = a.m_PushConstants ? a.m_PushConstants->m_SizeBytes : 0;
+		const size_t pushB = b.m_PushConstants ? b.m_PushConstants->m_SizeBytes : 0;
+		return pushA <= std::max(pushB, sizeof(RHI::DrawPushConstants)); // layout range covers both
+	}
 
-		// Immediate = tearing possible, but low latency.
-		for (const auto& pm : availablePresentModes) {
-			if (pm == VK_PRESENT_MODE_IMMEDIATE_KHR)
-				return pm;
+	static VkPresentModeKHR ToVkPresentMode(Core::PresentMode mode) {
+		switch (mode) {
+		case Core::PresentMode::FifoRelaxed: return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+		case Core::PresentMode::Mailbox:     return VK_PRESENT_MODE_MAILBOX_KHR;
+		case Core::PresentMode::Immediate:   return VK_PRESENT_MODE_IMMEDIATE_KHR;
+		case Core::PresentMode::Fifo:
+		case Core::PresentMode::Auto:
+		default:                             return VK_PRESENT_MODE_FIFO_KHR;
 		}
+	}
+
+	static const char* PresentModeToString(VkPresentModeKHR mode) {
+		switch (mode) {
+		case VK_PRESENT_MODE_IMMEDIATE_KHR:    return "IMMEDIATE";
+		case VK_PRESENT_MODE_MAILBOX_KHR:      return "MAILBOX";
+		case VK_PRESENT_MODE_FIFO_KHR:         return "FIFO";
+		case VK_PRESENT_MODE_FIFO_RELAXED_KHR: return "FIFO_RELAXED";
+		default:                               return "UNKNOWN";
+		}
+	}
+
+	VkPresentModeKHR VK_Swapchain::ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) {
+		auto isAvailable = [&](VkPresentModeKHR mode) {
+			return std::find(availablePresentModes.begin(), availablePresentModes.end(), mode) != availablePresentModes.end();
+		};
+
+		const VkPresentModeKHR requested = ToVkPresentMode(m_RequestedPresentMode);
+		if (isAvailable(requested))
+			return requested;
+
+		// Closest fallback: keep "no vsync" requests unthrottled if possible.
+		if (requested == VK_PRESENT_MODE_MAILBOX_KHR && isAvailable(VK_PRESENT_MODE_IMMEDIATE_KHR))
+			return VK_PRESENT_MODE_IMMEDIATE_KHR;
+		if (requested == VK_PRESENT_MODE_IMMEDIATE_KHR && isAvailable(VK_PRESENT_MODE_MAILBOX_KHR))
+			return VK_PRESENT_MODE_MAILBOX_KHR;
 
 		// FIFO is guaranteed by the spec.
 		return VK_PRESENT_MODE_FIFO_KHR;
@@ -287,6 +253,7 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 
 		m_WindowExtent = { 0, 0 };
 		m_FramebufferResized = false;
+		m_WaitForPresentFn = nullptr;
 
 		NV_LOG_INFO("VK_Swapchain destroyed.");
 	}
@@ -332,6 +299,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		createInfo.preTransform = swapChainSupport.m_Capabilities.currentTransform;
 		createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
 		createInfo.presentMode = presentMode;
+		m_PresentMode = presentMode;
+		m_PresentId = 0;
 		createInfo.clipped = VK_TRUE;
 		createInfo.oldSwapchain = VK_NULL_HANDLE;
 
@@ -357,7 +326,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		// fence-per-image tracking
 		m_ImagesInFlight.assign(m_Frames.size(), VK_NULL_HANDLE);
 
-		NV_LOG_INFO(("Swapchain created with " + std::to_string(actualImageCount) + " images.").c_str());
+		NV_LOG_INFO(("Swapchain created with " + std::to_string(actualImageCount) + " images, present mode "
+			+ PresentModeToString(m_PresentMode) + ".").c_str());
 		return true;
 	}
 
@@ -393,6 +363,21 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		return true;
 	}
 
+	void VK_Swapchain::EnablePresentWait() {
+		m_WaitForPresentFn = reinterpret_cast<PFN_vkWaitForPresentKHR>(
+			vkGetDeviceProcAddr(m_Device, "vkWaitForPresentKHR"));
+
+		if (!m_WaitForPresentFn)
+			NV_LOG_WARN("VK_Swapchain: vkWaitForPresentKHR not found, low-latency mode disabled.");
+	}
+
+	VkResult VK_Swapchain::WaitForPresent(uint64_t presentId, uint64_t timeoutNs) {
+		if (!m_WaitForPresentFn || m_Swapchain == VK_NULL_HANDLE || presentId == 0)
+			return VK_SUCCESS;
+
+		return m_WaitForPresentFn(m_Device, m_Swapchain, presentId, timeoutNs);
+	}
+
 	void VK_Swapchain::DestroySwapchain() {
 		for (auto& f : m_Frames) {
 			if (f.m_Framebuffer) vkDestroyFramebuffer(m_Device, f.m_Framebuffer, nullptr);
@@ -744,118 +729,32 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		auto fragAsset = AssetManager::Get().Acquire<ShaderAsset>(shaderDir / "Scene.frag.slang");
 
 		if (!vertAsset || !fragAsset) { NV_LOG_WARN("CreateModelPipeline: failed to acquire shaders"); return; }
+		ShaderAsset::CompileAll({ vertAsset.GetAssetRef(), fragAsset.GetAssetRef() }); // both stages in parallel; errors reported below
 		if (!vertAsset->Compile()) { NV_LOG_WARN(("VS compile failed:\n" + vertAsset->GetLastLog()).c_str()); return; }
 		if (!fragAsset->Compile()) { NV_LOG_WARN(("FS compile failed:\n" + fragAsset->GetLastLog()).c_str()); return; }
 
-		VK_ShaderModule vertModule, fragModule;
-		if (!vertModule.Create(m_Device, vertAsset->GetBinary()) ||
-			!fragModule.Create(m_Device, fragAsset->GetBinary()))
-		{
-			NV_LOG_WARN("CreateModelPipeline: failed to create shader modules");
-			return;
-		}
-
-		VkPipelineShaderStageCreateInfo stages[2]{};
-		stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-		stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-		stages[0].module = vertModule.GetModule();
-		stages[0].pName = "main";
+		m_ModelVertAsset = vertAsset.GetAssetRef();
+		m_ModelFragAsset = fragAsset.GetAssetRef();
+		m_ModelKeywords = vertAsset->GetKeywords();
+		m_ModelKeywords.Merge(fragAsset->GetKeywords());
 
-		stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-		stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-		stages[1].module = fragModule.GetModule();
-		stages[1].pName = "main";
-
-		// Vertex buffer stride matches the full Vertex layout; only declare attributes
-		// consumed by model.vert.slang (locations 0–1) to satisfy validation.
-		VkVertexInputBindingDescription binding{};
-		binding.binding = 0;
-		binding.stride = sizeof(Renderer::Graphics::Vertex);
-		binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-
-		std::array<VkVertexInputAttributeDescription, 6> attrs{};
-		attrs[0] = { 0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Position) };
-		attrs[1] = { 1, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Normal) };
-		attrs[2] = { 2, 0, VK_FORMAT_R32G32_SFLOAT,    offsetof(Renderer::Graphics::Vertex, m_TexCoord) };
-		attrs[3] = { 3, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Color) };
-		attrs[4] = { 4, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Tangent) };
-		attrs[5] = { 5, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Bitangent) };
-
-		VkPipelineVertexInputStateCreateInfo vertexInput{};
-		vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-		vertexInput.vertexBindingDescriptionCount = 1;
-		vertexInput.pVertexBindingDescriptions = &binding;
-		vertexInput.vertexAttributeDescriptionCount = static_cast<uint32_t>(attrs.size());
-		vertexInput.pVertexAttributeDescriptions = attrs.data();
-
-		VkPipelineInputAssemblyStateCreateInfo inputAsm{};
-		inputAsm.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-		inputAsm.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-
-		VkPipelineViewportStateCreateInfo viewportState{};
-		viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-		viewportState.viewportCount = 1;
-		viewportState.scissorCount = 1;
-
-		VkPipelineRasterizationStateCreateInfo raster{};
-		raster.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-		raster.polygonMode = VK_POLYGON_MODE_FILL;
-		raster.cullMode = VK_CULL_MODE_BACK_BIT;
-		raster.frontFace = VK_FRONT_FACE_CLOCKWISE;
-		raster.lineWidth = 1.0f;
-
-		VkPipelineMultisampleStateCreateInfo msaa{};
-		msaa.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-		msaa.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-
-		// ---- Depth test ----
-		VkPipelineDepthStencilStateCreateInfo depthStencil{};
-		depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-		depthStencil.depthTestEnable = VK_TRUE;
-		depthStencil.depthWriteEnable = VK_TRUE;
-		depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
-
-		VkPipelineColorBlendAttachmentState blendAttachment{};
-		blendAttachment.colorWriteMask =
-			VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-			VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-
-		VkPipelineColorBlendStateCreateInfo blend{};
-		blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-		blend.attachmentCount = 1;
-		blend.pAttachments = &blendAttachment;
-
-		VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
-		VkPipelineDynamicStateCreateInfo dynamic{};
-		dynamic.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-		dynamic.dynamicStateCount = 2;
-		dynamic.pDynamicStates = dynamicStates;
-
-		// Descriptor set layouts (set 0 = engine, set 1 = user) generated from Slang reflection.
-		// Engine semantics: MVP + Material use dynamic uniform buffers.
+		// Set 0 = the canonical engine layout shared by every graphics pipeline; set 1 = user, from Slang reflection.
 		{
 			RHI::RHI_ProgramReflection reflForVk =
 				RHI::MergeProgramReflections({ vertAsset->GetReflection(), fragAsset->GetReflection() });
 
-			if (auto* set0 = const_cast<RHI::RHI_DescriptorSetLayoutInfo*>(reflForVk.FindSet(RHI::kEngineDescriptorSet))) {
-				for (auto& b : set0->m_Bindings) {
-					if (b.m_Key.m_Binding == static_cast<uint32_t>(Renderer::RHI::EngineResourceSlot::Mvp) ||
-						b.m_Key.m_Binding == static_cast<uint32_t>(Renderer::RHI::EngineResourceSlot::Material))
-					{
-						if (b.m_Kind == RHI::RHI_ResourceKind::ConstantBuffer) b.m_IsDynamicUniformBuffer = true;
-					}
-				}
-			}
-
 			m_ModelPipelineReflection = reflForVk;
 
-			if (!CreateDescriptorSetLayoutFromReflection(m_Device, reflForVk, RHI::kEngineDescriptorSet, m_EngineSetLayout)) {
-				NV_LOG_WARN("CreateModelPipeline: failed to create engine set layout (reflection missing?)");
+			if (!m_LayoutCache) { NV_LOG_WARN("CreateModelPipeline: no layout cache set"); return; }
+			if (!VK_DescriptorLayoutCache::IsEngineSetCompatible(reflForVk, "CreateModelPipeline")) return;
+			m_EngineSetLayout = m_LayoutCache->GetEngineSetLayout();
+			if (m_EngineSetLayout == VK_NULL_HANDLE) {
+				NV_LOG_WARN("CreateModelPipeline: failed to create engine set layout");
 				return;
 			}
 
 			// User set is optional.
-			(void)CreateDescriptorSetLayoutFromReflection(m_Device, reflForVk, RHI::kUserDescriptorSet, m_UserSetLayout);
+			m_UserSetLayout = m_LayoutCache->GetSetLayout(reflForVk, RHI::kUserDescriptorSet);
 		}
 
 		// ---- Globals buffer ----
@@ -1041,19 +940,192 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		writes[3].pBufferInfo = &materialBufInfo;
 		vkUpdateDescriptorSets(m_Device, 4, writes, 0, nullptr);
 
-		VkDescriptorSetLayout setLayouts[2] = { m_EngineSetLayout, m_UserSetLayout };
-		const uint32_t setLayoutCount = (m_UserSetLayout != VK_NULL_HANDLE) ? 2u : 1u;
+		std::vector<VkDescriptorSetLayout> setLayouts = { m_EngineSetLayout };
+		if (m_UserSetLayout != VK_NULL_HANDLE) setLayouts.push_back(m_UserSetLayout);
+		// The user set always has a layout (binding 0 safety net), so the heap lands on set 2.
+		if (m_BindlessSetLayout != VK_NULL_HANDLE && setLayouts.size() == RHI::kBindlessDescriptorSet)
+			setLayouts.push_back(m_BindlessSetLayout);
 
-		VkPipelineLayoutCreateInfo layoutInfo{};
-		layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-		layoutInfo.setLayoutCount = setLayoutCount;
-		layoutInfo.pSetLayouts = setLayouts;
-		layoutInfo.pushConstantRangeCount = 0;
-		layoutInfo.pPushConstantRanges = nullptr;
+		// Always reserve the per-draw push-constant range so every graphics layout stays
+		// compatible for set 0, whether or not this shader declares push constants.
+		const VkPushConstantRange pushRange = GetDrawPushConstantRange();
+		if (m_ModelPipelineReflection.m_PushConstants && m_ModelPipelineReflection.m_PushConstants->m_SizeBytes > pushRange.size)
+			NV_LOG_WARN("CreateModelPipeline: shader push constants exceed RHI::DrawPushConstants");
 
-		res = vkCreatePipelineLayout(m_Device, &layoutInfo, nullptr, &m_ModelPipelineLayout);
-		CheckVkResult(res);
-		if (res != VK_SUCCESS) { NV_LOG_WARN("CreateModelPipeline: failed to create pipeline layout"); DestroyModelPipeline(); return; }
+		m_ModelPipelineLayout = m_LayoutCache->GetPipelineLayout(setLayouts, { pushRange });
+		if (m_ModelPipelineLayout == VK_NULL_HANDLE) { NV_LOG_WARN("CreateModelPipeline: failed to create pipeline layout"); DestroyModelPipeline(); return; }
+
+		bool pending = false;
+		m_ModelPipeline = CreateModelPipelineVariant(0, pending);
+
+		if (m_ModelPipeline != VK_NULL_HANDLE) NV_LOG_INFO("Model pipeline created.");
+		else { NV_LOG_WARN("CreateModelPipeline: pipeline creation failed."); DestroyModelPipeline(); return; }
+
+		// Compile the declared variants in the background, so switching keywords never compiles mid-frame.
+		m_ModelVertAsset->WarmVariants();
+		m_ModelFragAsset->WarmVariants();
+	}
+
+	bool VK_Swapchain::ReloadModelPipeline() {
+		if (m_ModelPipelineLayout == VK_NULL_HANDLE || !m_ModelVertAsset || !m_ModelFragAsset) return false;
+
+		const RHI::RHI_ProgramReflection reflection =
+			RHI::MergeProgramReflections({ m_ModelVertAsset->GetReflection(), m_ModelFragAsset->GetReflection() });
+		if (!VK_DescriptorLayoutCache::IsEngineSetCompatible(reflection, "ReloadModelPipeline")) return false;
+		if (!HasCompatibleBindings(reflection, m_ModelPipelineReflection)) {
+			NV_LOG_WARN("ReloadModelPipeline: shader resources changed; restart to apply the new layout.");
+			return false;
+		}
+
+		RHI::RHI_ShaderKeywordSet keywords = m_ModelVertAsset->GetKeywords();
+		keywords.Merge(m_ModelFragAsset->GetKeywords());
+		std::swap(m_ModelKeywords, keywords);
+
+		bool pending = false;
+		VkPipeline pipeline = CreateModelPipelineVariant(0, pending);
+		if (pipeline == VK_NULL_HANDLE) {
+			std::swap(m_ModelKeywords, keywords);
+			NV_LOG_WARN("ReloadModelPipeline: pipeline creation failed, keeping the previous pipeline.");
+			return false;
+		}
+
+		// Frames in flight may still reference the old pipelines.
+		vkDeviceWaitIdle(m_Device);
+		for (auto& [mask, variant] : m_ModelPipelineVariants) {
+			if (variant != VK_NULL_HANDLE) vkDestroyPipeline(m_Device, variant, nullptr);
+		}
+		m_ModelPipelineVariants.clear();
+		m_FailedModelVariants.clear();
+		if (m_ModelPipeline != VK_NULL_HANDLE) vkDestroyPipeline(m_Device, m_ModelPipeline, nullptr);
+		m_ModelPipeline = pipeline;
+
+		m_ModelVertAsset->WarmVariants();
+		m_ModelFragAsset->WarmVariants();
+		return true;
+	}
+
+	VkPipeline VK_Swapchain::GetModelPipelineVariant(RHI::RHI_ShaderVariantMask mask) {
+		if (mask == 0) return m_ModelPipeline;
+		if (auto it = m_ModelPipelineVariants.find(mask); it != m_ModelPipelineVariants.end())
+			return it->second;
+		// Failures are remembered so a broken variant is reported once instead of every draw.
+		if (m_FailedModelVariants.contains(mask)) return VK_NULL_HANDLE;
+
+		bool pending = false;
+		VkPipeline pipeline = CreateModelPipelineVariant(mask, pending);
+		if (pipeline != VK_NULL_HANDLE)
+			m_ModelPipelineVariants.emplace(mask, pipeline);
+		else if (!pending)
+			m_FailedModelVariants.insert(mask);
+		return pipeline;
+	}
+
+	VkPipeline VK_Swapchain::CreateModelPipelineVariant(RHI::RHI_ShaderVariantMask mask, bool& outPending) {
+		outPending = false;
+		if (m_ModelPipelineLayout == VK_NULL_HANDLE || !m_ModelVertAsset || !m_ModelFragAsset) return VK_NULL_HANDLE;
+
+		// Compile keywords select a SPIR-V variant per stage; specialization keywords patch constants.
+		using VariantState = Asset::Assets::ShaderAsset::VariantState;
+		const std::vector<uint8_t>* vertBinary = nullptr;
+		const std::vector<uint8_t>* fragBinary = nullptr;
+		const VariantState vertState = m_ModelVertAsset->RequestVariantBinary(
+			m_ModelVertAsset->GetKeywords().Translate(mask, m_ModelKeywords), vertBinary);
+		const VariantState fragState = m_ModelFragAsset->RequestVariantBinary(
+			m_ModelFragAsset->GetKeywords().Translate(mask, m_ModelKeywords), fragBinary);
+		if (vertState == VariantState::Failed || fragState == VariantState::Failed) return VK_NULL_HANDLE;
+		if (vertState == VariantState::Pending || fragState == VariantState::Pending) {
+			outPending = true;
+			return VK_NULL_HANDLE;
+		}
+
+		VK_SpecializationData specialization;
+		specialization.Build(m_ModelKeywords, mask);
+
+		VK_ShaderModule vertModule, fragModule;
+		if (!vertModule.Create(m_Device, *vertBinary) ||
+			!fragModule.Create(m_Device, *fragBinary))
+		{
+			NV_LOG_WARN("CreateModelPipeline: failed to create shader modules");
+			return VK_NULL_HANDLE;
+		}
+
+		VkPipelineShaderStageCreateInfo stages[2]{};
+		stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+		stages[0].module = vertModule.GetModule();
+		stages[0].pName = "main";
+		stages[0].pSpecializationInfo = specialization.Get();
+
+		stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+		stages[1].module = fragModule.GetModule();
+		stages[1].pName = "main";
+		stages[1].pSpecializationInfo = specialization.Get();
+
+		// Vertex buffer stride matches the full Vertex layout; only declare attributes
+		// consumed by model.vert.slang (locations 0–1) to satisfy validation.
+		VkVertexInputBindingDescription binding{};
+		binding.binding = 0;
+		binding.stride = sizeof(Renderer::Graphics::Vertex);
+		binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+		std::array<VkVertexInputAttributeDescription, 6> attrs{};
+		attrs[0] = { 0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Position) };
+		attrs[1] = { 1, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Normal) };
+		attrs[2] = { 2, 0, VK_FORMAT_R32G32_SFLOAT,    offsetof(Renderer::Graphics::Vertex, m_TexCoord) };
+		attrs[3] = { 3, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Color) };
+		attrs[4] = { 4, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Tangent) };
+		attrs[5] = { 5, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Renderer::Graphics::Vertex, m_Bitangent) };
+
+		VkPipelineVertexInputStateCreateInfo vertexInput{};
+		vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+		vertexInput.vertexBindingDescriptionCount = 1;
+		vertexInput.pVertexBindingDescriptions = &binding;
+		vertexInput.vertexAttributeDescriptionCount = static_cast<uint32_t>(attrs.size());
+		vertexInput.pVertexAttributeDescriptions = attrs.data();
+
+		VkPipelineInputAssemblyStateCreateInfo inputAsm{};
+		inputAsm.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+		inputAsm.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+		VkPipelineViewportStateCreateInfo viewportState{};
+		viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+		viewportState.viewportCount = 1;
+		viewportState.scissorCount = 1;
+
+		VkPipelineRasterizationStateCreateInfo raster{};
+		raster.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+		raster.polygonMode = VK_POLYGON_MODE_FILL;
+		raster.cullMode = VK_CULL_MODE_BACK_BIT;
+		raster.frontFace = VK_FRONT_FACE_CLOCKWISE;
+		raster.lineWidth = 1.0f;
+
+		VkPipelineMultisampleStateCreateInfo msaa{};
+		msaa.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+		msaa.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+		// ---- Depth test ----
+		VkPipelineDepthStencilStateCreateInfo depthStencil{};
+		depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+		depthStencil.depthTestEnable = VK_TRUE;
+		depthStencil.depthWriteEnable = VK_TRUE;
+		depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+
+		VkPipelineColorBlendAttachmentState blendAttachment{};
+		blendAttachment.colorWriteMask =
+			VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+			VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+		VkPipelineColorBlendStateCreateInfo blend{};
+		blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+		blend.attachmentCount = 1;
+		blend.pAttachments = &blendAttachment;
+
+		VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+		VkPipelineDynamicStateCreateInfo dynamic{};
+		dynamic.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+		dynamic.dynamicStateCount = 2;
+		dynamic.pDynamicStates = dynamicStates;
 
 		VkGraphicsPipelineCreateInfo pipe{};
 		pipe.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
@@ -1071,22 +1143,31 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		pipe.renderPass = m_BackBufferRenderPass;
 		pipe.subpass = 0;
 
-		res = vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipe, nullptr, &m_ModelPipeline);
+		VkPipeline pipeline = VK_NULL_HANDLE;
+		VkResult res = vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &pipe, nullptr, &pipeline);
 		CheckVkResult(res);
-
-		if (res == VK_SUCCESS) NV_LOG_INFO("Model pipeline created.");
-		else { NV_LOG_WARN("CreateModelPipeline: pipeline creation failed."); DestroyModelPipeline(); }
+		if (res != VK_SUCCESS) {
+			NV_LOG_WARN("CreateModelPipelineVariant: pipeline creation failed.");
+			return VK_NULL_HANDLE;
+		}
+		return pipeline;
 	}
 
 	void VK_Swapchain::DestroyModelPipeline() {
+		for (auto& [mask, pipeline] : m_ModelPipelineVariants) {
+			if (pipeline != VK_NULL_HANDLE) vkDestroyPipeline(m_Device, pipeline, nullptr);
+		}
+		m_ModelPipelineVariants.clear();
+		m_FailedModelVariants.clear();
+		m_ModelVertAsset.reset();
+		m_ModelFragAsset.reset();
+		m_ModelKeywords = {};
+
 		if (m_ModelPipeline != VK_NULL_HANDLE) {
 			vkDestroyPipeline(m_Device, m_ModelPipeline, nullptr);
 			m_ModelPipeline = VK_NULL_HANDLE;
 		}
-		if (m_ModelPipelineLayout != VK_NULL_HANDLE) {
-			vkDestroyPipelineLayout(m_Device, m_ModelPipelineLayout, nullptr);
-			m_ModelPipelineLayout = VK_NULL_HANDLE;
-		}
+		m_ModelPipelineLayout = VK_NULL_HANDLE; // owned by the layout cache
 		if (m_EngineDescriptorSet != VK_NULL_HANDLE && m_ImGuiDescriptorPool != VK_NULL_HANDLE) {
 			vkFreeDescriptorSets(m_Device, m_ImGuiDescriptorPool, 1, &m_EngineDescriptorSet);
 			m_EngineDescriptorSet = VK_NULL_HANDLE;
@@ -1104,14 +1185,8 @@ namespace Nova::Core::Renderer::Backends::Vulkan {
 		if (m_BufMvpMemory != VK_NULL_HANDLE) { vkFreeMemory(m_Device, m_BufMvpMemory, nullptr); m_BufMvpMemory = VK_NULL_HANDLE; }
 		if (m_BufGlobals != VK_NULL_HANDLE) { vkDestroyBuffer(m_Device, m_BufGlobals, nullptr); m_BufGlobals = VK_NULL_HANDLE; }
 		if (m_BufGlobalsMemory != VK_NULL_HANDLE) { vkFreeMemory(m_Device, m_BufGlobalsMemory, nullptr); m_BufGlobalsMemory = VK_NULL_HANDLE; }
-		if (m_EngineSetLayout != VK_NULL_HANDLE) {
-			vkDestroyDescriptorSetLayout(m_Device, m_EngineSetLayout, nullptr);
-			m_EngineSetLayout = VK_NULL_HANDLE;
-		}
-		if (m_UserSetLayout != VK_NULL_HANDLE) {
-			vkDestroyDescriptorSetLayout(m_Device, m_UserSetLayout, nullptr);
-			m_UserSetLayout = VK_NULL_HANDLE;
-		}
+		m_EngineSetLayout = VK_NULL_HANDLE;
+		m_UserSetLayout = VK_NULL_HANDLE;
 	}
 
 	bool VK_Swapchain::CreateDepthResources() {
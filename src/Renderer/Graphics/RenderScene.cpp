@@ -0,0 +1,118 @@
+#include "Renderer/Graphics/RenderScene.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#include "Core/JobSystem.h"
+#include "Renderer/RHI/RHI_Shaders.h"
+
+namespace Nova::Core::Renderer::Graphics {
+
+    namespace {
+
+        // Gribb-Hartmann planes (xyz: inward normal, w: distance), for a [0, 1] depth range.
+        std::array<glm::vec4, 6> ExtractFrustumPlanes(const glm::mat4& m) {
+            const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+            const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+            const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+            const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+            std::array<glm::vec4, 6> planes = {
+                row3 + row0, row3 - row0, // left, right
+                row3 + row1, row3 - row1, // bottom, top
+                row2,        row3 - row2  // near, far
+            };
+            for (auto& plane : planes)
+                plane /= glm::length(glm::vec3(plane));
+            return planes;
+        }
+
+        // Proxies per Cull() chunk; smaller scenes are culled on the calling thread.
+        constexpr size_t kCullGrain = 4096;
+
+        // Top 16 bits of a non-negative float: monotonic in the value, so it sorts as an integer.
+        uint64_t DepthKey(float depth) {
+            return static_cast<uint64_t>(std::bit_cast<uint32_t>(glm::max(depth, 0.0f)) >> 16);
+        }
+
+    } // namespace
+
+    void RenderScene::Clear() {
+        m_Proxies.clear();
+        m_Meshes.clear();
+        m_Materials.clear();
+        m_DrawList.clear();
+    }
+
+    void RenderScene::Cull(const glm::mat4& viewProj, const glm::vec3& cameraPosition) {
+        const auto planes = ExtractFrustumPlanes(viewProj);
+        constexpr uint64_t kStateMask = (1ull << 48) - 1;
+
+        // Each chunk packs its visible items at the front of its own slice of the draw list; the slices are
+        // then compacted in order, so the result matches a serial pass.
+        const size_t count = m_Proxies.size();
+        m_DrawList.resize(count);
+        m_CullCounts.assign((count + kCullGrain - 1) / kCullGrain, 0);
+
+        JobSystem::ParallelFor(count, kCullGrain, [&](size_t begin, size_t end) {
+            uint32_t visibleCount = 0;
+            for (size_t i = begin; i < end; ++i) {
+                const RenderProxy& proxy = m_Proxies[i];
+                const glm::vec3 center(proxy.m_BoundingSphere);
+                const float radius = proxy.m_BoundingSphere.w;
+
+                bool visible = true;
+                for (const auto& plane : planes) {
+                    if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+                        visible = false;
+                        break;
+                    }
+                }
+                if (!visible)
+                    continue;
+
+                const uint64_t depth = DepthKey(glm::length(center - cameraPosition));
+                const uint64_t state = proxy.m_SortKey & kStateMask;
+                // Opaque: state first (fewer material switches), near to far within it.
+                // Translucent: far to near across everything, state only breaks ties.
+                const uint64_t key = (proxy.m_SortKey & kTranslucentBit)
+                    ? kTranslucentBit | ((0xFFFFull - depth) << 47) | (state & ((1ull << 47) - 1))
+                    : (state << 15) | (depth >> 1);
+                m_DrawList[begin + visibleCount++] = { key, static_cast<uint32_t>(i) };
+            }
+            m_CullCounts[begin / kCullGrain] = visibleCount;
+        }, "RenderScene::Cull");
+
+        size_t written = 0;
+        for (size_t chunk = 0; chunk < m_CullCounts.size(); ++chunk) {
+            const auto first = m_DrawList.begin() + chunk * kCullGrain;
+            if (written != chunk * kCullGrain)
+                std::copy(first, first + m_CullCounts[chunk], m_DrawList.begin() + written);
+            written += m_CullCounts[chunk];
+        }
+        m_DrawList.resize(written);
+    }
+
+    void RenderScene::Sort() {
+        std::sort(m_DrawList.begin(), m_DrawList.end(), [](const RenderDrawItem& a, const RenderDrawItem& b) {
+            return a.m_Key < b.m_Key;
+        });
+    }
+
+    void RenderScene::Submit(RHI::IRenderer& renderer) const {
+        RHI::RHI_Shaders* shader = renderer.GetShader();
+        uint32_t currentMaterial = UINT32_MAX;
+
+        for (const RenderDrawItem& item : m_DrawList) {
+            const RenderProxy& proxy = m_Proxies[item.m_Proxy];
+            if (shader && proxy.m_Material != currentMaterial) {
+                shader->SetMaterial(m_Materials[proxy.m_Material]);
+                currentMaterial = proxy.m_Material;
+            }
+            renderer.SetModelMatrix(proxy.m_World, proxy.m_Normal);
+            renderer.DrawIndexed(m_Meshes[proxy.m_Mesh]);
+        }
+    }
+
+} // namespace Nova::Core::Renderer::Graphics
@@ -0,0 +1,510 @@
+#include "Renderer/RHI/RHI_ShaderCacheArchive.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+
+#include "Core/Log.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/file.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Nova::Core::Renderer::RHI {
+
+    static constexpr uint32_t kArchiveMagic = 0x4353564E; // 'NVSC'
+    static constexpr uint32_t kArchiveVersion = 1;
+    static constexpr uint32_t kRecordMagic = 0x5253564E;  // 'NVSR'
+    static constexpr uint64_t kAlignment = 16;
+
+    struct ArchiveHeader {
+        uint32_t m_Magic = kArchiveMagic;
+        uint32_t m_Version = kArchiveVersion;
+        uint64_t m_Reserved = 0;
+    };
+
+    struct RecordHeader {
+        uint32_t m_Magic = kRecordMagic;
+        uint32_t m_Kind = 0;
+        uint32_t m_KeySize = 0;
+        uint32_t m_Reserved = 0;
+        uint64_t m_Size0 = 0;
+        uint64_t m_Size1 = 0;
+        uint64_t m_LastUsed = 0;   // seconds since epoch
+        uint64_t m_RecordSize = 0; // header + key + payloads + padding
+    };
+
+    static_assert(sizeof(ArchiveHeader) == 16, "ArchiveHeader must stay 16 bytes (payload alignment)");
+    static_assert(sizeof(RecordHeader) == 48, "RecordHeader layout is part of the file format");
+
+    static uint64_t AlignUp(uint64_t v) { return (v + kAlignment - 1) & ~(kAlignment - 1); }
+    static uint64_t Payload0Offset(const RecordHeader& h) { return AlignUp(sizeof(RecordHeader) + h.m_KeySize); }
+    static uint64_t Payload1Offset(const RecordHeader& h) { return AlignUp(Payload0Offset(h) + h.m_Size0); }
+    static uint64_t ExpectedRecordSize(const RecordHeader& h) { return AlignUp(Payload1Offset(h) + h.m_Size1); }
+
+    static uint64_t NowStamp() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    static bool MapFile(const std::filesystem::path& path, size_t size, bool writable, uint8_t*& outData, void*& outHandle) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(path.c_str(), writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        // A writable mapping larger than the file would grow it; a shorter file means it was rewritten.
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || static_cast<uint64_t>(fileSize.QuadPart) < size) {
+            CloseHandle(file);
+            return false;
+        }
+
+        const uint64_t size64 = size;
+        HANDLE mapping = CreateFileMappingW(file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+            static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFFu), nullptr);
+        CloseHandle(file); // the mapping keeps the file open
+        if (!mapping) return false;
+
+        void* data = MapViewOfFile(mapping, writable ? (FILE_MAP_READ | FILE_MAP_WRITE) : FILE_MAP_READ, 0, 0, size);
+        if (!data) {
+            CloseHandle(mapping);
+            return false;
+        }
+        outData = static_cast<uint8_t*>(data);
+        outHandle = mapping;
+        return true;
+#else
+        const int fd = ::open(path.c_str(), (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+        if (fd < 0) return false;
+        // Pages past the end of the file fault with SIGBUS; a shorter file means it was rewritten.
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < size) {
+            ::close(fd);
+            return false;
+        }
+        void* data = ::mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // the mapping keeps the file open
+        if (data == MAP_FAILED) return false;
+        outData = static_cast<uint8_t*>(data);
+        outHandle = nullptr;
+        return true;
+#endif
+    }
+
+    static void UnmapFile(uint8_t* data, size_t size, void* handle) {
+#if defined(_WIN32)
+        (void)size;
+        if (data) UnmapViewOfFile(data);
+        if (handle) CloseHandle(static_cast<HANDLE>(handle));
+#else
+        (void)handle;
+        if (data) ::munmap(data, size);
+#endif
+    }
+
+    // Advisory whole-file lock shared with other processes using the archive (e.g. nova-shaderc):
+    // exclusive for appends, compaction and the open-time scan, shared for read-only opens.
+    class ArchiveFileLock {
+    public:
+        ArchiveFileLock() = default;
+        ArchiveFileLock(const ArchiveFileLock&) = delete;
+        ArchiveFileLock& operator=(const ArchiveFileLock&) = delete;
+        ~ArchiveFileLock() { Unlock(); }
+
+        bool Lock(const std::filesystem::path& path, bool exclusive) {
+            Unlock();
+#if defined(_WIN32)
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return false;
+            OVERLAPPED overlapped{};
+            if (!LockFileEx(file, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+                CloseHandle(file);
+                return false;
+            }
+            m_File = file;
+            return true;
+#else
+            // Compaction replaces the file; a lock taken on the old one while waiting protects nothing.
+            for (int attempt = 0; attempt < 4; ++attempt) {
+                const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) return false;
+                if (::flock(fd, exclusive ? LOCK_EX : LOCK_SH) != 0) {
+                    ::close(fd);
+                    return false;
+                }
+                struct stat locked{};
+                struct stat current{};
+                if (::fstat(fd, &locked) == 0 && ::stat(path.c_str(), &current) == 0 &&
+                    locked.st_ino == current.st_ino && locked.st_dev == current.st_dev)
+                {
+                    m_Fd = fd;
+                    return true;
+                }
+                ::close(fd);
+            }
+            return false;
+#endif
+        }
+
+        void Unlock() {
+#if defined(_WIN32)
+            if (m_File != INVALID_HANDLE_VALUE) {
+                OVERLAPPED overlapped{};
+                UnlockFileEx(m_File, 0, MAXDWORD, MAXDWORD, &overlapped);
+                CloseHandle(m_File);
+                m_File = INVALID_HANDLE_VALUE;
+            }
+#else
+            if (m_Fd >= 0) {
+                ::close(m_Fd); // releases the flock
+                m_Fd = -1;
+            }
+#endif
+        }
+
+    private:
+#if defined(_WIN32)
+        HANDLE m_File = INVALID_HANDLE_VALUE;
+#else
+        int m_Fd = -1;
+#endif
+    };
+
+    // Re-checks an index entry against the mapped bytes: another process may have rewritten the file.
+    static bool ReadRecord(const uint8_t* data, uint64_t dataSize, uint64_t offset, uint64_t recordSize,
+        uint32_t kind, std::string_view key, RecordHeader& out)
+    {
+        if (offset + sizeof(RecordHeader) > dataSize) return false;
+        std::memcpy(&out, data + offset, sizeof(out));
+        if (out.m_Magic != kRecordMagic || out.m_Kind != kind || out.m_KeySize != key.size() ||
+            out.m_RecordSize != recordSize || out.m_RecordSize != ExpectedRecordSize(out) ||
+            offset + out.m_RecordSize > dataSize)
+        {
+            return false;
+        }
+        return key.empty() || std::memcmp(data + offset + sizeof(RecordHeader), key.data(), key.size()) == 0;
+    }
+
+    static bool WriteEmptyArchive(const std::filesystem::path& path) {
+        std::ofstream os(path, std::ios::binary | std::ios::trunc);
+        if (!os.is_open()) return false;
+        const ArchiveHeader header{};
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        return static_cast<bool>(os);
+    }
+
+    RHI_ShaderCacheArchive::~RHI_ShaderCacheArchive() {
+        Close();
+    }
+
+    std::string RHI_ShaderCacheArchive::IndexKey(RHI_ShaderCacheRecordKind kind, std::string_view key) {
+        std::string out = std::to_string(static_cast<uint32_t>(kind));
+        out += ':';
+        out += key;
+        return out;
+    }
+
+    bool RHI_ShaderCacheArchive::Open(const std::filesystem::path& path, uint64_t maxBytes, RHI_ShaderCacheAccess access) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return OpenUnlocked(path, maxBytes, access, true);
+    }
+
+    void RHI_ShaderCacheArchive::Close() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        CloseUnlocked();
+    }
+
+    bool RHI_ShaderCacheArchive::IsOpen() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return !m_Path.empty();
+    }
+
+    bool RHI_ShaderCacheArchive::OpenUnlocked(const std::filesystem::path& path, uint64_t maxBytes,
+        RHI_ShaderCacheAccess access, bool allowCompaction)
+    {
+        CloseUnlocked();
+        const bool readOnly = access == RHI_ShaderCacheAccess::ReadOnly;
+
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec)) {
+            if (readOnly) {
+                NV_LOG_WARN(("Shader cache: " + path.string() + " is missing or empty").c_str());
+                return false;
+            }
+            if (!WriteEmptyArchive(path)) {
+                NV_LOG_WARN(("Shader cache: cannot create " + path.string()).c_str());
+                return false;
+            }
+        }
+
+        // Held while scanning, so a record another process is still appending is never taken for a torn one.
+        ArchiveFileLock fileLock;
+        if (!fileLock.Lock(path, !readOnly)) {
+            NV_LOG_WARN(("Shader cache: cannot lock " + path.string()).c_str());
+            return false;
+        }
+
+        uint64_t size = std::filesystem::file_size(path, ec);
+        if (ec || size < sizeof(ArchiveHeader)) {
+            if (readOnly) {
+                NV_LOG_WARN(("Shader cache: " + path.string() + " is missing or empty").c_str());
+                return false;
+            }
+            if (!WriteEmptyArchive(path)) {
+                NV_LOG_WARN(("Shader cache: cannot create " + path.string()).c_str());
+                return false;
+            }
+            size = sizeof(ArchiveHeader);
+        }
+
+        m_Path = path;
+        m_MaxBytes = maxBytes;
+        m_Access = access;
+        m_FileSize = size;
+        if (!MapUpTo(size)) {
+            NV_LOG_WARN(("Shader cache: cannot map " + path.string()).c_str());
+            CloseUnlocked();
+            return false;
+        }
+
+        ArchiveHeader header{};
+        std::memcpy(&header, RecordAt(0), sizeof(header));
+        if (header.m_Magic != kArchiveMagic || header.m_Version != kArchiveVersion) {
+            CloseUnlocked();
+            if (readOnly) {
+                NV_LOG_WARN(("Shader cache: " + path.string() + " has an unsupported layout").c_str());
+                return false;
+            }
+            // Unknown layout: start over rather than guess.
+            if (!WriteEmptyArchive(path)) return false;
+            fileLock.Unlock();
+            return OpenUnlocked(path, maxBytes, access, false);
+        }
+
+        uint64_t offset = sizeof(ArchiveHeader);
+        while (offset + sizeof(RecordHeader) <= size) {
+            RecordHeader record{};
+            std::memcpy(&record, RecordAt(offset), sizeof(record));
+            if (record.m_Magic != kRecordMagic || record.m_RecordSize != ExpectedRecordSize(record) ||
+                offset + record.m_RecordSize > size)
+            {
+                break;
+            }
+
+            const char* key = reinterpret_cast<const char*>(RecordAt(offset)) + sizeof(RecordHeader);
+            auto [it, inserted] = m_Index.try_emplace(
+                IndexKey(static_cast<RHI_ShaderCacheRecordKind>(record.m_Kind), std::string_view(key, record.m_KeySize)),
+                IndexEntry{ offset, record.m_RecordSize });
+            if (!inserted) {
+                m_DeadBytes += it->second.m_RecordSize;
+                it->second = IndexEntry{ offset, record.m_RecordSize };
+            }
+            offset += record.m_RecordSize;
+        }
+
+        if (offset != size) {
+            if (readOnly) {
+                // Ignore the partial record; nothing is ever appended after it.
+                m_FileSize = offset;
+                return true;
+            }
+            // A write was interrupted: drop the partial record so appends stay aligned.
+            CloseUnlocked();
+            std::filesystem::resize_file(path, offset, ec);
+            if (ec) return false;
+            fileLock.Unlock();
+            return OpenUnlocked(path, maxBytes, access, allowCompaction);
+        }
+
+        if (readOnly) return true;
+
+        const bool overBudget = m_MaxBytes != 0 && size > m_MaxBytes;
+        const bool mostlyDead = m_DeadBytes > size / 2;
+        if (allowCompaction && (overBudget || mostlyDead)) {
+            Compact(m_MaxBytes != 0 ? m_MaxBytes / 4 * 3 : size);
+            fileLock.Unlock();
+            return OpenUnlocked(path, maxBytes, access, false);
+        }
+        return true;
+    }
+
+    void RHI_ShaderCacheArchive::CloseUnlocked() {
+        // Blobs still held keep their view mapped; it goes away with the last of them.
+        m_View.reset();
+        m_Index.clear();
+        m_Path.clear();
+        m_FileSize = 0;
+        m_DeadBytes = 0;
+    }
+
+    bool RHI_ShaderCacheArchive::MapUpTo(uint64_t size) {
+        if (m_View && m_View->m_Size >= size) return true;
+
+        View view{};
+        view.m_Size = static_cast<size_t>(size);
+        if (!MapFile(m_Path, view.m_Size, m_Access == RHI_ShaderCacheAccess::ReadWrite, view.m_Data, view.m_Handle)) return false;
+        // The previous view is unmapped as soon as no blob handed out from it is left.
+        m_View = std::shared_ptr<View>(new View(view), [](View* mapped) {
+            UnmapFile(mapped->m_Data, mapped->m_Size, mapped->m_Handle);
+            delete mapped;
+        });
+        return true;
+    }
+
+    uint8_t* RHI_ShaderCacheArchive::RecordAt(uint64_t offset) {
+        return m_View->m_Data + offset;
+    }
+
+    bool RHI_ShaderCacheArchive::Contains(RHI_ShaderCacheRecordKind kind, std::string_view key) const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Index.find(IndexKey(kind, key)) != m_Index.end();
+    }
+
+    bool RHI_ShaderCacheArchive::Find(RHI_ShaderCacheRecordKind kind, std::string_view key, Blob& outPayload0, Blob& outPayload1) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        RecordHeader header{};
+        uint8_t* record = nullptr;
+        for (int attempt = 0;; ++attempt) {
+            const auto it = m_Index.find(IndexKey(kind, key));
+            if (it == m_Index.end()) return false;
+            if (MapUpTo(m_FileSize) && ReadRecord(m_View->m_Data, m_View->m_Size, it->second.m_Offset,
+                it->second.m_RecordSize, static_cast<uint32_t>(kind), key, header))
+            {
+                record = RecordAt(it->second.m_Offset);
+                break;
+            }
+
+            // Another process compacted or cut the file since the index was built: rebuild it once.
+            if (attempt > 0) return false;
+            const std::filesystem::path path = m_Path;
+            if (!OpenUnlocked(path, m_MaxBytes, m_Access, false)) return false;
+        }
+
+        // LRU stamp, written through the shared mapping.
+        const uint64_t now = NowStamp();
+        if (m_Access == RHI_ShaderCacheAccess::ReadWrite && header.m_LastUsed != now) {
+            std::memcpy(record + offsetof(RecordHeader, m_LastUsed), &now, sizeof(now));
+        }
+
+        outPayload0 = Blob{ record + Payload0Offset(header), static_cast<size_t>(header.m_Size0), m_View };
+        outPayload1 = Blob{ record + Payload1Offset(header), static_cast<size_t>(header.m_Size1), m_View };
+        return true;
+    }
+
+    bool RHI_ShaderCacheArchive::Append(RHI_ShaderCacheRecordKind kind, std::string_view key,
+        const void* payload0, size_t size0, const void* payload1, size_t size1)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Path.empty() || m_Access == RHI_ShaderCacheAccess::ReadOnly) return false;
+
+        RecordHeader header{};
+        header.m_Kind = static_cast<uint32_t>(kind);
+        header.m_KeySize = static_cast<uint32_t>(key.size());
+        header.m_Size0 = size0;
+        header.m_Size1 = size1;
+        header.m_LastUsed = NowStamp();
+        header.m_RecordSize = ExpectedRecordSize(header);
+
+        std::vector<char> bytes(static_cast<size_t>(header.m_RecordSize), 0);
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        if (!key.empty()) std::memcpy(bytes.data() + sizeof(header), key.data(), key.size());
+        if (size0 > 0) std::memcpy(bytes.data() + Payload0Offset(header), payload0, size0);
+        if (size1 > 0) std::memcpy(bytes.data() + Payload1Offset(header), payload1, size1);
+
+        // Other processes append to the same file: serialise with them and write at the real end,
+        // which is past m_FileSize when they did.
+        ArchiveFileLock fileLock;
+        if (!fileLock.Lock(m_Path, true)) return false;
+
+        std::error_code ec;
+        const uint64_t offset = std::filesystem::file_size(m_Path, ec);
+        if (ec || offset < sizeof(ArchiveHeader) || offset % kAlignment != 0) return false; // torn tail: the next Open() cuts it
+
+        std::ofstream os(m_Path, std::ios::binary | std::ios::app);
+        if (!os.is_open()) return false;
+        os.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        os.close();
+        if (!os) return false;
+        fileLock.Unlock();
+
+        auto [it, inserted] = m_Index.try_emplace(IndexKey(kind, key), IndexEntry{ offset, header.m_RecordSize });
+        if (!inserted) {
+            m_DeadBytes += it->second.m_RecordSize;
+            it->second = IndexEntry{ offset, header.m_RecordSize };
+        }
+        m_FileSize = offset + header.m_RecordSize;
+        // Mapped lazily on the next lookup.
+        return true;
+    }
+
+    bool RHI_ShaderCacheArchive::Compact(uint64_t keepBytes) {
+        struct LiveRecord {
+            uint64_t m_Offset = 0;
+            uint64_t m_Size = 0;
+            uint64_t m_LastUsed = 0;
+        };
+
+        std::vector<LiveRecord> live;
+        live.reserve(m_Index.size());
+        for (const auto& [key, entry] : m_Index) {
+            RecordHeader header{};
+            std::memcpy(&header, RecordAt(entry.m_Offset), sizeof(header));
+            live.push_back(LiveRecord{ entry.m_Offset, entry.m_RecordSize, header.m_LastUsed });
+        }
+        std::sort(live.begin(), live.end(),
+            [](const LiveRecord& a, const LiveRecord& b) {
+                // Stamps are in seconds; on a tie the record appended later is the more recent one.
+                return a.m_LastUsed != b.m_LastUsed ? a.m_LastUsed > b.m_LastUsed : a.m_Offset > b.m_Offset;
+            });
+
+        const std::filesystem::path path = m_Path;
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+
+        uint64_t written = sizeof(ArchiveHeader);
+        {
+            std::ofstream os(tempPath, std::ios::binary | std::ios::trunc);
+            if (!os.is_open()) return false;
+            const ArchiveHeader header{};
+            os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (const auto& record : live) {
+                if (written + record.m_Size > keepBytes) continue; // least recently used go first
+                os.write(reinterpret_cast<const char*>(RecordAt(record.m_Offset)), static_cast<std::streamsize>(record.m_Size));
+                written += record.m_Size;
+            }
+            if (!os) {
+                os.close();
+                std::error_code ec;
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        const uint64_t before = m_FileSize;
+        CloseUnlocked(); // views must be gone before the file can be replaced (Windows)
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+
+        NV_LOG_INFO(("Shader cache compacted: " + std::to_string(before) + " -> " + std::to_string(written) + " bytes").c_str());
+        return true;
+    }
+
+} // namespace Nova::Core::Renderer::RHI
@@ -1,13 +1,18 @@
 #include "Renderer/RHI/RHI_ShaderCompiler.h"
+#include "Core/Hash.h"
+#include "Core/JobSystem.h"
+#include "Renderer/RHI/RHI_ShaderCacheArchive.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
-#include <functional>
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <optional>
 
@@ -17,9 +22,82 @@
 
 namespace Nova::Core::Renderer::RHI {
 
+    // Guards the memory cache and the in-flight table only; never held across a compile.
     std::mutex g_Mutex;
     std::unordered_map<std::string, RHI_ShaderCompileResult> g_MemoryCache;
-    Slang::ComPtr<slang::IGlobalSession> g_GlobalSession;
+    std::unordered_map<std::string, std::shared_future<RHI_ShaderCompileResult>> g_InFlight;
+
+    // Slang global sessions are not thread-safe: each concurrent compile borrows its own.
+    std::mutex g_SessionMutex;
+    std::vector<Slang::ComPtr<slang::IGlobalSession>> g_IdleGlobalSessions;
+
+    /**
+     * A compile session (search paths + defines + target) with the global session that owns it.
+     * Kept alive between compiles so modules it already parsed are not parsed again.
+     */
+    struct PooledSlangSession {
+        Slang::ComPtr<slang::IGlobalSession> m_Global;
+        Slang::ComPtr<slang::ISession> m_Session;
+        // Content hash of every file the session has parsed; any mismatch means its module cache is stale.
+        std::unordered_map<std::string, Hash128> m_LoadedFiles;
+    };
+
+    // Idle sessions by session key; guarded by g_SessionMutex.
+    std::unordered_map<std::string, std::vector<std::unique_ptr<PooledSlangSession>>> g_IdleSlangSessions;
+    size_t g_IdleSlangSessionCount = 0;
+    static constexpr size_t kMaxIdleSlangSessions = 32;
+
+    // Per-session memo of file content hashes, revalidated by size + mtime; and dependency lists by input key.
+    struct FileHashEntry {
+        std::filesystem::file_time_type m_WriteTime{};
+        uintmax_t m_Size = 0;
+        Hash128 m_Hash{};
+    };
+    std::mutex g_DependencyMutex;
+    std::unordered_map<std::string, FileHashEntry> g_FileHashes;
+    std::unordered_map<std::string, std::vector<std::filesystem::path>> g_Dependencies;
+
+    // Packed on-disk cache (Cache/Shaders/ShaderCache.nvpak), opened on first use and closed by ShutdownSlang.
+    RHI_ShaderCacheArchive g_Archive;
+    std::mutex g_ArchiveMutex;
+    bool g_ArchiveOpened = false; // guarded by g_ArchiveMutex, like the access it was opened with
+    RHI_ShaderCacheAccess g_ArchiveAccess = RHI_ShaderCacheAccess::ReadWrite;
+    static constexpr uint64_t kShaderCacheMaxBytes = 256ull * 1024 * 1024;
+    static constexpr std::string_view kCompilerTagKey = "compiler-build-tag";
+
+    // Shipping builds only read the archive written by nova-shaderc and never start Slang.
+#if defined(NOVA_SHADER_PRECOMPILED)
+    std::atomic<bool> g_PrecompiledOnly{ true };
+#else
+    std::atomic<bool> g_PrecompiledOnly{ false };
+#endif
+
+    static std::filesystem::path CacheDirectory() {
+        auto dir = std::filesystem::current_path() / "Cache" / "Shaders";
+        std::error_code ec; // concurrent compiles may race on creation
+        std::filesystem::create_directories(dir, ec);
+        return dir;
+    }
+
+    static RHI_ShaderCacheArchive& OpenArchive() {
+        // A shipped cache is never stamped, evicted or rewritten, and may live in a read-only install.
+        const RHI_ShaderCacheAccess access = g_PrecompiledOnly ? RHI_ShaderCacheAccess::ReadOnly : RHI_ShaderCacheAccess::ReadWrite;
+
+        std::lock_guard<std::mutex> lock(g_ArchiveMutex);
+        if (!g_ArchiveOpened || g_ArchiveAccess != access) {
+            // A failed open is not retried on every lookup; the next ShutdownSlang or mode change does.
+            g_Archive.Open(CacheDirectory() / "ShaderCache.nvpak", kShaderCacheMaxBytes, access);
+            g_ArchiveOpened = true;
+            g_ArchiveAccess = access;
+        }
+        return g_Archive;
+    }
+
+    // Bump when the cache key layout or the cached payload changes.
+    static constexpr uint32_t kShaderCacheKeyVersion = 3;
+
+    // Every compile queued by CompileAsync, so ShutdownSlang can let them finish.
+    JobCounter g_CompileJobs;
 
     std::string ToSlangPathString(const std::filesystem::path& path) {
         return path.generic_string();
@@ -37,41 +115,47 @@ namespace Nova::Core::Renderer::RHI {
     }
 
     // -----------------------------------------------------------------------------
-    // Reflection cache (simple binary format)
+    // Reflection cache (simple binary format, stored as a payload of the cache archive)
     // -----------------------------------------------------------------------------
 
     static constexpr uint32_t kReflectionCacheMagic = 0x4E565245; // 'NVRE'
     static constexpr uint32_t kReflectionCacheVersion = 1;
 
-    static void WriteU32(std::ostream& os, uint32_t v) { os.write(reinterpret_cast<const char*>(&v), sizeof(v)); }
-    static void WriteU64(std::ostream& os, uint64_t v) { os.write(reinterpret_cast<const char*>(&v), sizeof(v)); }
-    static void WriteBool(std::ostream& os, bool v) { uint8_t b = v ? 1u : 0u; os.write(reinterpret_cast<const char*>(&b), sizeof(b)); }
-    static void WriteString(std::ostream& os, const std::string& s) {
+    static void WriteU32(std::vector<uint8_t>& os, uint32_t v) { os.insert(os.end(), reinterpret_cast<const uint8_t*>(&v), reinterpret_cast<const uint8_t*>(&v) + sizeof(v)); }
+    static void WriteU64(std::vector<uint8_t>& os, uint64_t v) { os.insert(os.end(), reinterpret_cast<const uint8_t*>(&v), reinterpret_cast<const uint8_t*>(&v) + sizeof(v)); }
+    static void WriteBool(std::vector<uint8_t>& os, bool v) { os.push_back(v ? 1u : 0u); }
+    static void WriteString(std::vector<uint8_t>& os, const std::string& s) {
         WriteU32(os, static_cast<uint32_t>(s.size()));
-        if (!s.empty()) os.write(s.data(), static_cast<std::streamsize>(s.size()));
+        os.insert(os.end(), s.begin(), s.end());
     }
 
-    static bool ReadU32(std::istream& is, uint32_t& out) { return (bool)is.read(reinterpret_cast<char*>(&out), sizeof(out)); }
-    static bool ReadU64(std::istream& is, uint64_t& out) { return (bool)is.read(reinterpret_cast<char*>(&out), sizeof(out)); }
-    static bool ReadBool(std::istream& is, bool& out) { uint8_t b = 0; if (!is.read(reinterpret_cast<char*>(&b), sizeof(b))) return false; out = (b != 0); return true; }
-    static bool ReadString(std::istream& is, std::string& out) {
-        uint32_t n = 0;
-        if (!ReadU32(is, n)) return false;
-        out.resize(n);
-        if (n == 0) return true;
-        return (bool)is.read(out.data(), static_cast<std::streamsize>(n));
-    }
+    /** Bounds-checked cursor over mapped bytes; reads straight from the archive mapping. */
+    struct ByteReader {
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        size_t m_Pos = 0;
 
-    static std::filesystem::path GetReflectionCachePath(const std::filesystem::path& dir, const std::string& hash) {
-        return dir / (hash + ".refl");
-    }
+        bool Read(void* dst, size_t n) {
+            if (n > m_Size - m_Pos) return false;
+            std::memcpy(dst, m_Data + m_Pos, n);
+            m_Pos += n;
+            return true;
+        }
+    };
 
-    static bool LoadReflectionCache(const std::filesystem::path& dir, const std::string& hash, RHI_ProgramReflection& out) {
-        const auto path = GetReflectionCachePath(dir, hash);
-        if (!std::filesystem::exists(path)) return false;
+    static bool ReadU32(ByteReader& is, uint32_t& out) { return is.Read(&out, sizeof(out)); }
+    static bool ReadU64(ByteReader& is, uint64_t& out) { return is.Read(&out, sizeof(out)); }
+    static bool ReadBool(ByteReader& is, bool& out) { uint8_t b = 0; if (!is.Read(&b, sizeof(b))) return false; out = (b != 0); return true; }
+    static bool ReadString(ByteReader& is, std::string& out) {
+        uint32_t n = 0;
+        if (!ReadU32(is, n) || n > is.m_Size - is.m_Pos) return false;
+        out.assign(reinterpret_cast<const char*>(is.m_Data + is.m_Pos), n);
+        is.m_Pos += n;
+        return true;
+    }
 
-        std::ifstream is(path, std::ios::binary);
-        if (!is.is_open()) return false;
+    static bool DeserializeReflection(const uint8_t* data, size_t size, RHI_ProgramReflection& out) {
+        ByteReader is{ data, size, 0 };
 
         uint32_t magic = 0, version = 0;
         if (!ReadU32(is, magic) || magic != kReflectionCacheMagic) return false;
@@ -137,10 +221,9 @@ namespace Nova::Core::Renderer::RHI {
         return true;
     }
 
-    static void SaveReflectionCache(const std::filesystem::path& dir, const std::string& hash, const RHI_ProgramReflection& refl) {
-        const auto path = GetReflectionCachePath(dir, hash);
-        std::ofstream os(path, std::ios::binary);
-        if (!os.is_open()) return;
+    static std::vector<uint8_t> SerializeReflection(const RHI_ProgramReflection& refl) {
+        std::vector<uint8_t> os;
+        os.reserve(512);
 
         WriteU32(os, kReflectionCacheMagic);
         WriteU32(os, kReflectionCacheVersion);
@@ -175,6 +258,7 @@ namespace Nova::Core::Renderer::RHI {
             WriteU32(os, key.m_Set);
             WriteU32(os, key.m_Binding);
         }
+        return os;
     }
 
     bool EndsWithIgnoreCase(std::string_view s, std::string_view suffix) {
@@ -209,22 +293,132 @@ namespace Nova::Core::Renderer::RHI {
         }
     }
 
-    bool EnsureGlobalSessionUnlocked(std::string& outErr) {
-        if (g_GlobalSession) {
-            return true;
+    bool AcquireGlobalSession(Slang::ComPtr<slang::IGlobalSession>& outSession, std::string& outErr) {
+        {
+            std::lock_guard<std::mutex> lock(g_SessionMutex);
+            if (!g_IdleGlobalSessions.empty()) {
+                outSession = std::move(g_IdleGlobalSessions.back());
+                g_IdleGlobalSessions.pop_back();
+                return true;
+            }
         }
+
         SlangGlobalSessionDesc desc{};
         desc.structureSize = sizeof(desc);
         desc.enableGLSL = true;
 
-        const SlangResult hr = slang::createGlobalSession(&desc, g_GlobalSession.writeRef());
-        if (SLANG_FAILED(hr)) {
+        const SlangResult hr = slang::createGlobalSession(&desc, outSession.writeRef());
+        if (SLANG_FAILED(hr) || !outSession) {
             outErr = "slang::createGlobalSession failed";
             return false;
         }
         return true;
     }
 
+    void ReleaseGlobalSession(Slang::ComPtr<slang::IGlobalSession>&& session) {
+        if (!session) return;
+        std::lock_guard<std::mutex> lock(g_SessionMutex);
+        g_IdleGlobalSessions.push_back(std::move(session));
+    }
+
+    static std::filesystem::path NormalizeDependencyPath(const std::filesystem::path& path) {
+        std::error_code ec;
+        std::filesystem::path normalized = std::filesystem::weakly_canonical(path, ec);
+        return ec ? path.lexically_normal() : normalized;
+    }
+
+    // Cache keys and stored dependency lists name files relative to the working directory, the root that
+    // holds both the shader sources and Cache/, so a precompiled cache still hits from another install path.
+    static std::filesystem::path ToCacheKeyPath(const std::filesystem::path& path) {
+        const std::filesystem::path normalized = NormalizeDependencyPath(path);
+        const std::filesystem::path relative = normalized.lexically_relative(NormalizeDependencyPath(std::filesystem::current_path()));
+        if (relative.empty() || *relative.begin() == "..") return normalized; // outside the root: keep absolute
+        return relative;
+    }
+
+    static std::filesystem::path FromCacheKeyPath(const std::filesystem::path& path) {
+        return path.is_relative() ? NormalizeDependencyPath(std::filesystem::current_path() / path) : path;
+    }
+
+    static bool HashFileContents(const std::filesystem::path& path, Hash128& out) {
+        std::error_code ec;
+        const auto writeTime = std::filesystem::last_write_time(path, ec);
+        if (ec) return false;
+        const uintmax_t size = std::filesystem::file_size(path, ec);
+        if (ec) return false;
+
+        const std::string key = path.generic_string();
+        {
+            std::lock_guard<std::mutex> lock(g_DependencyMutex);
+            if (const auto it = g_FileHashes.find(key); it != g_FileHashes.end() &&
+                it->second.m_WriteTime == writeTime && it->second.m_Size == size)
+            {
+                out = it->second.m_Hash;
+                return true;
+            }
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+        std::string bytes(static_cast<size_t>(size), '\0');
+        if (size > 0 && !file.read(bytes.data(), static_cast<std::streamsize>(size))) return false;
+
+        out = HashString128(bytes);
+
+        std::lock_guard<std::mutex> lock(g_DependencyMutex);
+        g_FileHashes[key] = FileHashEntry{ writeTime, size, out };
+        return true;
+    }
+
+    static const std::string& GetCompilerVersionTag() {
+        static std::once_flag once;
+        static std::string tag;
+        std::call_once(once, []() {
+            // The tag is recorded next to the binaries so precompiled-only runs can rebuild the
+            // same cache keys without creating a global session just to ask for it.
+            RHI_ShaderCacheArchive& archive = OpenArchive();
+            RHI_ShaderCacheArchive::Blob stored, unused;
+            const bool hasStored = archive.Find(RHI_ShaderCacheRecordKind::Metadata, kCompilerTagKey, stored, unused);
+            if (g_PrecompiledOnly) {
+                if (hasStored) tag.assign(reinterpret_cast<const char*>(stored.m_Data), stored.m_Size);
+                return;
+            }
+
+            Slang::ComPtr<slang::IGlobalSession> session;
+            std::string err;
+            if (AcquireGlobalSession(session, err)) {
+                const char* build = session->getBuildTagString();
+                tag = build ? build : "";
+                ReleaseGlobalSession(std::move(session));
+            }
+            if (!hasStored || std::string_view(reinterpret_cast<const char*>(stored.m_Data), stored.m_Size) != tag) {
+                archive.Append(RHI_ShaderCacheRecordKind::Metadata, kCompilerTagKey, tag.data(), tag.size());
+            }
+        });
+        return tag;
+    }
+
+    /** Everything except file contents that affects the output. */
+    static std::string BuildOptionsKey(const RHI_ShaderCompileInput& input) {
+        std::string key;
+        key += std::to_string(kShaderCacheKeyVersion);
+        key += '|'; key += GetCompilerVersionTag();
+        key += '|'; key += ToCacheKeyPath(input.m_File).generic_string();
+        key += '|'; key += std::to_string(static_cast<int>(input.m_TargetApi));
+        key += '|'; key += std::to_string(static_cast<int>(input.m_Stage));
+        key += '|'; key += input.m_EntryPoint;
+        key += '|'; key += input.m_Debug ? '1' : '0';
+        key += input.m_Optimize ? '1' : '0';
+
+        for (const auto& inc : input.m_IncludeDirs) {
+            key += "|I"; key += ToCacheKeyPath(inc).generic_string();
+        }
+        for (const auto& d : input.m_Defines) {
+            key += "|D"; key += d.first; key += '='; key += d.second;
+        }
+        return key;
+    }
+
     SlangProfileID ResolveSpirvProfile(slang::IGlobalSession* global) {
         SlangProfileID profile = global->findProfile("glsl_450");
         if (profile == SLANG_PROFILE_UNKNOWN) {
@@ -510,12 +704,13 @@ namespace Nova::Core::Renderer::RHI {
 
     bool GetLinkedSpirv(
         slang::IComponentType* linked,
+        SlangInt entryPointIndex,
         std::string& log,
         std::vector<uint8_t>& outBinary,
         std::string& outFailureMessage) {
         Slang::ComPtr<ISlangBlob> codeBlob;
         Slang::ComPtr<ISlangBlob> diagBlob;
-        const SlangResult hr = linked->getEntryPointCode(0, 0, codeBlob.writeRef(), diagBlob.writeRef());
+        const SlangResult hr = linked->getEntryPointCode(entryPointIndex, 0, codeBlob.writeRef(), diagBlob.writeRef());
         AppendBlobDiagnostics(log, diagBlob.get());
 
         if (SLANG_FAILED(hr) || !codeBlob) {
@@ -535,31 +730,42 @@ namespace Nova::Core::Renderer::RHI {
         return true;
     }
 
-    bool CompileSlangFileToSpirv(
-        slang::IGlobalSession* global,
-        const RHI_ShaderCompileInput& input,
-        std::string&& fileContents,
-        RHI_ShaderCompileResult& out) {
-        const SlangStage slangStage = RhiStageToSlangStage(input.m_Stage);
-        if (slangStage == SLANG_STAGE_NONE) {
-            out.m_Log = "Invalid shader stage";
-            return false;
+    std::vector<std::string> BuildSearchPaths(const RHI_ShaderCompileInput& input, const std::filesystem::path& moduleDir) {
+        std::vector<std::string> paths;
+        // Precompiled modules first so an up-to-date .slang-module wins over re-parsing the source.
+        paths.push_back(ToSlangPathString(moduleDir));
+        const std::filesystem::path parent =
+            input.m_File.has_parent_path() ? input.m_File.parent_path() : std::filesystem::current_path();
+        paths.push_back(ToSlangPathString(parent));
+        for (const auto& inc : input.m_IncludeDirs) {
+            paths.push_back(ToSlangPathString(inc));
+        }
+        return paths;
+    }
+
+    /** Inputs with equal keys can share one ISession (stage, entry point and link options are per link). */
+    std::string BuildSessionKey(const RHI_ShaderCompileInput& input, const std::filesystem::path& moduleDir) {
+        std::string key = std::to_string(static_cast<int>(input.m_TargetApi));
+        for (const auto& path : BuildSearchPaths(input, moduleDir)) {
+            key += "|I"; key += path;
         }
+        for (const auto& d : input.m_Defines) {
+            key += "|D"; key += d.first; key += '='; key += d.second;
+        }
+        return key;
+    }
 
+    bool CreateSlangSession(
+        slang::IGlobalSession* global,
+        const RHI_ShaderCompileInput& input,
+        const std::filesystem::path& moduleDir,
+        Slang::ComPtr<slang::ISession>& outSession) {
         slang::TargetDesc target{};
         target.structureSize = sizeof(target);
         target.format = SLANG_SPIRV;
         target.profile = ResolveSpirvProfile(global);
 
-        std::vector<std::string> searchPathStrings;
-        {
-            const std::filesystem::path parent =
-                input.m_File.has_parent_path() ? input.m_File.parent_path() : std::filesystem::current_path();
-            searchPathStrings.push_back(ToSlangPathString(parent));
-            for (const auto& inc : input.m_IncludeDirs) {
-                searchPathStrings.push_back(ToSlangPathString(inc));
-            }
-        }
+        const std::vector<std::string> searchPathStrings = BuildSearchPaths(input, moduleDir);
         std::vector<const char*> searchPathPtrs;
         searchPathPtrs.reserve(searchPathStrings.size());
         for (const auto& s : searchPathStrings) {
@@ -575,6 +781,11 @@ namespace Nova::Core::Renderer::RHI {
             macros.push_back(m);
         }
 
+        slang::CompilerOptionEntry useBinaryModules{};
+        useBinaryModules.name = slang::CompilerOptionName::UseUpToDateBinaryModule;
+        useBinaryModules.value.kind = slang::CompilerOptionValueKind::Int;
+        useBinaryModules.value.intValue0 = 1;
+
         slang::SessionDesc sessionDesc{};
         sessionDesc.structureSize = sizeof(sessionDesc);
         sessionDesc.targets = &target;
@@ -584,13 +795,131 @@ namespace Nova::Core::Renderer::RHI {
         sessionDesc.preprocessorMacros = macros.empty() ? nullptr : macros.data();
         sessionDesc.preprocessorMacroCount = static_cast<SlangInt>(macros.size());
         sessionDesc.defaultMatrixLayoutMode = SLANG_MATRIX_LAYOUT_COLUMN_MAJOR;
+        sessionDesc.compilerOptionEntries = &useBinaryModules;
+        sessionDesc.compilerOptionEntryCount = 1;
 
-        Slang::ComPtr<slang::ISession> session;
-        if (SLANG_FAILED(global->createSession(sessionDesc, session.writeRef())) || !session) {
-            out.m_Log = "slang::IGlobalSession::createSession failed";
-            return false;
+        return SLANG_SUCCEEDED(global->createSession(sessionDesc, outSession.writeRef())) && outSession;
+    }
+
+    bool IsSessionCurrent(const PooledSlangSession& pooled) {
+        for (const auto& [path, hash] : pooled.m_LoadedFiles) {
+            Hash128 current{};
+            if (!HashFileContents(path, current) || current != hash) return false;
+        }
+        return true;
+    }
+
+    std::unique_ptr<PooledSlangSession> AcquireSlangSession(
+        const std::string& key,
+        const RHI_ShaderCompileInput& input,
+        const std::filesystem::path& moduleDir,
+        std::string& outErr) {
+        std::vector<std::unique_ptr<PooledSlangSession>> stale;
+        std::unique_ptr<PooledSlangSession> pooled;
+        {
+            std::lock_guard<std::mutex> lock(g_SessionMutex);
+            if (auto it = g_IdleSlangSessions.find(key); it != g_IdleSlangSessions.end() && !it->second.empty()) {
+                pooled = std::move(it->second.back());
+                it->second.pop_back();
+                --g_IdleSlangSessionCount;
+            }
+        }
+
+        // A source the session already parsed changed on disk: its module cache would serve the old code.
+        if (pooled && !IsSessionCurrent(*pooled)) {
+            pooled->m_Session.setNull();
+            ReleaseGlobalSession(std::move(pooled->m_Global));
+            pooled.reset();
         }
+        if (pooled) return pooled;
 
+        pooled = std::make_unique<PooledSlangSession>();
+        if (!AcquireGlobalSession(pooled->m_Global, outErr)) {
+            return nullptr;
+        }
+        if (!CreateSlangSession(pooled->m_Global.get(), input, moduleDir, pooled->m_Session)) {
+            ReleaseGlobalSession(std::move(pooled->m_Global));
+            outErr = "slang::IGlobalSession::createSession failed";
+            return nullptr;
+        }
+        return pooled;
+    }
+
+    void ReleaseSlangSession(const std::string& key, std::unique_ptr<PooledSlangSession>&& pooled) {
+        if (!pooled) return;
+        {
+            std::lock_guard<std::mutex> lock(g_SessionMutex);
+            if (g_IdleSlangSessionCount < kMaxIdleSlangSessions) {
+                g_IdleSlangSessions[key].push_back(std::move(pooled));
+                ++g_IdleSlangSessionCount;
+                return;
+            }
+        }
+        // Pool full: keep the global session, drop the compile session.
+        pooled->m_Session.setNull();
+        ReleaseGlobalSession(std::move(pooled->m_Global));
+    }
+
+    /**
+     * Serializes every imported module the session has loaded to `moduleDir` as Slang IR, so
+     * other sessions (and later runs) load `Name.slang-module` instead of re-parsing the source.
+     * Textual #include headers are part of their includer and are not affected.
+     */
+    void WritePrecompiledModules(slang::ISession* session, slang::IModule* root, const std::filesystem::path& moduleDir) {
+        std::error_code ec;
+        std::filesystem::create_directories(moduleDir, ec);
+
+        for (SlangInt i = 0; i < session->getLoadedModuleCount(); ++i) {
+            slang::IModule* module = session->getLoadedModule(i);
+            if (!module || module == root) continue;
+
+            const char* name = module->getName();
+            const char* sourcePath = module->getFilePath();
+            if (!name || !sourcePath || !EndsWithIgnoreCase(sourcePath, ".slang")) continue; // already binary
+
+            const std::filesystem::path target = moduleDir / (std::string(name) + ".slang-module");
+            const auto sourceTime = std::filesystem::last_write_time(sourcePath, ec);
+            if (ec) continue;
+            const auto targetTime = std::filesystem::last_write_time(target, ec);
+            if (!ec && targetTime >= sourceTime) continue;
+
+            // Write then rename: other workers may be loading or writing the same module.
+            std::filesystem::path temp = target;
+            temp += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+            if (SLANG_SUCCEEDED(module->writeToFile(ToSlangPathString(temp).c_str()))) {
+                std::filesystem::rename(temp, target, ec);
+                if (ec) std::filesystem::remove(temp, ec);
+            }
+        }
+    }
+
+    struct SlangEntryRequest {
+        std::string m_Name;
+        RHI_ShaderStage m_Stage = RHI_ShaderStage::Unknown;
+    };
+
+    /**
+     * Loads `input.m_File` in `pooled` and links all `entries` as one program; `outs[i]` receives
+     * entry i. On failure every result carries the log.
+     */
+    bool CompileSlangEntryPoints(
+        PooledSlangSession& pooled,
+        const RHI_ShaderCompileInput& input,
+        const std::vector<SlangEntryRequest>& entries,
+        const std::filesystem::path& moduleDir,
+        const std::string& fileContents,
+        std::vector<RHI_ShaderCompileResult>& outs) {
+        outs.assign(entries.size(), RHI_ShaderCompileResult{});
+        for (size_t i = 0; i < entries.size(); ++i) {
+            outs[i].m_Stage = entries[i].m_Stage;
+            outs[i].m_TargetApi = input.m_TargetApi;
+        }
+        auto fail = [&outs](const std::string& log) {
+            for (auto& out : outs) out.m_Log = log;
+            return false;
+        };
+
+        slang::ISession* session = pooled.m_Session.get();
         const std::string moduleName = input.m_File.stem().string();
         std::string log;
 
@@ -598,33 +927,57 @@ namespace Nova::Core::Renderer::RHI {
         slang::IModule* rawModule = session->loadModule(moduleName.c_str(), diagLoad.writeRef());
         AppendBlobDiagnostics(log, diagLoad.get());
         if (!rawModule) {
-            out.m_Log = log.empty() ? ("loadModule failed for: " + moduleName) : log;
-            return false;
+            return fail(log.empty() ? ("loadModule failed for: " + moduleName) : log);
         }
         Slang::ComPtr<slang::IModule> module(rawModule);
 
-        Slang::ComPtr<slang::IEntryPoint> entryPoint;
-        Slang::ComPtr<ISlangBlob> diagEp;
-        const SlangResult epHr = module->findAndCheckEntryPoint(
-            input.m_EntryPoint.c_str(),
-            slangStage,
-            entryPoint.writeRef(),
-            diagEp.writeRef());
-        AppendBlobDiagnostics(log, diagEp.get());
-        if (SLANG_FAILED(epHr) || !entryPoint) {
-            out.m_Log = log.empty() ? "findAndCheckEntryPoint failed" : log;
-            return false;
+        std::vector<std::filesystem::path> dependencies;
+        dependencies.push_back(NormalizeDependencyPath(input.m_File));
+        for (SlangInt32 i = 0; i < module->getDependencyFileCount(); ++i) {
+            const char* depPath = module->getDependencyFilePath(i);
+            if (!depPath || !*depPath) continue;
+            std::filesystem::path dep = NormalizeDependencyPath(depPath);
+            if (std::find(dependencies.begin(), dependencies.end(), dep) == dependencies.end()) {
+                dependencies.push_back(std::move(dep));
+            }
+        }
+        for (const auto& dep : dependencies) {
+            Hash128 hash{};
+            if (HashFileContents(dep, hash)) pooled.m_LoadedFiles[dep.generic_string()] = hash;
+        }
+
+        WritePrecompiledModules(session, module.get(), moduleDir);
+
+        std::vector<Slang::ComPtr<slang::IEntryPoint>> entryPoints(entries.size());
+        std::vector<slang::IComponentType*> parts;
+        parts.reserve(entries.size() + 1);
+        parts.push_back(module.get());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const SlangStage slangStage = RhiStageToSlangStage(entries[i].m_Stage);
+            if (slangStage == SLANG_STAGE_NONE) {
+                return fail("Invalid shader stage");
+            }
+
+            Slang::ComPtr<ISlangBlob> diagEp;
+            const SlangResult epHr = module->findAndCheckEntryPoint(
+                entries[i].m_Name.c_str(),
+                slangStage,
+                entryPoints[i].writeRef(),
+                diagEp.writeRef());
+            AppendBlobDiagnostics(log, diagEp.get());
+            if (SLANG_FAILED(epHr) || !entryPoints[i]) {
+                return fail(log.empty() ? ("findAndCheckEntryPoint failed for: " + entries[i].m_Name) : log);
+            }
+            parts.push_back(entryPoints[i].get());
         }
 
-        slang::IComponentType* parts[] = { module.get(), entryPoint.get() };
         Slang::ComPtr<slang::IComponentType> program;
         Slang::ComPtr<ISlangBlob> diagCompose;
-        const SlangResult composeHr =
-            session->createCompositeComponentType(parts, 2, program.writeRef(), diagCompose.writeRef());
+        const SlangResult composeHr = session->createCompositeComponentType(
+            parts.data(), static_cast<SlangInt>(parts.size()), program.writeRef(), diagCompose.writeRef());
         AppendBlobDiagnostics(log, diagCompose.get());
         if (SLANG_FAILED(composeHr) || !program) {
-            out.m_Log = log.empty() ? "createCompositeComponentType failed" : log;
-            return false;
+            return fail(log.empty() ? "createCompositeComponentType failed" : log);
         }
 
         std::vector<slang::CompilerOptionEntry> linkOpts;
@@ -639,194 +992,447 @@ namespace Nova::Core::Renderer::RHI {
             diagLink.writeRef());
         AppendBlobDiagnostics(log, diagLink.get());
         if (SLANG_FAILED(linkHr) || !linked) {
-            out.m_Log = log.empty() ? "linkWithOptions failed" : log;
-            return false;
+            return fail(log.empty() ? "linkWithOptions failed" : log);
         }
 
-        std::string failMsg;
-        if (!GetLinkedSpirv(linked.get(), log, out.m_Binary, failMsg)) {
-            out.m_Log = std::move(failMsg);
-            return false;
-        }
-        out.m_Format = RHI_ShaderBinaryFormat::Spirv;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            RHI_ShaderCompileResult& out = outs[i];
 
-        // Reflection: best-effort (failure should not fail compilation).
-        ExtractReflectionFromLinked(linked.get(), input.m_Stage, out.m_Reflection);
-        if (out.m_Reflection.m_Sets.empty()) {
-            // Diagnostics: dump a small excerpt of Slang reflection JSON to help map categories/bindings.
-            Slang::ComPtr<ISlangBlob> jsonBlob;
-            if (SLANG_SUCCEEDED(spReflection_ToJson((SlangReflection*)linked->getLayout(), nullptr, jsonBlob.writeRef())) && jsonBlob) {
-                const char* ptr = static_cast<const char*>(jsonBlob->getBufferPointer());
-                const size_t size = jsonBlob->getBufferSize();
-                if (ptr && size > 0) {
-                    const size_t kMax = 4096;
-                    out.m_Log.append("\n[SlangReflectionExcerpt]\n");
-                    out.m_Log.append(ptr, ptr + std::min(size, kMax));
-                    if (size > kMax) out.m_Log.append("\n...[truncated]...\n");
+            std::string failMsg;
+            if (!GetLinkedSpirv(linked.get(), static_cast<SlangInt>(i), log, out.m_Binary, failMsg)) {
+                return fail(failMsg);
+            }
+            out.m_Format = RHI_ShaderBinaryFormat::Spirv;
+
+            // Reflection: best-effort (failure should not fail compilation).
+            ExtractReflectionFromLinked(linked.get(), entries[i].m_Stage, out.m_Reflection);
+            out.m_Log = log;
+            if (out.m_Reflection.m_Sets.empty()) {
+                // Diagnostics: dump a small excerpt of Slang reflection JSON to help map categories/bindings.
+                Slang::ComPtr<ISlangBlob> jsonBlob;
+                if (SLANG_SUCCEEDED(spReflection_ToJson((SlangReflection*)linked->getLayout(), nullptr, jsonBlob.writeRef())) && jsonBlob) {
+                    const char* ptr = static_cast<const char*>(jsonBlob->getBufferPointer());
+                    const size_t size = jsonBlob->getBufferSize();
+                    if (ptr && size > 0) {
+                        const size_t kMax = 4096;
+                        out.m_Log.append("\n[SlangReflectionExcerpt]\n");
+                        out.m_Log.append(ptr, ptr + std::min(size, kMax));
+                        if (size > kMax) out.m_Log.append("\n...[truncated]...\n");
+                    }
                 }
             }
-        }
 
-        out.m_Source = std::move(fileContents);
-        out.m_Log = std::move(log);
-        out.m_Success = true;
+            out.m_Source = fileContents;
+            out.m_Dependencies = dependencies;
+            out.m_Success = true;
+        }
         return true;
     }
 
+    /** Pooled-session compile of the given entry points of one file (all inputs share file and options). */
+    bool CompileSlangFileToSpirv(
+        const RHI_ShaderCompileInput& input,
+        const std::vector<SlangEntryRequest>& entries,
+        const std::filesystem::path& moduleDir,
+        std::vector<RHI_ShaderCompileResult>& outs) {
+        outs.assign(entries.size(), RHI_ShaderCompileResult{});
+        for (auto& out : outs) out.m_TargetApi = input.m_TargetApi;
+
+        std::string source;
+        std::string err;
+        if (!ReadTextFile(input.m_File, source, err)) {
+            for (auto& out : outs) out.m_Log = err;
+            return false;
+        }
+
+        const std::string key = BuildSessionKey(input, moduleDir);
+        std::unique_ptr<PooledSlangSession> pooled = AcquireSlangSession(key, input, moduleDir, err);
+        if (!pooled) {
+            for (auto& out : outs) out.m_Log = err;
+            return false;
+        }
+
+        const bool ok = CompileSlangEntryPoints(*pooled, input, entries, moduleDir, source, outs);
+        ReleaseSlangSession(key, std::move(pooled));
+        return ok;
+    }
+
     // -----------------------------------------------------------------------------
 
     std::filesystem::path RHI_ShaderCompiler::GetCacheDirectory() {
-        auto dir = std::filesystem::current_path() / "Cache" / "Shaders";
-        std::filesystem::create_directories(dir);
-        return dir;
+        return CacheDirectory();
+    }
+
+    std::filesystem::path RHI_ShaderCompiler::GetModuleCacheDirectory() {
+        return GetCacheDirectory() / "Modules";
     }
 
     std::string RHI_ShaderCompiler::ComputeHash(const RHI_ShaderCompileInput& input) {
-        std::string hash = input.m_File.generic_string();
+        std::string key = BuildOptionsKey(input);
 
-        std::error_code ec;
-        const auto ft = std::filesystem::last_write_time(input.m_File, ec);
-        if (!ec) {
-            hash += std::to_string(ft.time_since_epoch().count());
+        std::vector<std::filesystem::path> deps;
+        if (!LoadDependencies(HashString128(key).ToHex(), deps)) {
+            deps.push_back(NormalizeDependencyPath(input.m_File));
         }
 
-        hash += std::to_string(static_cast<int>(input.m_TargetApi));
-        hash += std::to_string(static_cast<int>(input.m_Stage));
-        hash += input.m_EntryPoint;
-        hash += std::to_string(input.m_Debug ? 1 : 0);
-        hash += std::to_string(input.m_Optimize ? 1 : 0);
+        for (const auto& dep : deps) {
+            Hash128 content{};
+            key += "|F"; key += ToCacheKeyPath(dep).generic_string(); key += '=';
+            key += HashFileContents(dep, content) ? content.ToHex() : std::string("missing");
+        }
 
-        for (const auto& inc : input.m_IncludeDirs) {
-            hash += inc.generic_string();
+        return HashString128(key).ToHex();
+    }
+
+    bool RHI_ShaderCompiler::LoadDependencies(const std::string& inputKey, std::vector<std::filesystem::path>& out) {
+        {
+            std::lock_guard<std::mutex> lock(g_DependencyMutex);
+            if (const auto it = g_Dependencies.find(inputKey); it != g_Dependencies.end()) {
+                out = it->second;
+                return true;
+            }
         }
-        for (const auto& d : input.m_Defines) {
-            hash += d.first;
-            hash += d.second;
+
+        RHI_ShaderCacheArchive::Blob list, unused;
+        if (!GetArchive().Find(RHI_ShaderCacheRecordKind::Dependencies, inputKey, list, unused)) return false;
+
+        std::vector<std::filesystem::path> deps;
+        std::string_view text(reinterpret_cast<const char*>(list.m_Data), list.m_Size);
+        while (!text.empty()) {
+            const size_t end = std::min(text.find('\n'), text.size());
+            if (end > 0) deps.push_back(FromCacheKeyPath(std::string(text.substr(0, end))));
+            text.remove_prefix(std::min(end + 1, text.size()));
         }
+        if (deps.empty()) return false;
 
-        return std::to_string(std::hash<std::string>{}(hash));
+        std::lock_guard<std::mutex> lock(g_DependencyMutex);
+        g_Dependencies[inputKey] = deps;
+        out = std::move(deps);
+        return true;
+    }
+
+    void RHI_ShaderCompiler::SaveDependencies(const std::string& inputKey, const std::vector<std::filesystem::path>& deps) {
+        if (deps.empty()) return;
+        {
+            std::lock_guard<std::mutex> lock(g_DependencyMutex);
+            if (const auto it = g_Dependencies.find(inputKey); it != g_Dependencies.end() && it->second == deps) {
+                return; // unchanged: avoid growing the archive
+            }
+            g_Dependencies[inputKey] = deps;
+        }
+
+        std::string text;
+        for (const auto& dep : deps) {
+            text += ToCacheKeyPath(dep).generic_string();
+            text += '\n';
+        }
+        GetArchive().Append(RHI_ShaderCacheRecordKind::Dependencies, inputKey, text.data(), text.size());
     }
 
     bool RHI_ShaderCompiler::NeedsRecompile(const RHI_ShaderCompileInput& input, const std::string& hash) {
         (void)input;
-        const auto path = GetCacheDirectory() / (hash + ".spv");
-        return !std::filesystem::exists(path);
+        return !GetArchive().Contains(RHI_ShaderCacheRecordKind::Shader, hash);
     }
 
     bool RHI_ShaderCompiler::LoadCache(const std::string& hash, RHI_ShaderCompileResult& out) {
-        const auto dir = GetCacheDirectory();
-        const auto path = dir / (hash + ".spv");
-        if (!std::filesystem::exists(path)) {
+        RHI_ShaderCacheArchive::Blob spirv, reflection;
+        if (!GetArchive().Find(RHI_ShaderCacheRecordKind::Shader, hash, spirv, reflection)) {
             return false;
         }
-
-        std::ifstream file(path, std::ios::binary);
-        if (!file.is_open()) {
+        if (spirv.m_Size < 4 || (spirv.m_Size % 4) != 0) {
             return false;
         }
 
-        file.seekg(0, std::ios::end);
-        const auto end = file.tellg();
-        file.seekg(0);
-        const auto size = static_cast<size_t>(end);
-        if (size < 4 || (size % 4) != 0) {
-            return false;
-        }
-
-        out.m_Binary.resize(size);
-        file.read(reinterpret_cast<char*>(out.m_Binary.data()), static_cast<std::streamsize>(size));
+        // One copy out of the mapping: the result owns its SPIR-V.
+        out.m_Binary.assign(spirv.m_Data, spirv.m_Data + spirv.m_Size);
         out.m_Format = RHI_ShaderBinaryFormat::Spirv;
 
         // Reflection is optional, but try to load it.
-        (void)LoadReflectionCache(dir, hash, out.m_Reflection);
+        if (reflection.m_Size > 0) {
+            (void)DeserializeReflection(reflection.m_Data, reflection.m_Size, out.m_Reflection);
+        }
 
         out.m_Success = true;
         return true;
     }
 
     void RHI_ShaderCompiler::SaveCache(const std::string& hash, const RHI_ShaderCompileResult& result) {
-        const auto dir = GetCacheDirectory();
-        const auto path = dir / (hash + ".spv");
-        std::ofstream file(path, std::ios::binary);
-        if (!file.is_open()) {
-            return;
-        }
-        file.write(reinterpret_cast<const char*>(result.m_Binary.data()),
-            static_cast<std::streamsize>(result.m_Binary.size()));
+        const std::vector<uint8_t> reflection = SerializeReflection(result.m_Reflection);
+        GetArchive().Append(RHI_ShaderCacheRecordKind::Shader, hash,
+            result.m_Binary.data(), result.m_Binary.size(),
+            reflection.data(), reflection.size());
+    }
 
-        SaveReflectionCache(dir, hash, result.m_Reflection);
+    RHI_ShaderCacheArchive& RHI_ShaderCompiler::GetArchive() {
+        return OpenArchive();
     }
 
-    RHI_ShaderCompileResult RHI_ShaderCompiler::Compile(const RHI_ShaderCompileInput& input) {
-        RHI_ShaderCompileInput in = input;
-        if (in.m_Stage == RHI_ShaderStage::Unknown) {
-            in.m_Stage = ShaderStageFromFileExtension(in.m_File);
+    void RHI_ShaderCompiler::SetPrecompiledOnly(bool precompiledOnly) {
+        g_PrecompiledOnly = precompiledOnly;
+    }
+
+    bool RHI_ShaderCompiler::IsPrecompiledOnly() {
+        return g_PrecompiledOnly;
+    }
+
+    static std::string MissingPrecompiledLog(const RHI_ShaderCompileInput& input) {
+        return "Shader not found in the precompiled cache (rebuild it with nova-shaderc): " + input.m_File.generic_string();
+    }
+
+    bool RHI_ShaderCompiler::PrepareInput(const RHI_ShaderCompileInput& input, RHI_ShaderCompileInput& outInput, RHI_ShaderCompileResult& outFailure) {
+        outInput = input;
+        if (outInput.m_Stage == RHI_ShaderStage::Unknown) {
+            outInput.m_Stage = ShaderStageFromFileExtension(outInput.m_File);
+        }
+
+        // Nothing can be recompiled without Slang: forced compiles read the archive like any other.
+        if (g_PrecompiledOnly) {
+            outInput.m_SkipCache = false;
         }
 
-        RHI_ShaderCompileResult failure{};
-        failure.m_TargetApi = in.m_TargetApi;
+        outFailure = {};
+        outFailure.m_TargetApi = outInput.m_TargetApi;
 
-        if (in.m_Stage == RHI_ShaderStage::Unknown) {
-            failure.m_Log =
-                "Cannot infer shader stage from file name (expected e.g. *.vert.slang): " + in.m_File.string();
-            return failure;
+        if (outInput.m_Stage == RHI_ShaderStage::Unknown) {
+            outFailure.m_Log =
+                "Cannot infer shader stage from file name (expected e.g. *.vert.slang): " + outInput.m_File.string();
+            return false;
         }
+        return true;
+    }
 
+    std::optional<std::shared_future<RHI_ShaderCompileResult>> RHI_ShaderCompiler::FindOrClaim(
+        const RHI_ShaderCompileInput& input, const std::string& hash,
+        std::shared_ptr<std::promise<RHI_ShaderCompileResult>>& outOwner)
+    {
         std::lock_guard<std::mutex> lock(g_Mutex);
 
-        const std::string hash = ComputeHash(in);
-
-        if (!in.m_SkipCache) {
+        if (!input.m_SkipCache) {
             if (const auto it = g_MemoryCache.find(hash); it != g_MemoryCache.end()) {
-                return it->second;
-            }
-
-            if (!NeedsRecompile(in, hash)) {
-                RHI_ShaderCompileResult disk{};
-                if (LoadCache(hash, disk)) {
-                    disk.m_Stage = in.m_Stage;
-                    disk.m_TargetApi = in.m_TargetApi;
-                    std::string readErr;
-                    ReadTextFile(in.m_File, disk.m_Source, readErr);
-                    std::error_code ec;
-                    disk.m_LastWriteTime = std::filesystem::last_write_time(in.m_File, ec);
-                    disk.m_Success = true;
-                    g_MemoryCache[hash] = disk;
-                    return disk;
-                }
+                std::promise<RHI_ShaderCompileResult> ready;
+                ready.set_value(it->second);
+                return ready.get_future().share();
             }
         }
 
-        std::string sessionErr;
-        if (!EnsureGlobalSessionUnlocked(sessionErr)) {
-            failure.m_Log = std::move(sessionErr);
-            return failure;
+        // Someone is already compiling this exact key: share their result.
+        if (const auto it = g_InFlight.find(hash); it != g_InFlight.end()) {
+            return it->second;
         }
 
-        std::string source;
-        std::string readErr;
-        if (!ReadTextFile(in.m_File, source, readErr)) {
-            failure.m_Log = std::move(readErr);
-            return failure;
-        }
+        outOwner = std::make_shared<std::promise<RHI_ShaderCompileResult>>();
+        g_InFlight.emplace(hash, outOwner->get_future().share());
+        return std::nullopt;
+    }
 
-        RHI_ShaderCompileResult out{};
-        out.m_Stage = in.m_Stage;
-        out.m_TargetApi = in.m_TargetApi;
+    RHI_ShaderCompileResult RHI_ShaderCompiler::CompileClaimed(const RHI_ShaderCompileInput& in, const std::string& hash,
+        std::promise<RHI_ShaderCompileResult>& owner)
+    {
+        RHI_ShaderCompileResult out = CompileUncached(in, hash);
+        PublishClaimed(in, hash, owner, out);
+        return out;
+    }
 
-        if (!CompileSlangFileToSpirv(g_GlobalSession.get(), in, std::move(source), out)) {
-            return out;
+    void RHI_ShaderCompiler::PublishClaimed(const RHI_ShaderCompileInput& in, const std::string& hash,
+        std::promise<RHI_ShaderCompileResult>& owner, const RHI_ShaderCompileResult& result)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_Mutex);
+            if (result.m_Success && !in.m_SkipCache) {
+                g_MemoryCache[hash] = result;
+            }
+            g_InFlight.erase(hash);
         }
+        owner.set_value(result);
+    }
+
+    bool RHI_ShaderCompiler::TryLoadCached(const RHI_ShaderCompileInput& in, const std::string& hash, RHI_ShaderCompileResult& out) {
+        if (in.m_SkipCache || NeedsRecompile(in, hash)) return false;
 
+        RHI_ShaderCompileResult disk{};
+        if (!LoadCache(hash, disk)) return false;
+
+        disk.m_Stage = in.m_Stage;
+        disk.m_TargetApi = in.m_TargetApi;
+        std::string readErr;
+        ReadTextFile(in.m_File, disk.m_Source, readErr);
+        std::error_code ec;
+        disk.m_LastWriteTime = std::filesystem::last_write_time(in.m_File, ec);
+        LoadDependencies(HashString128(BuildOptionsKey(in)).ToHex(), disk.m_Dependencies);
+        disk.m_Success = true;
+        out = std::move(disk);
+        return true;
+    }
+
+    void RHI_ShaderCompiler::StoreCompiled(const RHI_ShaderCompileInput& in, RHI_ShaderCompileResult& out) {
         std::error_code ec;
         out.m_LastWriteTime = std::filesystem::last_write_time(in.m_File, ec);
 
         if (!in.m_SkipCache) {
-            SaveCache(hash, out);
-            g_MemoryCache[hash] = out;
+            // The include graph is only known now: record it, then store under the key it implies
+            // (equal to the pre-compile key unless the dependency list changed since the last compile).
+            SaveDependencies(HashString128(BuildOptionsKey(in)).ToHex(), out.m_Dependencies);
+            SaveCache(ComputeHash(in), out);
         }
+    }
 
-        return out;
+    RHI_ShaderCompileResult RHI_ShaderCompiler::CompileUncached(const RHI_ShaderCompileInput& in, const std::string& hash) {
+        RHI_ShaderCompileResult cached{};
+        if (TryLoadCached(in, hash, cached)) {
+            return cached;
+        }
+        if (g_PrecompiledOnly) {
+            RHI_ShaderCompileResult missing{};
+            missing.m_Stage = in.m_Stage;
+            missing.m_TargetApi = in.m_TargetApi;
+            missing.m_Log = MissingPrecompiledLog(in);
+            return missing;
+        }
+
+        std::vector<RHI_ShaderCompileResult> outs;
+        if (!CompileSlangFileToSpirv(in, { SlangEntryRequest{ in.m_EntryPoint, in.m_Stage } }, GetModuleCacheDirectory(), outs)) {
+            return outs.front();
+        }
+
+        StoreCompiled(in, outs.front());
+        return std::move(outs.front());
+    }
+
+    std::vector<RHI_ShaderCompileResult> RHI_ShaderCompiler::CompileProgram(const std::vector<RHI_ShaderCompileInput>& stages) {
+        std::vector<RHI_ShaderCompileInput> ins(stages.size());
+        std::vector<RHI_ShaderCompileResult> results(stages.size());
+        if (stages.empty()) return results;
+
+        for (size_t i = 0; i < stages.size(); ++i) {
+            if (!PrepareInput(stages[i], ins[i], results[i])) {
+                return results;
+            }
+        }
+
+        // Only entry points of one file with identical options can share a link.
+        for (size_t i = 1; i < ins.size(); ++i) {
+            const RHI_ShaderCompileInput& a = ins.front();
+            const RHI_ShaderCompileInput& b = ins[i];
+            if (b.m_File != a.m_File || b.m_TargetApi != a.m_TargetApi || b.m_IncludeDirs != a.m_IncludeDirs ||
+                b.m_Defines != a.m_Defines || b.m_Debug != a.m_Debug || b.m_Optimize != a.m_Optimize ||
+                b.m_SkipCache != a.m_SkipCache)
+            {
+                return CompileBatch(stages);
+            }
+        }
+
+        // Claim every stage like QueueCompile does, so a concurrent Compile/CompileAsync of the same key shares
+        // this link instead of compiling it again (and the other way around).
+        std::vector<std::string> hashes(ins.size());
+        std::vector<std::optional<std::shared_future<RHI_ShaderCompileResult>>> pending(ins.size());
+        std::vector<std::shared_ptr<std::promise<RHI_ShaderCompileResult>>> owners(ins.size());
+        std::vector<size_t> toCompile;
+        for (size_t i = 0; i < ins.size(); ++i) {
+            hashes[i] = ComputeHash(ins[i]);
+            pending[i] = FindOrClaim(ins[i], hashes[i], owners[i]);
+            if (pending[i]) continue;
+
+            if (TryLoadCached(ins[i], hashes[i], results[i])) {
+                PublishClaimed(ins[i], hashes[i], *owners[i], results[i]);
+            }
+            else if (g_PrecompiledOnly) {
+                results[i].m_Stage = ins[i].m_Stage;
+                results[i].m_TargetApi = ins[i].m_TargetApi;
+                results[i].m_Log = MissingPrecompiledLog(ins[i]);
+                PublishClaimed(ins[i], hashes[i], *owners[i], results[i]);
+            }
+            else {
+                toCompile.push_back(i);
+            }
+        }
+
+        if (!toCompile.empty()) {
+            std::vector<SlangEntryRequest> entries;
+            entries.reserve(toCompile.size());
+            for (size_t i : toCompile) {
+                entries.push_back(SlangEntryRequest{ ins[i].m_EntryPoint, ins[i].m_Stage });
+            }
+
+            std::vector<RHI_ShaderCompileResult> outs;
+            const bool ok = CompileSlangFileToSpirv(ins[toCompile.front()], entries, GetModuleCacheDirectory(), outs);
+            for (size_t k = 0; k < toCompile.size(); ++k) {
+                const size_t i = toCompile[k];
+                if (ok) StoreCompiled(ins[i], outs[k]);
+                results[i] = std::move(outs[k]);
+                PublishClaimed(ins[i], hashes[i], *owners[i], results[i]);
+            }
+        }
+
+        // Stages another caller had cached or in flight; ours are published first, so two overlapping
+        // programs never wait on each other.
+        for (size_t i = 0; i < ins.size(); ++i) {
+            if (pending[i]) results[i] = pending[i]->get();
+        }
+        return results;
+    }
+
+    RHI_ShaderCompileResult RHI_ShaderCompiler::Compile(const RHI_ShaderCompileInput& input) {
+        RHI_ShaderCompileInput in;
+        RHI_ShaderCompileResult failure;
+        if (!PrepareInput(input, in, failure)) {
+            return failure;
+        }
+
+        const std::string hash = ComputeHash(in);
+
+        std::shared_ptr<std::promise<RHI_ShaderCompileResult>> owner;
+        if (auto pending = FindOrClaim(in, hash, owner)) {
+            return pending->get();
+        }
+
+        // Synchronous callers compile on their own thread rather than waiting on the pool.
+        return CompileClaimed(in, hash, *owner);
+    }
+
+    std::shared_future<RHI_ShaderCompileResult> RHI_ShaderCompiler::CompileAsync(const RHI_ShaderCompileInput& input) {
+        return QueueCompile(input, g_CompileJobs);
+    }
+
+    std::shared_future<RHI_ShaderCompileResult> RHI_ShaderCompiler::QueueCompile(const RHI_ShaderCompileInput& input, JobCounter& counter) {
+        RHI_ShaderCompileInput in;
+        RHI_ShaderCompileResult failure;
+        if (!PrepareInput(input, in, failure)) {
+            std::promise<RHI_ShaderCompileResult> ready;
+            ready.set_value(std::move(failure));
+            return ready.get_future().share();
+        }
+
+        const std::string hash = ComputeHash(in);
+
+        std::shared_ptr<std::promise<RHI_ShaderCompileResult>> owner;
+        if (auto pending = FindOrClaim(in, hash, owner)) {
+            return *pending;
+        }
+
+        std::shared_future<RHI_ShaderCompileResult> future = owner->get_future().share();
+        JobSystem::Run([in, hash, owner]() {
+            CompileClaimed(in, hash, *owner);
+        }, { "Shader compile", &counter });
+        return future;
+    }
+
+    std::vector<RHI_ShaderCompileResult> RHI_ShaderCompiler::CompileBatch(const std::vector<RHI_ShaderCompileInput>& inputs) {
+        JobCounter batch;
+        std::vector<std::shared_future<RHI_ShaderCompileResult>> futures;
+        futures.reserve(inputs.size());
+        for (const auto& input : inputs) {
+            futures.push_back(QueueCompile(input, batch));
+        }
+        // Run the batch's compiles here too instead of parking this thread (possibly a worker) on futures; only
+        // compiles another caller already had in flight are waited on below.
+        JobSystem::Wait(batch);
+
+        std::vector<RHI_ShaderCompileResult> results;
+        results.reserve(inputs.size());
+        for (auto& f : futures) {
+            results.push_back(f.get());
+        }
+        return results;
     }
 
     bool ReadTextFile(const std::filesystem::path& path, std::string& outText, std::string& outError) {
@@ -863,16 +1469,44 @@ namespace Nova::Core::Renderer::RHI {
     }
 
     bool EnsureSlangInitialized() {
-        std::lock_guard<std::mutex> lock(g_Mutex);
+        if (g_PrecompiledOnly) return true;
+
+        // Warms the session pool so the first compile does not pay for session creation.
+        Slang::ComPtr<slang::IGlobalSession> session;
         std::string err;
-        return EnsureGlobalSessionUnlocked(err);
+        if (!AcquireGlobalSession(session, err)) {
+            return false;
+        }
+        ReleaseGlobalSession(std::move(session));
+        return true;
     }
 
     void ShutdownSlang() {
-        std::lock_guard<std::mutex> lock(g_Mutex);
-        g_MemoryCache.clear();
-        g_GlobalSession.setNull();
-        slang::shutdown();
+        JobSystem::Wait(g_CompileJobs);
+        {
+            std::lock_guard<std::mutex> lock(g_Mutex);
+            g_MemoryCache.clear();
+            g_InFlight.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_DependencyMutex);
+            g_FileHashes.clear();
+            g_Dependencies.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_ArchiveMutex);
+            g_Archive.Close();
+            g_ArchiveOpened = false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_SessionMutex);
+            g_IdleSlangSessions.clear();
+            g_IdleSlangSessionCount = 0;
+            g_IdleGlobalSessions.clear();
+        }
+        if (!g_PrecompiledOnly) {
+            slang::shutdown();
+        }
     }
 
 } // namespace Nova::Core::Renderer::RHI
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "Renderer/RHI/RHI_ShaderPermutation.h"
+
+#include <regex>
+#include <sstream>
+
+namespace Nova::Core::Renderer::RHI {
+
+    static constexpr std::string_view kKeywordsDirective = "@keywords";
+
+    RHI_ShaderKeywordSet RHI_ShaderKeywordSet::ParseSource(std::string_view source) {
+        RHI_ShaderKeywordSet set;
+
+        // Compile keywords: `// @keywords A B C`
+        size_t lineStart = 0;
+        while (lineStart < source.size()) {
+            size_t lineEnd = source.find('\n', lineStart);
+            if (lineEnd == std::string_view::npos) lineEnd = source.size();
+            const std::string_view line = source.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+
+            const size_t comment = line.find("//");
+            if (comment == std::string_view::npos) continue;
+            const size_t directive = line.find(kKeywordsDirective, comment);
+            if (directive == std::string_view::npos) continue;
+
+            std::istringstream names(std::string(line.substr(directive + kKeywordsDirective.size())));
+            std::string name;
+            while (names >> name) {
+                set.Add(RHI_ShaderKeyword{ name, RHI_ShaderKeywordKind::Compile, 0 });
+            }
+        }
+
+        // Specialization keywords: `[vk::constant_id(N)] const bool NAME`
+        static const std::regex kSpecConstant(
+            R"(\[\s*vk::constant_id\s*\(\s*(\d+)\s*\)\s*\]\s*const\s+bool\s+([A-Za-z_][A-Za-z0-9_]*))");
+        const std::string text(source);
+        for (auto it = std::sregex_iterator(text.begin(), text.end(), kSpecConstant); it != std::sregex_iterator(); ++it) {
+            const auto& match = *it;
+            set.Add(RHI_ShaderKeyword{
+                match[2].str(),
+                RHI_ShaderKeywordKind::Specialization,
+                static_cast<uint32_t>(std::stoul(match[1].str()))
+            });
+        }
+
+        return set;
+    }
+
+    bool RHI_ShaderKeywordSet::Add(const RHI_ShaderKeyword& keyword) {
+        if (Find(keyword.m_Name) >= 0) return true;
+        if (m_Keywords.size() >= kMaxShaderKeywords) return false;
+        m_Keywords.push_back(keyword);
+        return true;
+    }
+
+    void RHI_ShaderKeywordSet::Merge(const RHI_ShaderKeywordSet& other) {
+        for (const auto& k : other.m_Keywords) {
+            Add(k);
+        }
+    }
+
+    int RHI_ShaderKeywordSet::Find(std::string_view name) const {
+        for (size_t i = 0; i < m_Keywords.size(); ++i) {
+            if (m_Keywords[i].m_Name == name) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    RHI_ShaderVariantMask RHI_ShaderKeywordSet::GetBit(std::string_view name) const {
+        const int index = Find(name);
+        return (index < 0) ? 0 : (RHI_ShaderVariantMask{ 1 } << index);
+    }
+
+    RHI_ShaderVariantMask RHI_ShaderKeywordSet::GetCompileMask() const {
+        RHI_ShaderVariantMask mask = 0;
+        for (size_t i = 0; i < m_Keywords.size(); ++i) {
+            if (m_Keywords[i].m_Kind == RHI_ShaderKeywordKind::Compile)
+                mask |= RHI_ShaderVariantMask{ 1 } << i;
+        }
+        return mask;
+    }
+
+    RHI_ShaderVariantMask RHI_ShaderKeywordSet::GetSpecializationMask() const {
+        RHI_ShaderVariantMask mask = 0;
+        for (size_t i = 0; i < m_Keywords.size(); ++i) {
+            if (m_Keywords[i].m_Kind == RHI_ShaderKeywordKind::Specialization)
+                mask |= RHI_ShaderVariantMask{ 1 } << i;
+        }
+        return mask;
+    }
+
+    RHI_ShaderVariantMask RHI_ShaderKeywordSet::Translate(RHI_ShaderVariantMask mask, const RHI_ShaderKeywordSet& from) const {
+        if (&from == this) return mask;
+
+        RHI_ShaderVariantMask out = 0;
+        for (size_t i = 0; i < from.m_Keywords.size(); ++i) {
+            if ((mask & (RHI_ShaderVariantMask{ 1 } << i)) == 0) continue;
+            out |= GetBit(from.m_Keywords[i].m_Name);
+        }
+        return out;
+    }
+
+    void RHI_ShaderKeywordSet::AppendDefines(RHI_ShaderVariantMask mask,
+        std::vector<std::pair<std::string, std::string>>& defines) const
+    {
+        for (size_t i = 0; i < m_Keywords.size(); ++i) {
+            const auto& k = m_Keywords[i];
+            if (k.m_Kind != RHI_ShaderKeywordKind::Compile) continue;
+            const bool enabled = (mask & (RHI_ShaderVariantMask{ 1 } << i)) != 0;
+            defines.emplace_back(k.m_Name, enabled ? "1" : "0");
+        }
+    }
+
+} // namespace Nova::Core::Renderer::RHI
@@ -34,4 +34,49 @@ namespace Nova::Core::Renderer::RHI {
         m_Parameters[name] = value;
     }
 
+    void RHI_Shaders::SetMaterial(const Material& material) {
+        SetParameter("base",                 material.m_Base);
+        SetParameter("baseColor",            material.m_BaseColor);
+        SetParameter("diffuseRoughness",     material.m_DiffuseRoughness);
+        SetParameter("metalness",            material.m_Metalness);
+        SetParameter("metalColor",           material.m_MetalColor);
+        SetParameter("specular",             material.m_Specular);
+        SetParameter("specularColor",        material.m_SpecularColor);
+        SetParameter("specularRoughness",    material.m_SpecularRoughness);
+        SetParameter("specularIOR",          material.m_SpecularIOR);
+        SetParameter("specularAnisotropy",   material.m_SpecularAnisotropy);
+        SetParameter("specularRotation",     material.m_SpecularRotation);
+        SetParameter("transmission",         material.m_Transmission);
+        SetParameter("transmissionColor",    material.m_TransmissionColor);
+        SetParameter("subsurface",           material.m_Subsurface);
+        SetParameter("subsurfaceColor",      material.m_SubsurfaceColor);
+        SetParameter("subsurfaceRadius",     material.m_SubsurfaceRadius);
+        SetParameter("subsurfaceScale",      material.m_SubsurfaceScale);
+        SetParameter("subsurfaceAnisotropy", material.m_SubsurfaceAnisotropy);
+        SetParameter("sheen",                material.m_Sheen);
+        SetParameter("sheenColor",           material.m_SheenColor);
+        SetParameter("sheenRoughness",       material.m_SheenRoughness);
+        SetParameter("coat",                 material.m_Coat);
+        SetParameter("coatColor",            material.m_CoatColor);
+        SetParameter("coatRoughness",        material.m_CoatRoughness);
+        SetParameter("coatAnisotropy",       material.m_CoatAnisotropy);
+        SetParameter("coatRotation",         material.m_CoatRotation);
+        SetParameter("coatIOR",              material.m_CoatIOR);
+        SetParameter("coatAffectColor",      material.m_CoatAffectColor);
+        SetParameter("coatAffectRoughness",  material.m_CoatAffectRoughness);
+        SetParameter("emission",             material.m_Emission);
+        SetParameter("emissionColor",        material.m_EmissionColor);
+        SetParameter("opacity",              material.m_Opacity);
+        SetParameter("thinWalled",           material.m_ThinWalled);
+        SetParameter("isOpaque",             material.m_IsOpaque);
+        SetParameter("baseColorTexture",     static_cast<int>(material.m_BaseColorTexture));
+        SetParameter("dataBuffer",           static_cast<int>(material.m_DataBuffer));
+    }
+
+    void RHI_Shaders::SetKeyword(std::string_view name, bool enabled) {
+        const RHI_ShaderVariantMask bit = m_Keywords.GetBit(name);
+        if (enabled) m_KeywordMask |= bit;
+        else         m_KeywordMask &= ~bit;
+    }
+
 } // namespace Nova::Core::Renderer::RHI
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "Scene/ECS/Systems/RenderExtractionSystem.h"
+
+#include "Asset/Assets/MeshAsset.h"
+#include "Renderer/Graphics/RenderScene.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+#include "Scene/ECS/Components/WorldTransformComponent.h"
+
+namespace Nova::Core::Scene::ECS::Systems {
+
+	using Renderer::Graphics::RenderProxy;
+	using Renderer::Graphics::RenderScene;
+
+	void RenderExtractionSystem::Extract(entt::registry& registry, RenderScene& out) {
+		out.Clear();
+		m_MeshIndices.clear();
+		m_MaterialIndices.clear();
+
+		auto view = registry.view<const Components::MeshRendererComponent, const Components::WorldTransformComponent>();
+		out.m_Proxies.reserve(view.size_hint());
+
+		for (auto [entity, renderer, transform] : view.each()) {
+			const Asset::Assets::MeshAsset* mesh = renderer.m_MeshAsset.get();
+			if (!mesh || !mesh->IsLoaded())
+				continue;
+
+			auto [meshIt, newMesh] = m_MeshIndices.try_emplace(mesh, static_cast<uint32_t>(out.m_Meshes.size()));
+			if (newMesh) {
+				Renderer::RHI::RHI_DrawIndexedCommand cmd;
+				cmd.m_Mesh = mesh->GetCPUMesh();
+				cmd.m_IndexCount = static_cast<uint32_t>(cmd.m_Mesh->GetIndices().size());
+				out.m_Meshes.push_back(std::move(cmd));
+			}
+			const uint32_t meshIndex = meshIt->second;
+
+			// Materials are values, so identical ones are merged by content; a hash collision only costs a duplicate.
+			const Renderer::RHI::Material& material = renderer.m_Material;
+			const uint64_t materialHash = Renderer::RHI::HashMaterial(material);
+			auto [materialIt, newMaterial] = m_MaterialIndices.try_emplace(materialHash, static_cast<uint32_t>(out.m_Materials.size()));
+			uint32_t materialIndex = materialIt->second;
+			if (newMaterial) {
+				out.m_Materials.push_back(material);
+			}
+			else if (out.m_Materials[materialIndex] != material) {
+				materialIndex = static_cast<uint32_t>(out.m_Materials.size());
+				out.m_Materials.push_back(material);
+			}
+
+			RenderProxy& proxy = out.m_Proxies.emplace_back();
+			proxy.m_World = transform.m_World;
+			proxy.m_Normal = transform.m_Normal;
+
+			// Conservative under non-uniform scale: the sphere grows by the largest axis scale.
+			const glm::vec4& local = mesh->GetBoundingSphere();
+			const glm::vec3 center(transform.m_World * glm::vec4(glm::vec3(local), 1.0f));
+			const float scale = glm::sqrt(glm::max(glm::dot(glm::vec3(transform.m_World[0]), glm::vec3(transform.m_World[0])),
+				glm::max(glm::dot(glm::vec3(transform.m_World[1]), glm::vec3(transform.m_World[1])),
+					glm::dot(glm::vec3(transform.m_World[2]), glm::vec3(transform.m_World[2])))));
+			proxy.m_BoundingSphere = glm::vec4(center, local.w * scale);
+
+			proxy.m_Mesh = meshIndex;
+			proxy.m_Material = materialIndex;
+			proxy.m_SortKey = (material.m_IsOpaque ? 0 : RenderScene::kTranslucentBit) |
+				((static_cast<uint64_t>(materialIndex) & 0xFFFFFF) << 24) |
+				(static_cast<uint64_t>(meshIndex) & 0xFFFFFF);
+		}
+	}
+
+} // namespace Nova::Core::Scene::ECS::Systems
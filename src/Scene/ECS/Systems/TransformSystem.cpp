@@ -0,0 +1,399 @@
+#include "Scene/ECS/Systems/TransformSystem.h"
+
+#include <algorithm>
+
+#include "Core/JobSystem.h"
+#include "Scene/ECS/Components/HierarchyComponent.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/TransformDirtyComponent.h"
+#include "Scene/ECS/Components/WorldTransformComponent.h"
+
+#if defined(__AVX2__)
+#define NV_TRANSFORM_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NV_TRANSFORM_SSE 1
+#endif
+#if defined(NV_TRANSFORM_AVX2) || defined(NV_TRANSFORM_SSE)
+#include <immintrin.h>
+#endif
+
+namespace Nova::Core::Scene::ECS::Systems {
+
+	using Components::HierarchyComponent;
+	using Components::TransformComponent;
+	using Components::TransformDirtyComponent;
+	using Components::WorldTransformComponent;
+
+	// Entities per parallel-for chunk; levels smaller than this run on the calling thread.
+	static constexpr size_t kParallelGrain = 1024;
+
+	// --- SIMD kernels over the SoA scratch ---
+
+	struct AffineView {
+		float* m_E[12];
+	};
+
+	struct TRSView {
+		const float* m_T[3];
+		const float* m_Q[4];
+		const float* m_S[3];
+		const uint32_t* m_Mask;
+	};
+
+	struct ScalarOps {
+		using V = float;
+		static V Load(const float* p) { return *p; }
+		static void Store(float* p, V v) { *p = v; }
+		static V Set(float f) { return f; }
+		static V Add(V a, V b) { return a + b; }
+		static V Sub(V a, V b) { return a - b; }
+		static V Mul(V a, V b) { return a * b; }
+		static V Select(const uint32_t* mask, V a, V b) { return *mask ? a : b; }
+	};
+
+#if defined(NV_TRANSFORM_SSE)
+	struct SseOps {
+		using V = __m128;
+		static V Load(const float* p) { return _mm_loadu_ps(p); }
+		static void Store(float* p, V v) { _mm_storeu_ps(p, v); }
+		static V Set(float f) { return _mm_set1_ps(f); }
+		static V Add(V a, V b) { return _mm_add_ps(a, b); }
+		static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+		static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+		static V Select(const uint32_t* mask, V a, V b) {
+			const V m = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask)));
+			return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+		}
+	};
+#endif
+
+#if defined(NV_TRANSFORM_AVX2)
+	struct Avx2Ops {
+		using V = __m256;
+		static V Load(const float* p) { return _mm256_loadu_ps(p); }
+		static void Store(float* p, V v) { _mm256_storeu_ps(p, v); }
+		static V Set(float f) { return _mm256_set1_ps(f); }
+		static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+		static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+		static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+		static V Select(const uint32_t* mask, V a, V b) {
+			const V m = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask)));
+			return _mm256_blendv_ps(b, a, m);
+		}
+	};
+#endif
+
+	// local = T * R(q) * S for the masked lanes; the other lanes keep their cached matrix.
+	template<typename Ops>
+	static void ComposeLocalBatch(const TRSView& trs, const AffineView& local, size_t i) {
+		using V = typename Ops::V;
+		const V qx = Ops::Load(trs.m_Q[0] + i);
+		const V qy = Ops::Load(trs.m_Q[1] + i);
+		const V qz = Ops::Load(trs.m_Q[2] + i);
+		const V qw = Ops::Load(trs.m_Q[3] + i);
+
+		const V one = Ops::Set(1.0f);
+		const V two = Ops::Set(2.0f);
+		const V x2 = Ops::Mul(qx, two);
+		const V y2 = Ops::Mul(qy, two);
+		const V z2 = Ops::Mul(qz, two);
+		const V xx = Ops::Mul(qx, x2), yy = Ops::Mul(qy, y2), zz = Ops::Mul(qz, z2);
+		const V xy = Ops::Mul(qx, y2), xz = Ops::Mul(qx, z2), yz = Ops::Mul(qy, z2);
+		const V wx = Ops::Mul(qw, x2), wy = Ops::Mul(qw, y2), wz = Ops::Mul(qw, z2);
+
+		const V sx = Ops::Load(trs.m_S[0] + i);
+		const V sy = Ops::Load(trs.m_S[1] + i);
+		const V sz = Ops::Load(trs.m_S[2] + i);
+
+		const V out[12] = {
+			Ops::Mul(Ops::Sub(one, Ops::Add(yy, zz)), sx), Ops::Mul(Ops::Sub(xy, wz), sy), Ops::Mul(Ops::Add(xz, wy), sz), Ops::Load(trs.m_T[0] + i),
+			Ops::Mul(Ops::Add(xy, wz), sx), Ops::Mul(Ops::Sub(one, Ops::Add(xx, zz)), sy), Ops::Mul(Ops::Sub(yz, wx), sz), Ops::Load(trs.m_T[1] + i),
+			Ops::Mul(Ops::Sub(xz, wy), sx), Ops::Mul(Ops::Add(yz, wx), sy), Ops::Mul(Ops::Sub(one, Ops::Add(xx, yy)), sz), Ops::Load(trs.m_T[2] + i),
+		};
+
+		const uint32_t* mask = trs.m_Mask + i;
+		for (int k = 0; k < 12; ++k)
+			Ops::Store(local.m_E[k] + i, Ops::Select(mask, out[k], Ops::Load(local.m_E[k] + i)));
+	}
+
+	// world = parent * local, both affine.
+	template<typename Ops>
+	static void MultiplyAffineBatch(const AffineView& parent, const AffineView& local, const AffineView& world, size_t i) {
+		using V = typename Ops::V;
+		V a[12];
+		V b[12];
+		for (int k = 0; k < 12; ++k) {
+			a[k] = Ops::Load(parent.m_E[k] + i);
+			b[k] = Ops::Load(local.m_E[k] + i);
+		}
+
+		for (int r = 0; r < 3; ++r) {
+			for (int c = 0; c < 4; ++c) {
+				V v = Ops::Add(Ops::Add(
+					Ops::Mul(a[r * 4 + 0], b[0 * 4 + c]),
+					Ops::Mul(a[r * 4 + 1], b[1 * 4 + c])),
+					Ops::Mul(a[r * 4 + 2], b[2 * 4 + c]));
+				if (c == 3) v = Ops::Add(v, a[r * 4 + 3]);
+				Ops::Store(world.m_E[r * 4 + c] + i, v);
+			}
+		}
+	}
+
+	static void ComposeLocalRange(const TRSView& trs, const AffineView& local, size_t begin, size_t end) {
+		size_t i = begin;
+#if defined(NV_TRANSFORM_AVX2)
+		for (; i + 8 <= end; i += 8) ComposeLocalBatch<Avx2Ops>(trs, local, i);
+#endif
+#if defined(NV_TRANSFORM_SSE)
+		for (; i + 4 <= end; i += 4) ComposeLocalBatch<SseOps>(trs, local, i);
+#endif
+		for (; i < end; ++i) ComposeLocalBatch<ScalarOps>(trs, local, i);
+	}
+
+	static void MultiplyAffineRange(const AffineView& parent, const AffineView& local, const AffineView& world, size_t begin, size_t end) {
+		size_t i = begin;
+#if defined(NV_TRANSFORM_AVX2)
+		for (; i + 8 <= end; i += 8) MultiplyAffineBatch<Avx2Ops>(parent, local, world, i);
+#endif
+#if defined(NV_TRANSFORM_SSE)
+		for (; i + 4 <= end; i += 4) MultiplyAffineBatch<SseOps>(parent, local, world, i);
+#endif
+		for (; i < end; ++i) MultiplyAffineBatch<ScalarOps>(parent, local, world, i);
+	}
+
+	static void StoreAffine(const AffineView& soa, size_t i, const glm::mat4& m) {
+		for (int r = 0; r < 3; ++r)
+			for (int c = 0; c < 4; ++c)
+				soa.m_E[r * 4 + c][i] = m[c][r];
+	}
+
+	static glm::mat4 LoadAffine(const AffineView& soa, size_t i) {
+		glm::mat4 m(1.0f);
+		for (int r = 0; r < 3; ++r)
+			for (int c = 0; c < 4; ++c)
+				m[c][r] = soa.m_E[r * 4 + c][i];
+		return m;
+	}
+
+	// --- TransformSystem ---
+
+	void TransformSystem::AffineSoA::Resize(size_t count) {
+		for (auto& e : m_Elements) e.resize(count);
+	}
+
+	void TransformSystem::LocalSoA::Resize(size_t count) {
+		for (auto& e : m_Translation) e.resize(count);
+		for (auto& e : m_Rotation) e.resize(count);
+		for (auto& e : m_Scale) e.resize(count);
+		m_DirtyMask.resize(count);
+	}
+
+	void TransformSystem::Connect(entt::registry& registry) {
+		registry.on_construct<TransformComponent>().connect<&TransformSystem::MarkDirty>();
+		registry.on_update<TransformComponent>().connect<&TransformSystem::MarkDirty>();
+	}
+
+	void TransformSystem::MarkDirty(entt::registry& registry, entt::entity entity) {
+		registry.emplace_or_replace<TransformDirtyComponent>(entity);
+	}
+
+	void TransformSystem::Update(entt::registry& registry) {
+		m_Roots.clear();
+		m_Collected.clear();
+		m_Queue.clear();
+
+		auto& dirty = registry.storage<TransformDirtyComponent>();
+		if (dirty.empty())
+			return;
+
+		// Keep only the topmost dirty entities: the subtree walk below reaches the others anyway.
+		for (entt::entity entity : dirty) {
+			bool coveredByAncestor = false;
+			if (const auto* node = registry.try_get<HierarchyComponent>(entity)) {
+				for (entt::entity parent = node->m_Parent; parent != entt::null;
+					parent = registry.get<HierarchyComponent>(parent).m_Parent)
+				{
+					if (dirty.contains(parent)) {
+						coveredByAncestor = true;
+						break;
+					}
+				}
+			}
+			if (!coveredByAncestor)
+				m_Roots.push_back(entity);
+		}
+
+		for (entt::entity root : m_Roots)
+			CollectSubtree(registry, root);
+
+		SortByDepth();
+
+		// Structural changes first: the parallel passes below only read and write existing components.
+		for (const Entry& entry : m_Queue) {
+			if (!registry.all_of<WorldTransformComponent>(entry.m_Entity))
+				registry.emplace<WorldTransformComponent>(entry.m_Entity);
+		}
+
+		const size_t count = m_Queue.size();
+		m_TRS.Resize(count);
+		m_Local.Resize(count);
+		m_ParentWorld.Resize(count);
+		m_World.Resize(count);
+		m_Targets.resize(count);
+
+		auto view = [](AffineSoA& soa) {
+			AffineView v{};
+			for (int k = 0; k < 12; ++k) v.m_E[k] = soa.m_Elements[k].data();
+			return v;
+		};
+		const AffineView local = view(m_Local);
+		const AffineView parentWorld = view(m_ParentWorld);
+		const AffineView world = view(m_World);
+
+		TRSView trs{};
+		for (int k = 0; k < 3; ++k) trs.m_T[k] = m_TRS.m_Translation[k].data();
+		for (int k = 0; k < 4; ++k) trs.m_Q[k] = m_TRS.m_Rotation[k].data();
+		for (int k = 0; k < 3; ++k) trs.m_S[k] = m_TRS.m_Scale[k].data();
+		trs.m_Mask = m_TRS.m_DirtyMask.data();
+
+		const auto& transforms = registry.storage<TransformComponent>();
+		const auto& hierarchy = registry.storage<HierarchyComponent>();
+		auto& worlds = registry.storage<WorldTransformComponent>();
+
+		// Gather into SoA: TRS for changed locals, cached matrices otherwise, and the world of parents
+		// that are not part of this update.
+		JobSystem::ParallelFor(count, kParallelGrain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				const Entry& entry = m_Queue[i];
+				m_Targets[i] = &worlds.get(entry.m_Entity);
+
+				if (entry.m_LocalDirty) {
+					glm::vec3 t(0.0f), s(1.0f);
+					glm::quat q(1.0f, 0.0f, 0.0f, 0.0f);
+					if (transforms.contains(entry.m_Entity)) {
+						const auto& transform = transforms.get(entry.m_Entity);
+						t = transform.m_Translation;
+						q = glm::quat(transform.m_Rotation);
+						s = transform.m_Scale;
+					}
+					for (int k = 0; k < 3; ++k) {
+						m_TRS.m_Translation[k][i] = t[k];
+						m_TRS.m_Scale[k][i] = s[k];
+					}
+					m_TRS.m_Rotation[0][i] = q.x;
+					m_TRS.m_Rotation[1][i] = q.y;
+					m_TRS.m_Rotation[2][i] = q.z;
+					m_TRS.m_Rotation[3][i] = q.w;
+					m_TRS.m_DirtyMask[i] = ~0u;
+				}
+				else {
+					m_TRS.m_DirtyMask[i] = 0u;
+					StoreAffine(local, i, m_Targets[i]->m_Local);
+				}
+
+				if (entry.m_Parent == kExternalParent) {
+					const entt::entity parent = hierarchy.contains(entry.m_Entity)
+						? hierarchy.get(entry.m_Entity).m_Parent : entt::null;
+					const bool hasParentWorld = parent != entt::null && worlds.contains(parent);
+					StoreAffine(parentWorld, i, hasParentWorld ? worlds.get(parent).m_World : glm::mat4(1.0f));
+				}
+			}
+		}, "Transform gather");
+
+		JobSystem::ParallelFor(count, kParallelGrain, [&](size_t begin, size_t end) {
+			ComposeLocalRange(trs, local, begin, end);
+		}, "Transform compose");
+
+		// One level at a time: every parent inside the queue belongs to an earlier, finished level.
+		for (size_t level = 0; level + 1 < m_Levels.size(); ++level) {
+			const size_t levelBegin = m_Levels[level];
+			const size_t levelEnd = m_Levels[level + 1];
+			JobSystem::ParallelFor(levelEnd - levelBegin, kParallelGrain, [&](size_t begin, size_t end) {
+				begin += levelBegin;
+				end += levelBegin;
+				for (size_t i = begin; i < end; ++i) {
+					const uint32_t parent = m_Queue[i].m_Parent;
+					if (parent == kExternalParent) continue;
+					for (int k = 0; k < 12; ++k)
+						parentWorld.m_E[k][i] = world.m_E[k][parent];
+				}
+				MultiplyAffineRange(parentWorld, local, world, begin, end);
+			}, "Transform level");
+		}
+
+		JobSystem::ParallelFor(count, kParallelGrain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				if (m_TRS.m_DirtyMask[i])
+					m_Targets[i]->m_Local = LoadAffine(local, i);
+				m_Targets[i]->SetWorld(LoadAffine(world, i));
+			}
+		}, "Transform scatter");
+
+		registry.clear<TransformDirtyComponent>();
+	}
+
+	void TransformSystem::CollectSubtree(entt::registry& registry, entt::entity root) {
+		const auto* rootNode = registry.try_get<HierarchyComponent>(root);
+		const uint32_t rootIndex = static_cast<uint32_t>(m_Collected.size());
+		m_Collected.push_back({ root, rootNode ? rootNode->m_Depth : 0, kExternalParent, true });
+		if (!rootNode)
+			return;
+
+		// Pre-order walk over the sibling links, tracking each entry's parent index.
+		entt::entity current = root;
+		uint32_t currentIndex = rootIndex;
+		while (true) {
+			const auto& node = registry.get<HierarchyComponent>(current);
+			entt::entity next = node.m_FirstChild;
+			uint32_t parentIndex = currentIndex;
+
+			if (next == entt::null) {
+				while (current != root && registry.get<HierarchyComponent>(current).m_NextSibling == entt::null) {
+					current = registry.get<HierarchyComponent>(current).m_Parent;
+					currentIndex = m_Collected[currentIndex].m_Parent;
+				}
+				if (current == root)
+					return;
+
+				next = registry.get<HierarchyComponent>(current).m_NextSibling;
+				parentIndex = m_Collected[currentIndex].m_Parent;
+			}
+
+			current = next;
+			currentIndex = static_cast<uint32_t>(m_Collected.size());
+			m_Collected.push_back({ current, registry.get<HierarchyComponent>(current).m_Depth, parentIndex,
+				registry.all_of<TransformDirtyComponent>(current) });
+		}
+	}
+
+	void TransformSystem::SortByDepth() {
+		// Counting sort: stable, linear, and yields the level boundaries for free.
+		uint32_t minDepth = UINT32_MAX;
+		uint32_t maxDepth = 0;
+		for (const Entry& entry : m_Collected) {
+			minDepth = std::min(minDepth, entry.m_Depth);
+			maxDepth = std::max(maxDepth, entry.m_Depth);
+		}
+
+		m_Levels.assign(static_cast<size_t>(maxDepth - minDepth) + 2, 0);
+		for (const Entry& entry : m_Collected)
+			++m_Levels[entry.m_Depth - minDepth + 1];
+		for (size_t level = 1; level < m_Levels.size(); ++level)
+			m_Levels[level] += m_Levels[level - 1];
+
+		std::vector<uint32_t> cursor(m_Levels.begin(), m_Levels.end() - 1);
+		m_Remap.resize(m_Collected.size());
+		m_Queue.resize(m_Collected.size());
+		for (size_t i = 0; i < m_Collected.size(); ++i) {
+			const uint32_t slot = cursor[m_Collected[i].m_Depth - minDepth]++;
+			m_Remap[i] = slot;
+			m_Queue[slot] = m_Collected[i];
+		}
+		for (Entry& entry : m_Queue) {
+			if (entry.m_Parent != kExternalParent)
+				entry.m_Parent = m_Remap[entry.m_Parent];
+		}
+	}
+
+} // namespace Nova::Core::Scene::ECS::Systems
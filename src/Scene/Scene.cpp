@@ -1,33 +1,43 @@
 #include "Scene/Scene.h"
 
+#include <iterator>
+#include <utility>
+
+#include "Asset/AssetManager.h"
+#include "Scene/SceneFile.h"
 #include "Scene/ECS/Components/IDComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
 #include "Scene/ECS/Components/NameComponent.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+#include "Scene/ECS/Components/TransformDirtyComponent.h"
 #include "Scene/ECS/Components/WorldTransformComponent.h"
 
 namespace Nova::Core::Scene {
 
+	using ECS::Components::HierarchyComponent;
+
 	Scene::Scene(const std::string& sceneName) {
 		m_Name = sceneName;
 
-		m_Root = m_Registry.create();
-
-		m_Registry.emplace<ECS::Components::NameComponent>(m_Root, "Root");
-		m_Registry.emplace<ECS::Components::WorldTransformComponent>(m_Root);
-
-		m_Nodes.emplace(m_Root, Node{ entt::null, {} });
+		ECS::Systems::TransformSystem::Connect(m_Registry);
+		CreateRoot();
 	}
 
 	void Scene::Clear() {
 		m_Registry.clear();
 		m_EntityMap.clear();
-		m_Nodes.clear();
 		m_MainCamera = entt::null;
 
 		// Recreate the root entity.
+		CreateRoot();
+	}
+
+	void Scene::CreateRoot() {
 		m_Root = m_Registry.create();
 		m_Registry.emplace<ECS::Components::NameComponent>(m_Root, "Root");
 		m_Registry.emplace<ECS::Components::WorldTransformComponent>(m_Root);
-		m_Nodes.emplace(m_Root, Node{ entt::null, {} });
+		m_Registry.emplace<HierarchyComponent>(m_Root);
+		m_HierarchyDirty = true;
 	}
 
 	entt::entity Scene::CreateEntity(const std::string& name) {
@@ -38,10 +48,13 @@ namespace Nova::Core::Scene {
 	entt::entity Scene::CreateEntity(UUID id, const std::string& name) {
 		entt::entity entity = m_Registry.create();
 		m_Registry.emplace<ECS::Components::IDComponent>(entity, id);
-		m_Registry.emplace<ECS::Components::NameComponent>(entity, name.empty() ? "Entity" : name);
+		if (name.empty())
+			m_Registry.emplace<ECS::Components::NameComponent>(entity, InternedString("Entity"));
+		else
+			m_Registry.emplace<ECS::Components::NameComponent>(entity, name);
 
 		m_Registry.emplace<ECS::Components::WorldTransformComponent>(entity);
-		
+
 		m_EntityMap[id] = entity;
 
 		EnsureNode(entity);
@@ -49,29 +62,271 @@ namespace Nova::Core::Scene {
 		return entity;
 	}
 
-	void Scene::DestroyEntity(entt::entity entity) {
-		if (!IsValidEntity(entity))
-			return;
+	std::vector<entt::entity> Scene::CreateEntities(size_t count, std::string_view name, entt::entity parent) {
+		std::vector<entt::entity> entities(count);
+		if (count == 0)
+			return entities;
 
-		if (entity == m_Root)
-			return;
+		if (parent == entt::null || !IsValidEntity(parent))
+			parent = m_Root;
+		EnsureNode(parent);
+
+		m_Registry.create(entities.begin(), entities.end());
+
+		std::vector<ECS::Components::IDComponent> ids(count);
+		for (auto& id : ids)
+			id.m_ID = GenerateUUID();
+
+		// Children are appended after the parent's current last child, linked to their neighbours in the batch.
+		const auto& parentNode = m_Registry.get<HierarchyComponent>(parent);
+		std::vector<HierarchyComponent> nodes(count);
+		for (size_t i = 0; i < count; ++i) {
+			nodes[i].m_Parent = parent;
+			nodes[i].m_PrevSibling = (i == 0) ? parentNode.m_LastChild : entities[i - 1];
+			nodes[i].m_NextSibling = (i + 1 < count) ? entities[i + 1] : entt::null;
+			nodes[i].m_Depth = parentNode.m_Depth + 1;
+		}
 
-		auto itNode = m_Nodes.find(entity);
-		if (itNode != m_Nodes.end()) {
-			auto childrenCopy = itNode->second.m_Children;
-			for (auto child : childrenCopy) {
-				DestroyEntity(child);
+		auto reserve = [count](auto& storage) { storage.reserve(storage.size() + count); };
+		reserve(m_Registry.storage<ECS::Components::IDComponent>());
+		reserve(m_Registry.storage<ECS::Components::NameComponent>());
+		reserve(m_Registry.storage<ECS::Components::WorldTransformComponent>());
+		reserve(m_Registry.storage<HierarchyComponent>());
+
+		m_Registry.insert<ECS::Components::IDComponent>(entities.begin(), entities.end(), ids.begin());
+		m_Registry.insert<ECS::Components::NameComponent>(entities.begin(), entities.end(),
+			ECS::Components::NameComponent(InternedString(name.empty() ? std::string_view("Entity") : name)));
+		m_Registry.insert<ECS::Components::WorldTransformComponent>(entities.begin(), entities.end());
+		m_Registry.insert<HierarchyComponent>(entities.begin(), entities.end(), nodes.begin());
+
+		// The pool may have grown: look the parent up again.
+		auto& parentLinks = m_Registry.get<HierarchyComponent>(parent);
+		if (parentLinks.m_LastChild != entt::null)
+			m_Registry.get<HierarchyComponent>(parentLinks.m_LastChild).m_NextSibling = entities.front();
+		else
+			parentLinks.m_FirstChild = entities.front();
+		parentLinks.m_LastChild = entities.back();
+		parentLinks.m_ChildCount += static_cast<uint32_t>(count);
+
+		// Under a non-root parent even transform-less entities inherit a non-identity world.
+		if (parent != m_Root)
+			m_Registry.insert<ECS::Components::TransformDirtyComponent>(entities.begin(), entities.end());
+
+		m_EntityMap.reserve(m_EntityMap.size() + count);
+		for (size_t i = 0; i < count; ++i)
+			m_EntityMap[ids[i].m_ID] = entities[i];
+
+		m_HierarchyDirty = true;
+		return entities;
+	}
+
+	bool Scene::Serialize(const std::filesystem::path& path) const {
+		return SceneFile::Write(path, *this);
+	}
+
+	bool Scene::Deserialize(const std::filesystem::path& path) {
+		SceneFile file;
+		if (!file.Open(path))
+			return false;
+
+		Clear();
+		Instantiate(file, m_Root);
+		return true;
+	}
+
+	std::vector<entt::entity> Scene::Instantiate(const SceneFile& file, entt::entity parent) {
+		const size_t count = file.GetEntityCount();
+		std::vector<entt::entity> entities(count);
+		if (count == 0)
+			return entities;
+
+		if (parent == entt::null || !IsValidEntity(parent))
+			parent = m_Root;
+		EnsureNode(parent);
+
+		m_Registry.create(entities.begin(), entities.end());
+
+		const auto uuids = file.GetUUIDs();
+		std::vector<ECS::Components::IDComponent> ids(count);
+		for (size_t i = 0; i < count; ++i) {
+			UUID id = uuids[i];
+			if (id == 0 || m_EntityMap.contains(id))
+				id = GenerateUUID();
+			ids[i].m_ID = id;
+		}
+
+		// Names several entities share are interned once; unique names stay owned, so streaming scenes in and
+		// out does not grow the (never freed) intern pool with one-off text.
+		const auto nameIndices = file.GetNameIndices();
+		std::vector<uint32_t> nameUses(file.GetNameCount(), 0);
+		for (size_t i = 0; i < count; ++i)
+			++nameUses[nameIndices[i]];
+		std::vector<ECS::Components::NameComponent> nameTable(file.GetNameCount());
+		for (uint32_t i = 0; i < file.GetNameCount(); ++i) {
+			const std::string_view name = file.GetName(i);
+			if (name.empty())
+				nameTable[i] = ECS::Components::NameComponent(InternedString("Entity"));
+			else if (nameUses[i] > 1)
+				nameTable[i] = ECS::Components::NameComponent(InternedString(name));
+			else
+				nameTable[i] = ECS::Components::NameComponent(std::string(name));
+		}
+		std::vector<ECS::Components::NameComponent> names(count);
+		for (size_t i = 0; i < count; ++i) {
+			const uint32_t index = nameIndices[i];
+			if (nameUses[index] > 1)
+				names[i] = nameTable[index];
+			else
+				names[i] = std::move(nameTable[index]);
+		}
+
+		// Pre-order file: a parent's node is complete before any of its children is linked to it.
+		constexpr uint32_t kNone = SceneFile::kNoParent;
+		const auto parents = file.GetParents();
+		const auto& attachNode = m_Registry.get<HierarchyComponent>(parent);
+		std::vector<HierarchyComponent> nodes(count);
+		std::vector<uint32_t> lastChild(count, kNone);
+		uint32_t firstTop = kNone;
+		uint32_t lastTop = kNone;
+		uint32_t topCount = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			HierarchyComponent& node = nodes[i];
+			const uint32_t p = parents[i];
+			if (p == kNone) {
+				node.m_Parent = parent;
+				node.m_Depth = attachNode.m_Depth + 1;
+				node.m_PrevSibling = (lastTop == kNone) ? attachNode.m_LastChild : entities[lastTop];
+				if (lastTop != kNone)
+					nodes[lastTop].m_NextSibling = entities[i];
+				else
+					firstTop = i;
+				lastTop = i;
+				++topCount;
+				continue;
+			}
+
+			HierarchyComponent& parentNode = nodes[p];
+			node.m_Parent = entities[p];
+			node.m_Depth = parentNode.m_Depth + 1;
+			if (lastChild[p] != kNone) {
+				nodes[lastChild[p]].m_NextSibling = entities[i];
+				node.m_PrevSibling = entities[lastChild[p]];
+			}
+			else {
+				parentNode.m_FirstChild = entities[i];
 			}
+			lastChild[p] = i;
+			parentNode.m_LastChild = entities[i];
+			++parentNode.m_ChildCount;
 		}
 
-		DetachFromParent(entity);
-		m_Nodes.erase(entity);
+		auto reserve = [count](auto& storage) { storage.reserve(storage.size() + count); };
+		reserve(m_Registry.storage<ECS::Components::IDComponent>());
+		reserve(m_Registry.storage<ECS::Components::NameComponent>());
+		reserve(m_Registry.storage<ECS::Components::WorldTransformComponent>());
+		reserve(m_Registry.storage<HierarchyComponent>());
+
+		m_Registry.insert<ECS::Components::IDComponent>(entities.begin(), entities.end(), ids.begin());
+		m_Registry.insert<ECS::Components::NameComponent>(entities.begin(), entities.end(), std::make_move_iterator(names.begin()));
+		m_Registry.insert<ECS::Components::WorldTransformComponent>(entities.begin(), entities.end());
+		m_Registry.insert<HierarchyComponent>(entities.begin(), entities.end(), nodes.begin());
+
+		if (topCount > 0) {
+			auto& parentLinks = m_Registry.get<HierarchyComponent>(parent);
+			if (parentLinks.m_LastChild != entt::null)
+				m_Registry.get<HierarchyComponent>(parentLinks.m_LastChild).m_NextSibling = entities[firstTop];
+			else
+				parentLinks.m_FirstChild = entities[firstTop];
+			parentLinks.m_LastChild = entities[lastTop];
+			parentLinks.m_ChildCount += topCount;
+		}
 
-		if (auto* id = m_Registry.try_get<ECS::Components::IDComponent>(entity)) {
-			m_EntityMap.erase(id->m_ID);
+		// Under a non-root parent even transform-less entities inherit a non-identity world.
+		if (parent != m_Root) {
+			std::vector<entt::entity> top;
+			top.reserve(topCount);
+			for (uint32_t i = 0; i < count; ++i) {
+				if (parents[i] == kNone) top.push_back(entities[i]);
+			}
+			m_Registry.insert<ECS::Components::TransformDirtyComponent>(top.begin(), top.end());
+		}
+
+		// POD columns go straight from the mapping into the pool.
+		const auto transformIndices = file.GetTransformIndices();
+		if (!transformIndices.empty()) {
+			std::vector<entt::entity> owners(transformIndices.size());
+			for (size_t i = 0; i < owners.size(); ++i)
+				owners[i] = entities[transformIndices[i]];
+			m_Registry.insert<ECS::Components::TransformComponent>(owners.begin(), owners.end(), file.GetTransforms().begin());
 		}
 
-		m_Registry.destroy(entity);
+		const auto rendererIndices = file.GetMeshRendererIndices();
+		if (!rendererIndices.empty()) {
+			// Assets are acquired (not loaded) once per distinct reference.
+			std::vector<std::shared_ptr<Asset::Assets::MeshAsset>> meshes(file.GetMeshAssetCount());
+			for (uint32_t i = 0; i < file.GetMeshAssetCount(); ++i) {
+				meshes[i] = Asset::AssetManager::Get().Acquire<Asset::Assets::MeshAsset>(
+					std::filesystem::path(file.GetMeshAssetPath(i)), file.GetMeshAssetDesc(i)).GetAssetRef();
+			}
+
+			const auto assets = file.GetMeshRendererAssets();
+			const auto materials = file.GetMeshRendererMaterials();
+			std::vector<entt::entity> owners(rendererIndices.size());
+			std::vector<ECS::Components::MeshRendererComponent> renderers(rendererIndices.size());
+			for (size_t i = 0; i < owners.size(); ++i) {
+				owners[i] = entities[rendererIndices[i]];
+				if (assets[i] != SceneFile::kNoAsset)
+					renderers[i].m_MeshAsset = meshes[assets[i]];
+				renderers[i].m_Material = materials[i];
+				// Never trust stored bindless slots: they indexed the heap of the session that wrote the file.
+				renderers[i].m_Material.m_BaseColorTexture = Renderer::RHI::kInvalidBindlessIndex;
+				renderers[i].m_Material.m_DataBuffer = Renderer::RHI::kInvalidBindlessIndex;
+			}
+			m_Registry.insert<ECS::Components::MeshRendererComponent>(owners.begin(), owners.end(), renderers.begin());
+		}
+
+		m_EntityMap.reserve(m_EntityMap.size() + count);
+		for (size_t i = 0; i < count; ++i)
+			m_EntityMap[ids[i].m_ID] = entities[i];
+
+		m_HierarchyDirty = true;
+		return entities;
+	}
+
+	void Scene::DestroyEntity(entt::entity entity) {
+		DestroyEntities(std::span<const entt::entity>(&entity, 1));
+	}
+
+	void Scene::DestroyEntities(std::span<const entt::entity> entities) {
+		std::vector<entt::entity> doomed;
+		doomed.reserve(entities.size());
+
+		for (entt::entity entity : entities) {
+			if (!IsValidEntity(entity) || entity == m_Root)
+				continue;
+
+			EnsureNode(entity);
+			// Already collected: listed twice, or inside a subtree detached earlier in this loop.
+			if (!IsUnderRoot(entity))
+				continue;
+
+			// Only subtree roots are unlinked from a surviving parent; links inside the subtree die with it.
+			DetachFromParent(entity);
+			ForEachInSubtree(entity, [&doomed](entt::entity e) { doomed.push_back(e); });
+		}
+
+		if (doomed.empty())
+			return;
+
+		for (entt::entity entity : doomed) {
+			if (auto* id = m_Registry.try_get<ECS::Components::IDComponent>(entity)) {
+				m_EntityMap.erase(id->m_ID);
+			}
+		}
+
+		m_Registry.destroy(doomed.begin(), doomed.end());
+		// Pools swap-and-pop on removal, which breaks the depth order.
+		m_HierarchyDirty = true;
 	}
 
 	void Scene::DestroyEntity(UUID id) {
@@ -94,52 +349,98 @@ namespace Nova::Core::Scene {
 		return e != entt::null && m_Registry.valid(e);
 	}
 
+	bool Scene::IsUnderRoot(entt::entity e) const {
+		while (e != entt::null && e != m_Root) {
+			const auto* node = m_Registry.try_get<HierarchyComponent>(e);
+			if (!node)
+				return false;
+			e = node->m_Parent;
+		}
+		return e == m_Root;
+	}
+
 	void Scene::EnsureNode(entt::entity e) {
-		if (m_Nodes.find(e) == m_Nodes.end()) {
-			m_Nodes.emplace(e, Node{ m_Root, {} });
-			m_Nodes[m_Root].m_Children.push_back(e);
+		if (!m_Registry.all_of<HierarchyComponent>(e)) {
+			m_Registry.emplace<HierarchyComponent>(e);
+			AttachToParent(e, m_Root);
 		}
 	}
 
 	void Scene::DetachFromParent(entt::entity e) {
-		auto it = m_Nodes.find(e);
-		if (it == m_Nodes.end())
+		auto* node = m_Registry.try_get<HierarchyComponent>(e);
+		if (!node || node->m_Parent == entt::null)
 			return;
 
-		entt::entity parent = it->second.m_Parent;
-		if (parent == entt::null)
-			return;
+		auto& parent = m_Registry.get<HierarchyComponent>(node->m_Parent);
+		if (node->m_PrevSibling != entt::null)
+			m_Registry.get<HierarchyComponent>(node->m_PrevSibling).m_NextSibling = node->m_NextSibling;
+		else
+			parent.m_FirstChild = node->m_NextSibling;
 
-		auto pit = m_Nodes.find(parent);
-		if (pit != m_Nodes.end()) {
-			auto& siblings = pit->second.m_Children;
-			siblings.erase(std::remove(siblings.begin(), siblings.end(), e), siblings.end());
-		}
+		if (node->m_NextSibling != entt::null)
+			m_Registry.get<HierarchyComponent>(node->m_NextSibling).m_PrevSibling = node->m_PrevSibling;
+		else
+			parent.m_LastChild = node->m_PrevSibling;
+
+		--parent.m_ChildCount;
 
-		it->second.m_Parent = entt::null;
+		node->m_Parent = entt::null;
+		node->m_PrevSibling = entt::null;
+		node->m_NextSibling = entt::null;
 	}
 
 	void Scene::AttachToParent(entt::entity e, entt::entity parent) {
 		EnsureNode(parent);
-		auto& node = m_Nodes[e];
+
+		auto& parentNode = m_Registry.get<HierarchyComponent>(parent);
+		auto& node = m_Registry.get<HierarchyComponent>(e);
 		node.m_Parent = parent;
-		m_Nodes[parent].m_Children.push_back(e);
+		node.m_PrevSibling = parentNode.m_LastChild;
+		node.m_NextSibling = entt::null;
+
+		if (parentNode.m_LastChild != entt::null)
+			m_Registry.get<HierarchyComponent>(parentNode.m_LastChild).m_NextSibling = e;
+		else
+			parentNode.m_FirstChild = e;
+		parentNode.m_LastChild = e;
+		++parentNode.m_ChildCount;
+
+		const uint32_t depth = parentNode.m_Depth + 1;
+		if (node.m_Depth != depth || node.m_FirstChild != entt::null)
+			UpdateSubtreeDepth(e, depth);
+		else
+			node.m_Depth = depth;
+
+		m_HierarchyDirty = true;
+	}
+
+	void Scene::UpdateSubtreeDepth(entt::entity e, uint32_t depth) {
+		// Pre-order: a parent's depth is always updated before its children read it.
+		ForEachInSubtree(e, [this, e, depth](entt::entity current) {
+			auto& node = m_Registry.get<HierarchyComponent>(current);
+			node.m_Depth = (current == e) ? depth : m_Registry.get<HierarchyComponent>(node.m_Parent).m_Depth + 1;
+		});
 	}
 
 	bool Scene::WouldCreateCycle(entt::entity child, entt::entity newParent) const {
 		if (child == newParent)
 			return true;
 
+		const auto* childNode = m_Registry.try_get<HierarchyComponent>(child);
+		if (!childNode)
+			return false;
+
+		// Only an entity deeper than `child` can be one of its descendants.
 		entt::entity current = newParent;
 		while (current != entt::null) {
 			if (current == child)
 				return true;
 
-			auto it = m_Nodes.find(current);
-			if (it == m_Nodes.end())
+			const auto* node = m_Registry.try_get<HierarchyComponent>(current);
+			if (!node || node->m_Depth <= childNode->m_Depth)
 				break;
 
-			current = it->second.m_Parent;
+			current = node->m_Parent;
 		}
 		return false;
 	}
@@ -164,30 +465,61 @@ namespace Nova::Core::Scene {
 			return false;
 
 		// Already parented correctly.
-		if (m_Nodes[child].m_Parent == newParent)
+		if (m_Registry.get<HierarchyComponent>(child).m_Parent == newParent)
 			return true;
 
 		DetachFromParent(child);
 		AttachToParent(child, newParent);
+		MarkTransformDirty(child);
 		return true;
 	}
-	
+
 	void Scene::UnparentEntity(entt::entity child) {
 		(void)ParentEntity(child, m_Root);
 	}
 
 	entt::entity Scene::GetParent(entt::entity entity) const {
-		auto it = m_Nodes.find(entity);
-		if (it == m_Nodes.end())
+		const auto* node = m_Registry.try_get<HierarchyComponent>(entity);
+		if (!node)
 			return entt::null;
-		return it->second.m_Parent;
+		return node->m_Parent;
+	}
+
+	std::vector<entt::entity> Scene::GetChildren(entt::entity entity) const {
+		std::vector<entt::entity> children;
+		if (const auto* node = m_Registry.try_get<HierarchyComponent>(entity))
+			children.reserve(node->m_ChildCount);
+		ForEachChild(entity, [&children](entt::entity child) { children.push_back(child); });
+		return children;
 	}
 
-	const std::vector<entt::entity>& Scene::GetChildren(entt::entity entity) const {
-		static const std::vector<entt::entity> s_Empty;
-		auto it = m_Nodes.find(entity);
-		if (it == m_Nodes.end())
-			return s_Empty;
-		return it->second.m_Children;
+	uint32_t Scene::GetDepth(entt::entity entity) const {
+		const auto* node = m_Registry.try_get<HierarchyComponent>(entity);
+		return node ? node->m_Depth : 0;
+	}
+
+	void Scene::UpdateTransforms() {
+		m_TransformSystem.Update(m_Registry);
+	}
+
+	void Scene::ExtractRenderScene(Renderer::Graphics::RenderScene& out) {
+		m_RenderExtractionSystem.Extract(m_Registry, out);
+	}
+
+	void Scene::MarkTransformDirty(entt::entity entity) {
+		if (IsValidEntity(entity))
+			ECS::Systems::TransformSystem::MarkDirty(m_Registry, entity);
+	}
+
+	void Scene::SortHierarchy() {
+		if (!m_HierarchyDirty)
+			return;
+
+		m_Registry.sort<HierarchyComponent>([](const HierarchyComponent& lhs, const HierarchyComponent& rhs) {
+			return lhs.m_Depth < rhs.m_Depth;
+		});
+		m_Registry.sort<ECS::Components::WorldTransformComponent, HierarchyComponent>();
+
+		m_HierarchyDirty = false;
 	}
-}
\ No newline at end of file
+}
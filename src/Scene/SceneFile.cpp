@@ -0,0 +1,323 @@
+#include "Scene/SceneFile.h"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/Log.h"
+#include "Scene/Scene.h"
+#include "Scene/ECS/Components/IDComponent.h"
+#include "Scene/ECS/Components/MeshRendererComponent.h"
+#include "Scene/ECS/Components/NameComponent.h"
+
+namespace Nova::Core::Scene {
+
+	using ECS::Components::TransformComponent;
+	using Renderer::RHI::Material;
+
+	static_assert(std::endian::native == std::endian::little, "The scene format is little-endian");
+	static_assert(std::is_trivially_copyable_v<TransformComponent>, "TransformComponent is stored as raw bytes");
+	static_assert(std::is_trivially_copyable_v<Material>, "Material is stored as raw bytes");
+	static_assert(std::is_trivially_copyable_v<SceneMeshAssetRecord>, "SceneMeshAssetRecord is stored as raw bytes");
+
+	static constexpr uint64_t kChunkAlignment = 16;
+
+	static uint64_t AlignUp(uint64_t v) { return (v + kChunkAlignment - 1) & ~(kChunkAlignment - 1); }
+
+	template<typename T>
+	static bool ChunkSpan(const uint8_t* base, const SceneChunkEntry& chunk, std::span<const T>& out) {
+		if (chunk.m_Size != static_cast<uint64_t>(chunk.m_Count) * sizeof(T))
+			return false;
+		out = std::span<const T>(reinterpret_cast<const T*>(base + chunk.m_Offset), chunk.m_Count);
+		return true;
+	}
+
+	bool SceneFile::Open(const std::filesystem::path& path) {
+		Close();
+
+		if (!m_File.Open(path)) {
+			NV_LOG_WARN(("SceneFile: cannot map " + path.generic_string()).c_str());
+			return false;
+		}
+		if (!Parse()) {
+			NV_LOG_WARN(("SceneFile: invalid or incompatible scene file " + path.generic_string()).c_str());
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void SceneFile::Close() {
+		m_File.Close();
+		*this = SceneFile{};
+	}
+
+	bool SceneFile::Parse() {
+		const uint8_t* data = m_File.GetData();
+		const uint64_t size = m_File.GetSize();
+
+		SceneFileHeader header{};
+		if (size < sizeof(header)) return false;
+		std::memcpy(&header, data, sizeof(header));
+		if (header.m_Magic != kMagic || header.m_Version != kVersion || header.m_FileSize > size)
+			return false;
+
+		const uint64_t tableEnd = sizeof(SceneFileHeader) + static_cast<uint64_t>(header.m_ChunkCount) * sizeof(SceneChunkEntry);
+		if (tableEnd > header.m_FileSize) return false;
+
+		const auto* chunks = reinterpret_cast<const SceneChunkEntry*>(data + sizeof(SceneFileHeader));
+		for (uint32_t i = 0; i < header.m_ChunkCount; ++i) {
+			const SceneChunkEntry& chunk = chunks[i];
+			if (chunk.m_Offset % kChunkAlignment != 0 || chunk.m_Offset < tableEnd ||
+				chunk.m_Offset > header.m_FileSize || chunk.m_Size > header.m_FileSize - chunk.m_Offset)
+				return false;
+
+			bool ok = true;
+			switch (static_cast<SceneChunkType>(chunk.m_Type)) {
+			case SceneChunkType::UUIDs:                 ok = ChunkSpan(data, chunk, m_UUIDs); break;
+			case SceneChunkType::Parents:               ok = ChunkSpan(data, chunk, m_Parents); break;
+			case SceneChunkType::NameIndices:           ok = ChunkSpan(data, chunk, m_NameIndices); break;
+			case SceneChunkType::NameOffsets:           ok = ChunkSpan(data, chunk, m_NameOffsets); break;
+			case SceneChunkType::NameChars:             ok = ChunkSpan(data, chunk, m_NameChars); break;
+			case SceneChunkType::TransformIndices:      ok = ChunkSpan(data, chunk, m_TransformIndices); break;
+			case SceneChunkType::Transforms:            ok = ChunkSpan(data, chunk, m_Transforms); break;
+			case SceneChunkType::MeshAssets:            ok = ChunkSpan(data, chunk, m_MeshAssets); break;
+			case SceneChunkType::MeshAssetPaths:        ok = ChunkSpan(data, chunk, m_MeshAssetPaths); break;
+			case SceneChunkType::MeshRendererIndices:   ok = ChunkSpan(data, chunk, m_MeshRendererIndices); break;
+			case SceneChunkType::MeshRendererAssets:    ok = ChunkSpan(data, chunk, m_MeshRendererAssets); break;
+			case SceneChunkType::MeshRendererMaterials: ok = ChunkSpan(data, chunk, m_MeshRendererMaterials); break;
+			default: break; // unknown chunks are skipped
+			}
+			if (!ok) return false;
+		}
+
+		// Everything below is indexed blindly at load time, so validate it once here.
+		const uint32_t count = header.m_EntityCount;
+		if (m_UUIDs.size() != count || m_Parents.size() != count || m_NameIndices.size() != count)
+			return false;
+
+		for (uint32_t i = 0; i < count; ++i) {
+			if (m_Parents[i] != kNoParent && m_Parents[i] >= i) return false; // pre-order
+		}
+
+		if (m_NameOffsets.empty()) return false;
+		for (size_t i = 1; i < m_NameOffsets.size(); ++i) {
+			if (m_NameOffsets[i] < m_NameOffsets[i - 1]) return false;
+		}
+		if (m_NameOffsets.back() > m_NameChars.size()) return false;
+		for (uint32_t nameIndex : m_NameIndices) {
+			if (nameIndex >= GetNameCount()) return false;
+		}
+
+		// Index columns are strictly increasing: a repeated entity would be bulk-inserted twice.
+		if (m_TransformIndices.size() != m_Transforms.size()) return false;
+		for (size_t i = 0; i < m_TransformIndices.size(); ++i) {
+			if (m_TransformIndices[i] >= count) return false;
+			if (i > 0 && m_TransformIndices[i] <= m_TransformIndices[i - 1]) return false;
+		}
+
+		for (const auto& record : m_MeshAssets) {
+			if (static_cast<uint64_t>(record.m_PathOffset) + record.m_PathLength > m_MeshAssetPaths.size()) return false;
+		}
+		if (m_MeshRendererIndices.size() != m_MeshRendererAssets.size() ||
+			m_MeshRendererIndices.size() != m_MeshRendererMaterials.size())
+			return false;
+		for (size_t i = 0; i < m_MeshRendererIndices.size(); ++i) {
+			if (m_MeshRendererIndices[i] >= count) return false;
+			if (i > 0 && m_MeshRendererIndices[i] <= m_MeshRendererIndices[i - 1]) return false;
+			if (m_MeshRendererAssets[i] != kNoAsset && m_MeshRendererAssets[i] >= m_MeshAssets.size()) return false;
+		}
+
+		m_EntityCount = count;
+		return true;
+	}
+
+	std::string_view SceneFile::GetName(uint32_t index) const {
+		const uint32_t begin = m_NameOffsets[index];
+		return std::string_view(m_NameChars.data() + begin, m_NameOffsets[index + 1] - begin);
+	}
+
+	std::string_view SceneFile::GetMeshAssetPath(uint32_t index) const {
+		const auto& record = m_MeshAssets[index];
+		return std::string_view(m_MeshAssetPaths.data() + record.m_PathOffset, record.m_PathLength);
+	}
+
+	bool SceneFile::Write(const std::filesystem::path& path, const Scene& scene) {
+		// Pre-order, root excluded: parents always precede their children.
+		std::vector<entt::entity> order;
+		scene.ForEachInSubtree(scene.GetRootEntity(), [&order](entt::entity e) { order.push_back(e); });
+		order.erase(order.begin());
+		return WriteEntities(path, scene, order);
+	}
+
+	bool SceneFile::Write(const std::filesystem::path& path, const Scene& scene, std::span<const entt::entity> roots) {
+		std::vector<entt::entity> order;
+		for (entt::entity root : roots) {
+			if (scene.GetRegistry().valid(root) && root != scene.GetRootEntity())
+				scene.ForEachInSubtree(root, [&order](entt::entity e) { order.push_back(e); });
+		}
+		return WriteEntities(path, scene, order);
+	}
+
+	bool SceneFile::WriteEntities(const std::filesystem::path& path, const Scene& scene, const std::vector<entt::entity>& order) {
+		const entt::registry& registry = scene.GetRegistry();
+
+		const uint32_t count = static_cast<uint32_t>(order.size());
+		std::unordered_map<entt::entity, uint32_t> indexOf;
+		indexOf.reserve(count);
+		for (uint32_t i = 0; i < count; ++i)
+			indexOf.emplace(order[i], i);
+
+		std::vector<uint64_t> uuids(count, 0);
+		std::vector<uint32_t> parents(count, kNoParent);
+		std::vector<uint32_t> nameIndices(count, 0);
+		std::vector<uint32_t> nameOffsets{ 0 };
+		std::string nameChars;
+		std::unordered_map<std::string, uint32_t> nameTable;
+
+		std::vector<uint32_t> transformIndices;
+		std::vector<TransformComponent> transforms;
+
+		std::vector<SceneMeshAssetRecord> meshAssets;
+		std::string meshAssetPaths;
+		std::unordered_map<std::string, uint32_t> meshAssetTable;
+		std::vector<uint32_t> meshRendererIndices;
+		std::vector<uint32_t> meshRendererAssets;
+		std::vector<Material> meshRendererMaterials;
+
+		for (uint32_t i = 0; i < count; ++i) {
+			const entt::entity entity = order[i];
+
+			if (const auto* id = registry.try_get<ECS::Components::IDComponent>(entity))
+				uuids[i] = id->m_ID;
+
+			const entt::entity parent = scene.GetParent(entity);
+			if (auto it = indexOf.find(parent); it != indexOf.end())
+				parents[i] = it->second;
+
+			std::string name;
+			if (const auto* nameComponent = registry.try_get<ECS::Components::NameComponent>(entity))
+				name = nameComponent->GetName();
+			auto [nameIt, inserted] = nameTable.try_emplace(name, static_cast<uint32_t>(nameOffsets.size() - 1));
+			if (inserted) {
+				nameChars += name;
+				nameOffsets.push_back(static_cast<uint32_t>(nameChars.size()));
+			}
+			nameIndices[i] = nameIt->second;
+
+			if (const auto* transform = registry.try_get<TransformComponent>(entity)) {
+				transformIndices.push_back(i);
+				transforms.push_back(*transform);
+			}
+
+			if (const auto* renderer = registry.try_get<ECS::Components::MeshRendererComponent>(entity)) {
+				uint32_t assetIndex = kNoAsset;
+				if (renderer->m_MeshAsset) {
+					const std::string assetPath = renderer->m_MeshAsset->GetPath().generic_string();
+					const auto& desc = renderer->m_MeshAsset->GetDesc();
+					std::string key = assetPath;
+					key.push_back('\0');
+					key.append(reinterpret_cast<const char*>(&desc), sizeof(desc));
+
+					auto [assetIt, added] = meshAssetTable.try_emplace(key, static_cast<uint32_t>(meshAssets.size()));
+					if (added) {
+						SceneMeshAssetRecord record{};
+						record.m_PathOffset = static_cast<uint32_t>(meshAssetPaths.size());
+						record.m_PathLength = static_cast<uint32_t>(assetPath.size());
+						record.m_Desc = desc;
+						meshAssets.push_back(record);
+						meshAssetPaths += assetPath;
+					}
+					assetIndex = assetIt->second;
+				}
+				meshRendererIndices.push_back(i);
+				meshRendererAssets.push_back(assetIndex);
+				// Bindless slots belong to this session's heap; whoever loads the scene registers its own.
+				Material& material = meshRendererMaterials.emplace_back(renderer->m_Material);
+				material.m_BaseColorTexture = Renderer::RHI::kInvalidBindlessIndex;
+				material.m_DataBuffer = Renderer::RHI::kInvalidBindlessIndex;
+			}
+		}
+
+		struct PendingChunk {
+			SceneChunkType m_Type;
+			uint32_t m_Count;
+			const void* m_Data;
+			uint64_t m_Size;
+		};
+		std::vector<PendingChunk> pending;
+		auto add = [&pending](SceneChunkType type, const auto& values) {
+			using T = typename std::decay_t<decltype(values)>::value_type;
+			pending.push_back({ type, static_cast<uint32_t>(values.size()), values.data(), values.size() * sizeof(T) });
+		};
+		add(SceneChunkType::UUIDs, uuids);
+		add(SceneChunkType::Parents, parents);
+		add(SceneChunkType::NameIndices, nameIndices);
+		add(SceneChunkType::NameOffsets, nameOffsets);
+		add(SceneChunkType::NameChars, nameChars);
+		add(SceneChunkType::TransformIndices, transformIndices);
+		add(SceneChunkType::Transforms, transforms);
+		add(SceneChunkType::MeshAssets, meshAssets);
+		add(SceneChunkType::MeshAssetPaths, meshAssetPaths);
+		add(SceneChunkType::MeshRendererIndices, meshRendererIndices);
+		add(SceneChunkType::MeshRendererAssets, meshRendererAssets);
+		add(SceneChunkType::MeshRendererMaterials, meshRendererMaterials);
+
+		std::vector<SceneChunkEntry> table(pending.size());
+		uint64_t cursor = sizeof(SceneFileHeader) + table.size() * sizeof(SceneChunkEntry);
+		for (size_t i = 0; i < pending.size(); ++i) {
+			cursor = AlignUp(cursor);
+			table[i].m_Type = static_cast<uint32_t>(pending[i].m_Type);
+			table[i].m_Count = pending[i].m_Count;
+			table[i].m_Offset = cursor;
+			table[i].m_Size = pending[i].m_Size;
+			cursor += pending[i].m_Size;
+		}
+
+		SceneFileHeader header{};
+		header.m_Magic = kMagic;
+		header.m_Version = kVersion;
+		header.m_EntityCount = count;
+		header.m_ChunkCount = static_cast<uint32_t>(table.size());
+		header.m_FileSize = cursor;
+
+		// Write next to the target and swap it in, so a crash never leaves a torn scene behind.
+		std::filesystem::path temp = path;
+		temp += ".tmp";
+		{
+			std::ofstream os(temp, std::ios::binary | std::ios::trunc);
+			if (!os.is_open()) {
+				NV_LOG_WARN(("SceneFile: cannot write " + temp.generic_string()).c_str());
+				return false;
+			}
+
+			static const char kZeros[kChunkAlignment] = {};
+			os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			os.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(SceneChunkEntry)));
+			uint64_t written = sizeof(header) + table.size() * sizeof(SceneChunkEntry);
+			for (size_t i = 0; i < pending.size(); ++i) {
+				os.write(kZeros, static_cast<std::streamsize>(table[i].m_Offset - written));
+				os.write(static_cast<const char*>(pending[i].m_Data), static_cast<std::streamsize>(pending[i].m_Size));
+				written = table[i].m_Offset + pending[i].m_Size;
+			}
+			if (!os) {
+				NV_LOG_WARN(("SceneFile: write failed for " + temp.generic_string()).c_str());
+				return false;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(temp, path, ec);
+		if (ec) {
+			NV_LOG_WARN(("SceneFile: cannot replace " + path.generic_string() + ": " + ec.message()).c_str());
+			std::filesystem::remove(temp, ec);
+			return false;
+		}
+		return true;
+	}
+
+} // namespace Nova::Core::Scene
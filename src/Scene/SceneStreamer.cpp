@@ -0,0 +1,378 @@
+#include "Scene/SceneStreamer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <utility>
+
+#include "Asset/AssetManager.h"
+#include "Asset/Assets/MeshAsset.h"
+#include "Core/Log.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneFile.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+
+namespace Nova::Core::Scene {
+
+	namespace {
+
+		constexpr std::string_view kCellPrefix = "Cell_";
+		constexpr std::string_view kCellExtension = ".nvscene";
+
+		// "Cell_<x>_<z>" -> (x, z)
+		bool ParseCellName(const std::string& stem, glm::ivec2& out) {
+			if (stem.size() <= kCellPrefix.size() || stem.compare(0, kCellPrefix.size(), kCellPrefix) != 0)
+				return false;
+
+			const char* begin = stem.data() + kCellPrefix.size();
+			const char* end = stem.data() + stem.size();
+			auto [sep, ecX] = std::from_chars(begin, end, out.x);
+			if (ecX != std::errc() || sep == end || *sep != '_')
+				return false;
+			auto [last, ecZ] = std::from_chars(sep + 1, end, out.y);
+			return ecZ == std::errc() && last == end;
+		}
+
+		bool IsCellFile(const std::filesystem::directory_entry& entry, glm::ivec2& coord) {
+			std::error_code ec;
+			return entry.is_regular_file(ec) && entry.path().extension() == kCellExtension &&
+				ParseCellName(entry.path().stem().string(), coord);
+		}
+
+	} // namespace
+
+	SceneStreamer::SceneStreamer(Scene& scene, const SceneStreamerSettings& settings)
+		: m_Scene(scene), m_Settings(settings)
+	{
+		if (m_Settings.m_UnloadRadius < m_Settings.m_LoadRadius) {
+			NV_LOG_WARN("SceneStreamer: unload radius is below the load radius, clamping (cells would thrash)");
+			m_Settings.m_UnloadRadius = m_Settings.m_LoadRadius;
+		}
+	}
+
+	SceneStreamer::~SceneStreamer() {
+		StopLoaders();
+	}
+
+	bool SceneStreamer::Open(const std::filesystem::path& directory) {
+		Close();
+
+		std::error_code ec;
+		std::filesystem::directory_iterator it(directory, ec);
+		if (ec) {
+			NV_LOG_WARN(("SceneStreamer: cannot open " + directory.generic_string() + ": " + ec.message()).c_str());
+			return false;
+		}
+
+		for (const auto& entry : it) {
+			glm::ivec2 coord{ 0 };
+			if (!IsCellFile(entry, coord))
+				continue;
+			Cell& cell = m_Cells.emplace_back();
+			cell.m_Coord = coord;
+			cell.m_Path = entry.path();
+		}
+		std::sort(m_Cells.begin(), m_Cells.end(), [](const Cell& a, const Cell& b) {
+			return a.m_Coord.y != b.m_Coord.y ? a.m_Coord.y < b.m_Coord.y : a.m_Coord.x < b.m_Coord.x;
+		});
+
+		return true;
+	}
+
+	void SceneStreamer::Close() {
+		std::vector<LoadResult> results;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Requests.clear();
+			results.swap(m_Results);
+		}
+		for (LoadResult& result : results)
+			ReleaseMeshes(result.m_Meshes);
+
+		for (Cell& cell : m_Cells) {
+			if (cell.m_State == CellState::Loaded)
+				Unload(cell);
+			else
+				ReleaseMeshes(cell.m_Meshes); // staged
+		}
+		// Loads still in flight carry generations that no cell will match again.
+		m_Cells.clear();
+		m_LoadedCount = 0;
+	}
+
+	size_t SceneStreamer::GetPendingCellCount() const {
+		return static_cast<size_t>(std::count_if(m_Cells.begin(), m_Cells.end(), [](const Cell& cell) {
+			return cell.m_State == CellState::Requested || cell.m_State == CellState::Staged;
+		}));
+	}
+
+	void SceneStreamer::Update(const glm::vec3& focus) {
+		CollectResults();
+		// Meshes an unloaded cell left behind while a queued frame still drew them go now.
+		Asset::AssetManager::Get().ReleasePending();
+
+		std::vector<uint32_t> wanted;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_Cells.size()); ++i) {
+			Cell& cell = m_Cells[i];
+			cell.m_Distance = DistanceToCell(cell, focus);
+
+			switch (cell.m_State) {
+			case CellState::Unloaded:
+				if (cell.m_Distance <= m_Settings.m_LoadRadius)
+					wanted.push_back(i);
+				break;
+			case CellState::Requested:
+			case CellState::Staged:
+				if (cell.m_Distance > m_Settings.m_UnloadRadius)
+					Cancel(i);
+				break;
+			case CellState::Loaded:
+				if (cell.m_Distance > m_Settings.m_UnloadRadius)
+					Unload(cell);
+				break;
+			case CellState::Failed:
+				break;
+			}
+		}
+
+		if (!wanted.empty()) {
+			std::sort(wanted.begin(), wanted.end(), [this](uint32_t a, uint32_t b) {
+				return m_Cells[a].m_Distance < m_Cells[b].m_Distance;
+			});
+			Request(wanted);
+		}
+
+		MergeStaged();
+	}
+
+	float SceneStreamer::DistanceToCell(const Cell& cell, const glm::vec3& focus) const {
+		const glm::vec2 min = glm::vec2(cell.m_Coord) * m_Settings.m_CellSize;
+		const glm::vec2 max = min + glm::vec2(m_Settings.m_CellSize);
+		const glm::vec2 p(focus.x, focus.z);
+		const glm::vec2 d = glm::max(glm::max(min - p, p - max), glm::vec2(0.0f));
+		return glm::length(d);
+	}
+
+	void SceneStreamer::Request(const std::vector<uint32_t>& indices) {
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			for (uint32_t index : indices) {
+				Cell& cell = m_Cells[index];
+				cell.m_State = CellState::Requested;
+				cell.m_Generation = ++m_NextGeneration;
+				m_Requests.push_back({ index, cell.m_Generation, cell.m_Path });
+			}
+		}
+		DispatchLoaders();
+	}
+
+	void SceneStreamer::Cancel(uint32_t index) {
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			std::erase_if(m_Requests, [index](const LoadRequest& request) { return request.m_Cell == index; });
+		}
+		// A loader already working on it finishes, and CollectResults drops the result.
+		Cell& cell = m_Cells[index];
+		cell.m_Staged.reset();
+		ReleaseMeshes(cell.m_Meshes);
+		cell.m_State = CellState::Unloaded;
+	}
+
+	void SceneStreamer::Unload(Cell& cell) {
+		m_Scene.DestroyEntities(cell.m_Roots);
+		cell.m_Roots.clear();
+		ReleaseMeshes(cell.m_Meshes);
+		cell.m_State = CellState::Unloaded;
+		--m_LoadedCount;
+	}
+
+	void SceneStreamer::ReleaseMeshes(std::vector<std::shared_ptr<Asset::Assets::MeshAsset>>& meshes) {
+		std::vector<std::filesystem::path> paths;
+		paths.reserve(meshes.size());
+		for (const auto& mesh : meshes) {
+			if (mesh)
+				paths.push_back(mesh->GetPath());
+		}
+		meshes.clear();
+		// Meshes still used by another cell (or anything else) stay; Update() retries them through ReleasePending().
+		for (const auto& path : paths)
+			Asset::AssetManager::Get().Release(path);
+	}
+
+	void SceneStreamer::CollectResults() {
+		std::vector<LoadResult> results;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			results.swap(m_Results);
+		}
+
+		for (LoadResult& result : results) {
+			// Results of cancelled or superseded requests are dropped, along with the meshes they loaded.
+			if (result.m_Cell >= m_Cells.size() || m_Cells[result.m_Cell].m_State != CellState::Requested ||
+				m_Cells[result.m_Cell].m_Generation != result.m_Generation)
+			{
+				ReleaseMeshes(result.m_Meshes);
+				continue;
+			}
+			Cell& cell = m_Cells[result.m_Cell];
+
+			if (result.m_File) {
+				cell.m_Staged = std::move(result.m_File);
+				cell.m_Meshes = std::move(result.m_Meshes);
+				cell.m_State = CellState::Staged;
+			}
+			else {
+				// SceneFile::Open already logged why; do not retry every frame.
+				cell.m_State = CellState::Failed;
+			}
+		}
+	}
+
+	void SceneStreamer::MergeStaged() {
+		std::vector<uint32_t> staged;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_Cells.size()); ++i) {
+			if (m_Cells[i].m_State == CellState::Staged)
+				staged.push_back(i);
+		}
+		if (staged.empty())
+			return;
+
+		std::sort(staged.begin(), staged.end(), [this](uint32_t a, uint32_t b) {
+			return m_Cells[a].m_Distance < m_Cells[b].m_Distance;
+		});
+
+		// Whole cells only, nearest first; the first one always goes in so streaming cannot stall.
+		const auto start = std::chrono::steady_clock::now();
+		for (uint32_t index : staged) {
+			Cell& cell = m_Cells[index];
+			const SceneFile& file = *cell.m_Staged;
+
+			const std::vector<entt::entity> entities = m_Scene.Instantiate(file);
+			const auto parents = file.GetParents();
+			cell.m_Roots.clear();
+			for (size_t i = 0; i < entities.size(); ++i) {
+				if (parents[i] == SceneFile::kNoParent)
+					cell.m_Roots.push_back(entities[i]);
+			}
+
+			cell.m_Staged.reset();
+			cell.m_State = CellState::Loaded;
+			++m_LoadedCount;
+
+			const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			if (elapsed.count() >= m_Settings.m_MergeBudgetMs)
+				break;
+		}
+	}
+
+	void SceneStreamer::DispatchLoaders() {
+		// Each loader job drains the queue, so at most m_MaxConcurrentLoads workers are ever busy with I/O.
+		uint32_t dispatch = 0;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			const size_t wanted = std::min<size_t>(std::max(m_Settings.m_MaxConcurrentLoads, 1u), m_Requests.size());
+			if (wanted > m_ActiveLoaders) {
+				dispatch = static_cast<uint32_t>(wanted) - m_ActiveLoaders;
+				m_ActiveLoaders += dispatch;
+			}
+		}
+		for (uint32_t i = 0; i < dispatch; ++i) {
+			JobSystem::Run([this]() { LoaderJob(); }, { "SceneStreamer load", &m_LoaderJobs });
+		}
+	}
+
+	void SceneStreamer::StopLoaders() {
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Requests.clear();
+		}
+		JobSystem::Wait(m_LoaderJobs);
+	}
+
+	void SceneStreamer::LoaderJob() {
+		for (;;) {
+			LoadRequest request;
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				if (m_Requests.empty()) {
+					--m_ActiveLoaders;
+					return;
+				}
+				request = std::move(m_Requests.front());
+				m_Requests.pop_front();
+			}
+
+			// Map, validate and page in here, so the merge on the main thread never waits on I/O.
+			auto file = std::make_unique<SceneFile>();
+			if (file->Open(request.m_Path))
+				file->Prefault();
+			else
+				file.reset();
+
+			// Load each distinct mesh too: Scene::Instantiate then finds them in the AssetManager, ready to draw.
+			std::vector<std::shared_ptr<Asset::Assets::MeshAsset>> meshes;
+			if (file) {
+				meshes.reserve(file->GetMeshAssetCount());
+				for (uint32_t i = 0; i < file->GetMeshAssetCount(); ++i) {
+					auto mesh = Asset::AssetManager::Get().Acquire<Asset::Assets::MeshAsset>(
+						std::filesystem::path(file->GetMeshAssetPath(i)), file->GetMeshAssetDesc(i)).GetAssetRef();
+					if (mesh)
+						mesh->Load(); // logs its own failure; the cell still streams in, without that mesh
+					meshes.push_back(std::move(mesh));
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Results.push_back({ request.m_Cell, request.m_Generation, std::move(file), std::move(meshes) });
+		}
+	}
+
+	std::string SceneStreamer::GetCellFileName(const glm::ivec2& cell) {
+		return std::string(kCellPrefix) + std::to_string(cell.x) + "_" + std::to_string(cell.y) + std::string(kCellExtension);
+	}
+
+	bool SceneStreamer::WriteCells(const Scene& scene, const std::filesystem::path& directory, float cellSize) {
+		if (!(cellSize > 0.0f)) {
+			NV_LOG_WARN("SceneStreamer: cell size must be positive");
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::create_directories(directory, ec);
+		if (ec) {
+			NV_LOG_WARN(("SceneStreamer: cannot create " + directory.generic_string() + ": " + ec.message()).c_str());
+			return false;
+		}
+		// Stale cells from a previous layout would otherwise stream back in.
+		std::vector<std::filesystem::path> stale;
+		for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+			glm::ivec2 coord{ 0 };
+			if (IsCellFile(entry, coord))
+				stale.push_back(entry.path());
+		}
+		for (const auto& path : stale)
+			std::filesystem::remove(path, ec);
+
+		// Top-level entities sit under the root, so their local translation is their world position.
+		std::map<std::pair<int, int>, std::vector<entt::entity>> cells;
+		const entt::registry& registry = scene.GetRegistry();
+		for (entt::entity entity : scene.GetChildren(scene.GetRootEntity())) {
+			glm::vec3 position(0.0f);
+			if (const auto* transform = registry.try_get<ECS::Components::TransformComponent>(entity))
+				position = transform->m_Translation;
+			const int x = static_cast<int>(std::floor(position.x / cellSize));
+			const int z = static_cast<int>(std::floor(position.z / cellSize));
+			cells[{ z, x }].push_back(entity);
+		}
+
+		bool ok = true;
+		for (const auto& [key, roots] : cells) {
+			const glm::ivec2 coord(key.second, key.first);
+			ok &= SceneFile::Write(directory / GetCellFileName(coord), scene, roots);
+		}
+		return ok;
+	}
+
+} // namespace Nova::Core::Scene
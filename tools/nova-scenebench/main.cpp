@@ -0,0 +1,96 @@
+// nova-scenebench: builds a synthetic scene, saves it as .nvscene and loads it back, reporting timings.
+//
+//   nova-scenebench [--entities <count>] [--out <file>]
+//
+// The scene mixes root-level entities with small child hierarchies (one in four entities is a child)
+// and gives every entity a TransformComponent, which is the layout of our large levels.
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include "Core/Log.h"
+#include "Scene/Scene.h"
+#include "Scene/ECS/Components/TransformComponent.h"
+
+using namespace Nova::Core;
+using Clock = std::chrono::steady_clock;
+
+static double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static void PrintUsage() {
+    NV_LOG_INFO("Usage: nova-scenebench [--entities <count>] [--out <file>]");
+}
+
+int main(int argc, char** argv) {
+    size_t entityCount = 200000;
+    std::filesystem::path out = std::filesystem::temp_directory_path() / "nova-scenebench.nvscene";
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--entities" && i + 1 < argc) {
+            entityCount = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--out" && i + 1 < argc) {
+            out = argv[++i];
+        }
+        else {
+            PrintUsage();
+            return (arg == "--help" || arg == "-h") ? 0 : 2;
+        }
+    }
+
+    Scene::Scene source("Bench");
+    auto start = Clock::now();
+    {
+        const size_t parents = entityCount - entityCount / 4;
+        const auto roots = source.CreateEntities(parents, "Prop");
+        for (size_t i = 0; i < entityCount - parents; ++i) {
+            source.CreateEntities(1, "Part", roots[i % roots.size()]);
+        }
+
+        auto& registry = source.GetRegistry();
+        size_t i = 0;
+        source.ForEachInSubtree(source.GetRootEntity(), [&](entt::entity e) {
+            if (e == source.GetRootEntity()) return;
+            const float f = static_cast<float>(i++);
+            registry.emplace<Scene::ECS::Components::TransformComponent>(e,
+                glm::vec3(f, 0.0f, -f), glm::vec3(0.0f, f * 0.01f, 0.0f), glm::vec3(1.0f));
+        });
+    }
+    NV_LOG_INFO(("build:       " + std::to_string(MillisecondsSince(start)) + " ms").c_str());
+
+    start = Clock::now();
+    if (!source.Serialize(out)) {
+        NV_LOG_ERROR("nova-scenebench: Serialize failed");
+        return 1;
+    }
+    NV_LOG_INFO(("serialize:   " + std::to_string(MillisecondsSince(start)) + " ms, " +
+        std::to_string(std::filesystem::file_size(out) / 1024) + " KiB").c_str());
+
+    Scene::Scene loaded("Loaded");
+    start = Clock::now();
+    if (!loaded.Deserialize(out)) {
+        NV_LOG_ERROR("nova-scenebench: Deserialize failed");
+        return 1;
+    }
+    NV_LOG_INFO(("deserialize: " + std::to_string(MillisecondsSince(start)) + " ms").c_str());
+
+    start = Clock::now();
+    loaded.UpdateTransforms();
+    NV_LOG_INFO(("transforms:  " + std::to_string(MillisecondsSince(start)) + " ms").c_str());
+
+    const size_t loadedCount = loaded.GetRegistry().storage<Scene::ECS::Components::TransformComponent>().size();
+    if (loadedCount != entityCount) {
+        NV_LOG_ERROR(("nova-scenebench: loaded " + std::to_string(loadedCount) + " of " +
+            std::to_string(entityCount) + " entities").c_str());
+        return 1;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(out, ec);
+    return 0;
+}
@@ -0,0 +1,106 @@
+// nova-shaderc: compiles every shader (and every compile-keyword permutation) found under the given
+// directories into Cache/Shaders/ShaderCache.nvpak, so builds configured with NOVA_SHADER_PRECOMPILED
+// can run without Slang. Exits non-zero if any shader fails to compile.
+//
+//   nova-shaderc [--working-dir <dir>] <shader dir>...
+//
+// The working directory must be the one the application runs from: cache keys and engine include
+// paths are resolved against it exactly as ShaderAsset does at runtime.
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Asset/Assets/ShaderAsset.h"
+#include "Core/GraphicsAPI.h"
+#include "Core/Log.h"
+#include "Renderer/RHI/RHI_ShaderCompiler.h"
+
+using namespace Nova::Core;
+using namespace Nova::Core::Renderer;
+
+static void PrintUsage() {
+    NV_LOG_INFO("Usage: nova-shaderc [--working-dir <dir>] <shader dir>...");
+}
+
+int main(int argc, char** argv) {
+    std::filesystem::path workingDir;
+    std::vector<std::filesystem::path> shaderDirs;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--working-dir" && i + 1 < argc) {
+            workingDir = argv[++i];
+        }
+        else if (arg == "--help" || arg == "-h") {
+            PrintUsage();
+            return 0;
+        }
+        else {
+            // Resolve before changing directory so relative paths mean what the caller meant.
+            shaderDirs.push_back(std::filesystem::absolute(arg));
+        }
+    }
+    if (shaderDirs.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    if (!workingDir.empty()) {
+        std::error_code ec;
+        std::filesystem::current_path(workingDir, ec);
+        if (ec) {
+            NV_LOG_ERROR(("nova-shaderc: cannot enter working directory " + workingDir.string()).c_str());
+            return 2;
+        }
+    }
+
+    // The tool links the same library as shipping builds; it is the one place that must compile.
+    RHI::RHI_ShaderCompiler::SetPrecompiledOnly(false);
+
+    std::vector<std::shared_ptr<Asset::Assets::ShaderAsset>> shaders;
+    for (const auto& dir : shaderDirs) {
+        std::error_code ec;
+        for (auto it = std::filesystem::recursive_directory_iterator(dir, ec);
+             !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+        {
+            if (!it->is_regular_file()) continue;
+            // Modules such as NovaMaterial.slang have no stage and are compiled as part of their users.
+            if (RHI::ShaderStageFromFileExtension(it->path()) == RHI::RHI_ShaderStage::Unknown) continue;
+            shaders.push_back(std::make_shared<Asset::Assets::ShaderAsset>(it->path()));
+        }
+        if (ec) {
+            NV_LOG_ERROR(("nova-shaderc: cannot read " + dir.string()).c_str());
+            return 2;
+        }
+    }
+
+    // Variant 0 first: compiling reports each shader's includes, whose `// @keywords` add permutations.
+    Asset::Assets::ShaderAsset::CompileAll(shaders, GraphicsAPI::Vulkan);
+
+    std::vector<RHI::RHI_ShaderCompileInput> inputs;
+    for (const auto& shader : shaders) {
+        std::vector<RHI::RHI_ShaderCompileInput> permutations = shader->BuildPermutationInputs(GraphicsAPI::Vulkan);
+        inputs.insert(inputs.end(), std::make_move_iterator(permutations.begin()), std::make_move_iterator(permutations.end()));
+    }
+
+    // Compiled concurrently on the shader worker pool; already cached permutations are skipped.
+    const std::vector<RHI::RHI_ShaderCompileResult> results = RHI::RHI_ShaderCompiler::CompileBatch(inputs);
+
+    size_t failures = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].m_Success) continue;
+        ++failures;
+
+        std::string defines;
+        for (const auto& [name, value] : inputs[i].m_Defines) defines += " " + name + "=" + value;
+        NV_LOG_ERROR(("nova-shaderc: " + inputs[i].m_File.generic_string() + defines + "\n" + results[i].m_Log).c_str());
+    }
+
+    RHI::ShutdownSlang();
+
+    NV_LOG_INFO(("nova-shaderc: " + std::to_string(shaders.size()) + " shaders, " + std::to_string(inputs.size()) +
+        " permutations, " + std::to_string(failures) + " failed").c_str());
+    return failures == 0 ? 0 : 1;
+}